@@ -0,0 +1,99 @@
+/**
+ * @file AnimationSystem.h
+ * @brief Define o AnimationSystem, que anima valores float (ângulos, posições, brilhos)
+ * de forma centralizada.
+ *
+ * Em vez de cada objeto interpolar seus valores em todo update, o objeto pede uma
+ * transição ("tween") ao sistema e para de se preocupar. As transições ativas ficam
+ * em vetores separados por campo (estrutura de vetores), avançadas num único laço
+ * sem desvios, e são retiradas assim que terminam: o custo por passo é proporcional
+ * ao que está se movendo, não ao número de objetos da cena.
+ *
+ * Transições só devem ser criadas ou canceladas na thread de simulação fora da
+ * fase paralela da sala (em commit, onClick ou na inicialização).
+ *
+ * A instância pertence ao Game e é repassada pelo GameStateManager. Ela é declarada
+ * antes da cena, então continua válida enquanto os objetos cancelam as suas
+ * transições nos destrutores.
+ */
+#ifndef ANIMATIONSYSTEM_H
+#define ANIMATIONSYSTEM_H
+
+#include "Vector.h"
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+/** @brief Curvas de aceleração das transições. */
+enum class Ease {
+    LINEAR,  ///< Velocidade constante.
+    SMOOTH,  ///< Acelera e desacelera (smoothstep).
+    OUT      ///< Começa rápido e desacelera no fim.
+};
+
+/**
+ * @class AnimationSystem
+ * @brief Conjunto das transições ativas do jogo.
+ */
+class AnimationSystem {
+public:
+    typedef std::function<void()> Callback;
+
+    /**
+     * @brief Anima um valor do seu estado atual até `to`.
+     *
+     * Se o valor já estiver sendo animado, a transição anterior é substituída
+     * (partindo do valor atual) e o seu callback é descartado.
+     *
+     * @param value O valor animado; deve continuar válido até a transição terminar ou ser cancelada.
+     * @param to O valor final.
+     * @param durationMs A duração, em milissegundos. Com 0, o valor é aplicado na hora.
+     * @param ease A curva de aceleração.
+     * @param onComplete Chamado ao fim da transição (não é chamado se ela for cancelada).
+     */
+    void animate(float* value, float to, float durationMs, Ease ease = Ease::SMOOTH, Callback onComplete = nullptr);
+
+    /**
+     * @brief Anima as três componentes de um vetor. O callback é chamado uma única vez.
+     */
+    void animate(Vector3f* value, const Vector3f& to, float durationMs, Ease ease = Ease::SMOOTH, Callback onComplete = nullptr);
+
+    /** @brief Interrompe a animação de um valor, mantendo-o onde está. */
+    void cancel(float* value);
+
+    /** @brief Interrompe a animação das três componentes de um vetor. */
+    void cancel(Vector3f* value);
+
+    /** @brief Indica se o valor está sendo animado. */
+    bool isAnimating(const float* value) const;
+
+    /**
+     * @brief Avança todas as transições, retira as concluídas e chama os seus callbacks.
+     * @param deltaTime O tempo decorrido (em ms).
+     */
+    void update(float deltaTime);
+
+    /** @brief Número de transições ativas. */
+    size_t getActiveCount() const;
+
+private:
+    void removeAt(size_t index);
+
+    // Um campo por vetor; a transição i ocupa a posição i de todos eles.
+    std::vector<float*> _targets;
+    std::vector<float> _from;
+    std::vector<float> _delta;        ///< to - from.
+    std::vector<float> _elapsed;      ///< ms desde o início.
+    std::vector<float> _invDuration;  ///< 1 / duração (ms).
+    std::vector<float> _curveA;       ///< Curva: e(t) = t * (a + t * (b + t * c)).
+    std::vector<float> _curveB;
+    std::vector<float> _curveC;
+    std::vector<float> _values;       ///< Resultado do passo, antes de ser escrito nos alvos.
+    std::vector<Callback> _callbacks;
+
+    std::unordered_map<const float*, size_t> _indexOf;
+    std::vector<Callback> _finished; ///< Callbacks das transições concluídas no passo, reusado entre passos.
+};
+
+#endif // ANIMATIONSYSTEM_H
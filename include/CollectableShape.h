@@ -0,0 +1,56 @@
+#ifndef COLLECTABLESHAPE_H
+#define COLLECTABLESHAPE_H
+
+#include "InteractableObject.h"
+#include "PhysicsWorld.h"
+#include "GameData.h"
+#include "Transform.h"
+
+/**
+ * @file CollectableShape.h
+ * @brief Define a classe CollectableShape, uma forma (esfera, cubo ou pirâmide) que o
+ * jogador pode pegar, carregar no inventário e soltar em outro lugar.
+ *
+ * Enquanto está no chão, a forma é um corpo rígido da sala; ao ser carregada, o
+ * corpo é desativado e a forma some da cena até ser solta.
+ */
+
+class CollectableShape : public InteractableObject {
+public:
+    /**
+     * @param position A posição inicial da forma.
+     * @param shapeType FORMA_ESFERA, FORMA_CUBO ou FORMA_PIRAMIDE.
+     * @param color A cor da forma.
+     */
+    CollectableShape(const Vector3f& position, ItemType shapeType, const Vector3f& color);
+
+    void update(float deltaTime, GameStateManager& gameStateManager) override;
+    void collectDrawItems(RenderPacket& packet) override;
+    void draw(const DrawItem& item) override;
+    void onClick(GameStateManager& gameStateManager) override;
+    float getCollisionRadius() const override;
+    BoundingBox getBoundingBox() const override;
+    RigidBody* getRigidBody() override { return &_body; }
+
+    /**
+     * @brief Solta a forma carregada numa posição, tirando-a do inventário.
+     * @param position Onde a forma reaparece.
+     * @param gameStateManager O gerenciador de estado do jogo.
+     */
+    void dropAt(const Vector3f& position, GameStateManager& gameStateManager);
+
+    bool isCarried() const { return _isCarried; }
+    ItemType getShapeType() const { return _shapeType; }
+    const Vector3f& getColor() const { return _color; }
+
+private:
+    RigidBody _body;
+    Transform _transform;
+    ItemType _shapeType;
+    Vector3f _color;
+    float _size;
+    bool _isCarried;
+    int _lod; ///< Nível de detalhe da esfera no último quadro.
+};
+
+#endif // COLLECTABLESHAPE_H
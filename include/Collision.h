@@ -0,0 +1,78 @@
+/**
+ * @file Collision.h
+ * @brief Consultas de colisão contínua: cápsula vertical varrida contra caixas alinhadas
+ * aos eixos (AABB), com resolução por deslizamento.
+ *
+ * O corpo do jogador é uma cápsula vertical que se move no plano XZ. Em vez de
+ * mover e testar sobreposição (o que permite atravessar paredes finas com passos
+ * grandes), a cápsula é varrida ao longo do deslocamento: calcula-se o instante do
+ * primeiro contato, move-se até ele e o restante do deslocamento é projetado sobre
+ * a superfície atingida.
+ */
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include "Vector.h"
+#include <vector>
+
+/**
+ * @brief Cápsula vertical: um segmento no eixo Y com raio.
+ */
+struct Capsule {
+    Vector3f center;   ///< Centro do segmento.
+    float halfHeight;  ///< Meia altura do segmento (sem contar as tampas).
+    float radius;      ///< Raio da cápsula.
+};
+
+/**
+ * @brief Resultado de uma varredura.
+ */
+struct SweepHit {
+    float time;       ///< Fração do deslocamento [0, 1] até o contato.
+    Vector3f normal;  ///< Normal da superfície atingida (no plano XZ).
+};
+
+/**
+ * @brief Verifica a colisão entre duas caixas delimitadoras (Bounding Boxes).
+ * @return Retorna 'true' se as caixas se sobrepõem, 'false' caso contrário.
+ */
+bool checkCollision(const BoundingBox& a, const BoundingBox& b);
+
+namespace Collision {
+    /**
+     * @brief Varre a cápsula ao longo de um deslocamento horizontal contra uma caixa.
+     *
+     * A componente Y do deslocamento é ignorada. A forma testada é exata: a soma de
+     * Minkowski entre o retângulo da caixa e o círculo da cápsula na altura da caixa.
+     *
+     * @param capsule A cápsula na posição inicial.
+     * @param motion O deslocamento (X e Z).
+     * @param box A caixa a testar.
+     * @param hit Preenchido com o instante e a normal do contato.
+     * @return true se houver contato dentro do deslocamento.
+     */
+    bool sweepCapsule(const Capsule& capsule, const Vector3f& motion, const BoundingBox& box, SweepHit& hit);
+
+    /**
+     * @brief Empurra a cápsula horizontalmente para fora da caixa, se estiver sobreposta.
+     * @param capsule A cápsula, atualizada no lugar.
+     * @param box A caixa.
+     * @return true se a cápsula foi movida.
+     */
+    bool pushOut(Capsule& capsule, const BoundingBox& box);
+
+    /**
+     * @brief Move a cápsula pelo deslocamento, deslizando pelas superfícies atingidas.
+     *
+     * Funciona para qualquer tamanho de passo: a cápsula nunca atravessa uma caixa,
+     * por mais fina que ela seja.
+     *
+     * @param capsule A cápsula na posição inicial.
+     * @param motion O deslocamento desejado (X e Z).
+     * @param colliders As caixas estáticas da sala.
+     * @return A posição final do centro da cápsula.
+     */
+    Vector3f moveAndSlide(const Capsule& capsule, const Vector3f& motion, const std::vector<BoundingBox>& colliders);
+}
+
+#endif // COLLISION_H
@@ -35,7 +35,42 @@ namespace Config {
     static const float PLAYER_COLLISION_RADIUS = 0.3f;
     /** @brief Distncia mxima em que o jogador pode interagir com objetos. */
     static const float PLAYER_INTERACTION_DISTANCE = 3.0f;
+    /** @brief Meia altura do corpo do jogador, medida a partir da altura dos olhos. */
+    static const float PLAYER_BODY_HALF_HEIGHT = 1.0f;
 
+    // --- Coliso ---
+    /** @brief Folga mantida entre o jogador e as superfcies aps um contato. */
+    static const float COLLISION_SKIN = 0.001f;
+    /** @brief Nmero mximo de deslizamentos por passo (suficiente para cantos). */
+    static const int COLLISION_MAX_SLIDES = 4;
+
+    // --- Fsica ---
+    /** @brief Passo fixo da simulao fsica, em milissegundos. */
+    static const float PHYSICS_STEP_MS = 1000.0f / 120.0f;
+    /** @brief Mximo de passos fsicos por atualizao (evita a espiral de atraso). */
+    static const int PHYSICS_MAX_SUBSTEPS = 8;
+    /** @brief Acelerao da gravidade, em unidades por segundo ao quadrado. */
+    static const float PHYSICS_GRAVITY = 9.8f;
+    /** @brief Penetrao tolerada nos contatos antes de corrigir a posio. */
+    static const float PHYSICS_CONTACT_SLOP = 0.005f;
+    /** @brief Velocidade de impacto abaixo da qual os choques no quicam. */
+    static const float PHYSICS_BOUNCE_SPEED = 0.5f;
+    /** @brief Velocidade abaixo da qual um corpo  considerado parado. */
+    static const float PHYSICS_SLEEP_VELOCITY = 0.05f;
+    /** @brief Tempo (s) que uma ilha precisa ficar parada para dormir. */
+    static const float PHYSICS_SLEEP_TIME = 0.5f;
+    /** @brief Tamanho da clula da grade de volumes de gatilho. */
+    static const float TRIGGER_CELL_SIZE = 2.0f;
+
+    // --- Puzzles ---
+    /** @brief Arquivo com as regras dos puzzles, compilado ao iniciar o jogo. */
+    static const char* const RULES_FILE = "res/rules/puzzles.txt";
+    /** @brief Tempo (ms) sem novos smbolos aps o qual uma entrada incompleta  descartada. */
+    static const unsigned int INPUT_TIMEOUT_MS = 5000;
+    /** @brief Durao (ms) da animao de giro de um cubo do CubePuzzle. */
+    static const float CUBE_ROTATION_MS = 250.0f;
+    /** @brief Durao (ms) da animao de movimento de um cubo do CubePuzzle. */
+    static const float CUBE_MOVE_MS = 400.0f;
 
     // --- Cmera ---
     /** @brief Sensibilidade do mouse para a rotao da cmera. */
@@ -44,6 +79,54 @@ namespace Config {
     static const float CAMERA_ZNEAR = 0.01f;
     /** @brief Distncia mxima de renderizao da cmera (plano de corte distante). */
     static const float CAMERA_ZFAR = 100.0f;
+    /** @brief Campo de viso vertical da cmera, em graus. */
+    static const float CAMERA_FOV_Y = 45.0f;
+
+    // --- Nvel de Detalhe (LOD) ---
+    /**
+     * @brief Raio projetado na tela (em pixels) abaixo do qual o objeto passa para o
+     * nvel seguinte: abaixo do primeiro valor usa o nvel 1, e assim por diante.
+     */
+    static const float LOD_SCREEN_RADIUS[] = { 120.0f, 40.0f, 12.0f };
+    /** @brief Largura da faixa de histerese em volta de cada limiar (frao do limiar). */
+    static const float LOD_HYSTERESIS = 0.15f;
+    /** @brief Tamanho dos blocos do cho, que escolhem o nvel de detalhe separadamente. */
+    static const float FLOOR_CHUNK_SIZE = 2.0f;
+
+    // --- Portais ---
+    /** @brief Quantas salas, no mximo, podem ser vistas em sequncia atravs de portas. */
+    static const int PORTAL_MAX_DEPTH = 2;
+    /**
+     * @brief Distncia, atrs de uma porta-portal, em que fica o ponto de chegada da sala
+     * de destino. A sala de destino  posicionada no mundo a partir dele.
+     */
+    static const float PORTAL_DEPTH = 2.0f;
+
+    // --- Impostores ---
+    /**
+     * @brief Distncia a partir da qual placas e portas so desenhadas como impostor
+     * (uma foto numa textura, ver Impostor).
+     */
+    static const float IMPOSTOR_DISTANCE = 9.0f;
+    /** @brief Largura da faixa de histerese em volta da distncia (frao dela). */
+    static const float IMPOSTOR_HYSTERESIS = 0.1f;
+    /** @brief Resoluo da foto, em texels por unidade do objeto. */
+    static const float IMPOSTOR_TEXELS_PER_UNIT = 96.0f;
+    /** @brief Maior lado da textura de um impostor. */
+    static const int IMPOSTOR_MAX_SIZE = 512;
+
+    // --- Ordem de Desenho ---
+    /**
+     * @brief Passada s de profundidade antes da cor, para os itens opacos da sala atual:
+     * -1 decide a cada quadro (ver DEPTH_PREPASS_MIN_ITEMS), 0 nunca, 1 sempre.
+     */
+    static const int DEPTH_PREPASS = -1;
+    /**
+     * @brief Com DEPTH_PREPASS automtico, quantos itens opacos a sala precisa ter para
+     * usar a passada. Com poucos itens a ordenao j evita quase todo o overdraw, e a
+     * passada s dobraria o custo de vrtices.
+     */
+    static const int DEPTH_PREPASS_MIN_ITEMS = 64;
 
     // --- Iluminao ---
     /** @brief Intensidade da luz ambiente global. */
@@ -64,10 +147,113 @@ namespace Config {
     static const float TILE_SIZE = 2.0f;
     /** @brief Altura das paredes do labirinto. */
     static const float WALL_HEIGHT = 3.0f;
+    /** @brief Arquivo do labirinto (uma linha por fileira: 1 parede, 0 livre, S entrada, E sada). */
+    static const char* const MAZE_FILE = "res/levels/maze.txt";
+
+    // --- Iluminao Pr-calculada ---
+    /** @brief Pasta dos lightmaps calculados (um arquivo por sala). */
+    static const char* const LIGHTMAP_DIR = "res/lightmaps/";
+    /** @brief Texels de lightmap por unidade de mundo, em cada eixo. */
+    static const float LIGHTMAP_TEXELS_PER_UNIT = 4.0f;
+    /** @brief Lado mximo (em texels) da textura de lightmap de uma sala. */
+    static const int LIGHTMAP_MAX_SIZE = 2048;
+    /** @brief Raios por texel no clculo da ocluso de ambiente (arredondado para um quadrado). */
+    static const int LIGHTMAP_AO_SAMPLES = 64;
+    /** @brief Distncia at a qual uma superfcie prxima escurece o ambiente. */
+    static const float LIGHTMAP_AO_DISTANCE = 1.5f;
+
+    // --- Modelos ---
+    /** @brief Pasta dos modelos (.obj); o cache binrio de cada um (.mesh) fica ao lado. */
+    static const char* const MODEL_DIR = "res/models/";
+    /**
+     * @brief Tamanho da cache de vrtices simulada na reordenao dos tringulos dos
+     * modelos. Mudar o valor invalida os caches.
+     */
+    static const int MODEL_VERTEX_CACHE_SIZE = 32;
+
+    // --- Ps-processamento ---
+    /**
+     * @brief Desenha a cena numa textura e aplica o bloom e o FXAA antes de mostr-la.
+     * Sem framebuffer objects ou shaders no OpenGL, a cena vai direto para a tela.
+     */
+    static const bool POST_PROCESSING = true;
+    /** @brief Antisserrilhado por ps-processamento (FXAA) no lugar do MSAA. */
+    static const bool POST_FXAA = true;
+    /** @brief Quantas vezes a textura do bloom  menor que a tela, em cada eixo. */
+    static const int BLOOM_DOWNSAMPLE = 4;
+    /** @brief Passadas de desfoque (horizontal + vertical) do bloom; mais passadas espalham mais o brilho. */
+    static const int BLOOM_BLUR_PASSES = 2;
+    /** @brief Intensidade do brilho somado  cena. */
+    static const float BLOOM_STRENGTH = 1.6f;
+
+    // --- Resoluo Dinmica ---
+    /**
+     * @brief Ajusta a resoluo da cena 3D para manter o tempo de desenho dentro de
+     * FRAME_BUDGET_MS (exige o ps-processamento ativo; o HUD fica na resoluo da tela).
+     */
+    static const bool DYNAMIC_RESOLUTION = true;
+    /** @brief Tempo de desenho desejado por quadro, em ms. */
+    static const float FRAME_BUDGET_MS = 16.0f;
+    /** @brief Menor frao da resoluo da tela, em cada eixo. */
+    static const float RENDER_SCALE_MIN = 0.5f;
+    /** @brief Quantos quadros entram na mdia antes de cada ajuste. */
+    static const int DYNAMIC_RESOLUTION_INTERVAL = 30;
+    /** @brief Folga em volta do oramento (frao dele) dentro da qual a escala no muda. */
+    static const float DYNAMIC_RESOLUTION_DEADBAND = 0.15f;
+    /** @brief Intensidade do filtro de nitidez aplicado ao ampliar a cena. */
+    static const float RENDER_SHARPEN = 0.25f;
+    /**
+     * @brief Liga o QualityGovernor: tesselao, nvel de detalhe, filtragem das texturas
+     * e ps-processamento descem (e voltam a subir) conforme o tempo de desenho. Com a
+     * resoluo dinmica ativa, a qualidade s desce depois que a escala chegar ao mnimo.
+     */
+    static const bool QUALITY_GOVERNOR = true;
+    /** @brief Quantos quadros entram na mdia de cada deciso do governador. */
+    static const int QUALITY_WINDOW = 120;
+    /** @brief A qualidade desce se a mdia passar do oramento mais esta frao dele. */
+    static const float QUALITY_DOWN_MARGIN = 0.2f;
+    /** @brief A qualidade sobe se a mdia ficar abaixo do oramento menos esta frao dele. */
+    static const float QUALITY_UP_MARGIN = 0.4f;
+    /** @brief Arquivo CSV em que cada deciso do governador  acrescentada. */
+    static const char* const QUALITY_LOG_FILE = "quality_log.csv";
+
+    // --- Texturas ---
+    /** @brief Lado (em pixels) de cada material no atlas de texturas. */
+    static const int ATLAS_TILE_SIZE = 512;
+    /** @brief Borda (em pixels) em volta de cada material no atlas, para a filtragem nas emendas. */
+    static const int ATLAS_PADDING = 4;
+
+    // --- Paralelismo ---
+    /** @brief Nmero de threads trabalhadoras do JobSystem (0 = automtico: ncleos - 1). */
+    static const unsigned int JOB_WORKER_THREADS = 0;
+    /** @brief Menor quantidade de objetos por bloco na atualizao paralela de uma sala. */
+    static const unsigned int ROOM_UPDATE_BATCH = 32;
+    /**
+     * @brief Quantos quadros a simulao pode adiantar em relao  renderizao.
+     * Com 0, simulao e renderizao rodam juntas na thread do GLUT.
+     */
+    static const int RENDER_PIPELINE_DEPTH = 1;
+    /** @brief Passo fixo da simulao, em milissegundos (~60 atualizaes por segundo). */
+    static const int SIMULATION_STEP_MS = 16;
+    /**
+     * @brief S publica (e desenha) um quadro quando algo visvel mudou. Parada, a
+     * simulao dorme at chegar uma entrada ou at IDLE_POLL_MS, quando avana os
+     * passos perdidos (timers) e confere de novo.
+     */
+    static const bool RENDER_ON_DEMAND = true;
+    /** @brief Passos seguidos sem mudana antes de a simulao comear a dormir. */
+    static const int IDLE_STEPS_BEFORE_SLEEP = 30;
+    /** @brief Intervalo mximo de sono enquanto ocioso, em ms (atraso mximo de um timer). */
+    static const int IDLE_POLL_MS = 100;
 
     // --- Configuraes de Debug ---
-    /** @brief Se true, desenha uma esfera semi-transparente em volta dos objetos interagveis. */
-    static const bool DEBUG_DRAW_HITBOXES = false;
+    /**
+     * @brief Se o desenho de depurao (hitboxes, caixas das paredes, raio de interao)
+     * comea ligado. Em jogo, a tecla Tab liga e desliga.
+     */
+    static const bool DEBUG_DRAW_ENABLED = false;
+    /** @brief Segmentos de cada crculo das esferas de depurao. */
+    static const int DEBUG_SPHERE_SEGMENTS = 24;
 }
 
 #endif // CONFIG_H
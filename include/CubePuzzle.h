@@ -5,24 +5,30 @@
 #include "RotatingCube.h"
 #include <vector>
 #include <string>
+#include <utility>
 
 class CubePuzzle : public GameObject {
 public:
-    CubePuzzle(int rows, int cols, const Vector3f& startPos, float spacing, float cubeSize, const std::string& puzzleId);
+    CubePuzzle(int rows, int cols, const Vector3f& startPos, float spacing, float cubeSize, const std::string& puzzleId, int scrambleMoves);
     ~CubePuzzle() override;
 
     void update(float deltaTime, GameStateManager& gameStateManager) override;
-    void render() override;
+    void commit(GameStateManager& gameStateManager) override;
+    void collectDrawItems(RenderPacket& packet) override {} // Sem visual próprio: os cubos se desenham
     void onCubeClicked(int row, int col);
     const std::vector<std::vector<RotatingCube*>>& getCubes() const { return _cubes; }
     const std::string& getPuzzleId() const { return _puzzleId; }
+    bool findSolution(std::vector<int>& presses) const;
     BoundingBox getBoundingBox() const override;
 
 private:
+    void applyMove(int row, int col, AnimationSystem* animations);
     void checkSolution(GameStateManager& gameStateManager);
     int _rows, _cols;
     std::vector<std::vector<RotatingCube*>> _cubes;
+    std::vector<std::pair<int, int>> _pendingClicks; // Jogadas aguardando a fase de commit
     std::string _puzzleId;
+    int _unsolvedCount = 0; // Cubos fora do estado 0, mantido a cada jogada
     bool _solved = false;
 };
 
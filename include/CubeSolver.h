@@ -0,0 +1,49 @@
+/**
+ * @file CubeSolver.h
+ * @brief Resolve e gera tabuleiros do quebra-cabeça dos cubos rotativos.
+ *
+ * Cada cubo tem um estado em Z/4 (0°, 90°, 180°, 270°) e uma jogada em (i, j) soma 1
+ * ao cubo e aos seus quatro vizinhos. Como a ordem das jogadas não importa, um
+ * tabuleiro s é resolvido por um vetor de jogadas x com A·x + s ≡ 0 (mod 4), onde A
+ * é a matriz da jogada em "cruz". Z/4 não é um corpo, então o sistema é resolvido
+ * em duas etapas sobre Z/2: primeiro módulo 2 e depois o "bit alto", usando o núcleo
+ * da primeira etapa para corrigir o transporte.
+ *
+ * Os estados são guardados em vetores linha a linha: o cubo (i, j) fica em i * cols + j.
+ */
+#ifndef CUBESOLVER_H
+#define CUBESOLVER_H
+
+#include <vector>
+
+namespace CubeSolver {
+    /**
+     * @brief Aplica uma jogada (o cubo e os vizinhos giram 90°) a um tabuleiro.
+     * @param state O tabuleiro, alterado no lugar.
+     */
+    void applyMove(std::vector<int>& state, int rows, int cols, int row, int col);
+
+    /**
+     * @brief Encontra um conjunto de jogadas que leva o tabuleiro ao estado resolvido (tudo 0).
+     *
+     * @param state O tabuleiro (valores em 0..3).
+     * @param presses Recebe quantas vezes (0..3) cada cubo deve ser clicado.
+     * @return false se o tabuleiro não tiver solução.
+     */
+    bool solve(const std::vector<int>& state, int rows, int cols, std::vector<int>& presses);
+
+    /**
+     * @brief Gera um tabuleiro com solução garantida.
+     *
+     * O tabuleiro resolvido é embaralhado com jogadas aleatórias, então sempre
+     * existe o caminho de volta. Se as jogadas se cancelarem por completo, o
+     * embaralhamento continua até o tabuleiro não estar resolvido.
+     *
+     * @param moves Quantas jogadas aleatórias aplicar (a dificuldade).
+     * @param seed A semente do gerador.
+     * @return O tabuleiro gerado.
+     */
+    std::vector<int> generate(int rows, int cols, int moves, unsigned int seed);
+}
+
+#endif // CUBESOLVER_H
@@ -0,0 +1,63 @@
+/**
+ * @file DebugDraw.h
+ * @brief Define o DebugDraw, a fila de desenho de depuração (linhas, caixas, esferas
+ * e textos) do quadro.
+ *
+ * Qualquer código da simulação pode enfileirar formas; em publishFrame elas vão
+ * para o RenderPacket, e a thread de OpenGL desenha todas as linhas do quadro com
+ * uma única chamada. Os textos entram no lote do HUD (Overlay). Com o desenho
+ * desligado, as chamadas retornam sem fazer nada.
+ */
+#ifndef DEBUGDRAW_H
+#define DEBUGDRAW_H
+
+#include "Vector.h"
+#include "RenderPacket.h"
+#include <atomic>
+#include <string>
+#include <vector>
+
+class Overlay;
+
+class DebugDraw {
+public:
+    static bool isEnabled();
+    static void setEnabled(bool enabled);
+    static void toggle();
+
+    // Formas em coordenadas de mundo. Podem ser chamadas de qualquer thread da simulação.
+    static void line(const Vector3f& a, const Vector3f& b, const Vector3f& color, float alpha = 1.0f);
+    /** @brief As doze arestas de uma caixa. */
+    static void box(const BoundingBox& box, const Vector3f& color, float alpha = 1.0f);
+    /** @brief Três círculos, um em cada plano dos eixos. */
+    static void sphere(const Vector3f& center, float radius, const Vector3f& color, float alpha = 1.0f);
+    /** @brief Um texto centralizado na projeção do ponto. */
+    static void text(const Vector3f& position, const std::string& text, const Vector3f& color);
+
+    /**
+     * @brief Passa o que foi enfileirado desde o último quadro para o pacote e esvazia a fila.
+     * @param packet O pacote sendo montado pela simulação (já limpo).
+     */
+    static void collect(RenderPacket& packet);
+
+    /**
+     * @brief Desenha as linhas do pacote, por cima da cena. Thread de OpenGL, com a
+     * matriz de visão carregada.
+     */
+    static void draw(const RenderPacket& packet);
+
+    /**
+     * @brief Acrescenta os textos do pacote ao HUD, nas posições projetadas na tela.
+     * @param view A matriz de visão do quadro (a projeção vem do OpenGL).
+     */
+    static void addLabels(const RenderPacket& packet, const Matrix4& view, Overlay& overlay);
+
+private:
+    static void push(const Vector3f& p, const Vector3f& color, float alpha);
+
+    static std::atomic<bool> _enabled;
+    static std::vector<DebugVertex> _lines;
+    static std::vector<DebugText> _texts;
+};
+
+#endif // DEBUGDRAW_H
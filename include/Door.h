@@ -18,7 +18,7 @@ public:
     Door(const Vector3f& position, int targetRoomIndex, const Vector3f& spawnPosition, const std::string& requiredPuzzleId);
 
     virtual void update(float deltaTime, GameStateManager& gameStateManager) override;
-    virtual void render() override;
+    virtual void collectDrawItems(RenderPacket& packet) override;
     virtual void onClick(GameStateManager& gameStateManager) override;
     virtual float getCollisionRadius() const override;
     virtual BoundingBox getBoundingBox() const override;
@@ -31,6 +31,23 @@ public:
 
     bool canBeOpenedBy(const GameStateManager& gameStateManager) const;
 
+    /**
+     * @brief Faz a porta funcionar como portal: destrancada, ela some e a sala de
+     * destino é desenhada através da abertura.
+     */
+    void setPortal(bool isPortal);
+    /** @brief Reavalia se o portal está aberto; o SceneManager chama também para as portas de outras salas. */
+    void refreshPortal(const GameStateManager& gameStateManager);
+    /** @brief Se a porta é um portal e já pode ser aberta (atualizado no update ou em refreshPortal). */
+    bool isPortalOpen() const;
+
+    /**
+     * @brief O quadrilátero da abertura da porta, nas coordenadas da sala.
+     * @param corners Recebe os quatro cantos, em volta da abertura.
+     * @param normal Recebe a normal da abertura, apontando para dentro da sala.
+     */
+    void getPortalQuad(Vector3f corners[4], Vector3f& normal) const;
+
 private:
     PrimitiveObject _visual;
     float _collisionRadius;
@@ -38,6 +55,8 @@ private:
     Vector3f _spawnPosition;
     std::vector<ItemType> _requiredItems;
     std::string _requiredPuzzleId;
+    bool _isPortal;
+    bool _isOpen; ///< Portal destrancado; escrito em refreshPortal, lido no collectDrawItems (mesma thread).
 };
 
 #endif // DOOR_H
@@ -0,0 +1,36 @@
+/**
+ * @file DynamicResolution.h
+ * @brief Define o DynamicResolution, o controlador que escolhe a resolução da cena a
+ * partir do tempo de desenho dos quadros.
+ *
+ * A cada Config::DYNAMIC_RESOLUTION_INTERVAL quadros, compara a média do tempo de
+ * desenho com Config::FRAME_BUDGET_MS. O custo de preenchimento é proporcional ao
+ * número de pixels, isto é, ao quadrado da escala, então a nova escala é a atual
+ * vezes a raiz da razão orçamento/tempo. Dentro da folga (DYNAMIC_RESOLUTION_DEADBAND)
+ * nada muda, e cada ajuste é limitado e arredondado em passos de 5%, para que a
+ * resolução não fique oscilando.
+ */
+#ifndef DYNAMICRESOLUTION_H
+#define DYNAMICRESOLUTION_H
+
+class DynamicResolution {
+public:
+    DynamicResolution();
+
+    /**
+     * @brief Registra o tempo de desenho de um quadro.
+     * @param renderMs O tempo, em ms, da cena até o fim do HUD.
+     * @return true se a escala mudou neste quadro.
+     */
+    bool addFrame(float renderMs);
+
+    /** @brief A escala atual, em cada eixo, entre Config::RENDER_SCALE_MIN e 1. */
+    float getScale() const;
+
+private:
+    float _scale;
+    float _accumulatedMs;
+    int _frames;
+};
+
+#endif // DYNAMICRESOLUTION_H
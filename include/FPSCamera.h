@@ -46,6 +46,12 @@ public:
      */
     const Vector3f& getRightVector() const;
 
+    /**
+     * @brief Obtm o vetor que aponta para cima da cmera.
+     * @return Uma referncia constante para o vetor "cima" normalizado.
+     */
+    const Vector3f& getUpVector() const;
+
     /**
      * @brief Aplica a transformao da cmera na pipeline grfica.
      * @note Esta funo deve ser chamada a cada quadro (frame) antes de desenhar os objetos do mundo.
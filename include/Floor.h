@@ -3,18 +3,38 @@
 
 #include "GameObject.h"
 #include "Vector.h"
+#include "Transform.h"
+#include "LightBaker.h"
+#include <vector>
 
 class Floor : public GameObject {
 public:
     Floor(const Vector3f& position, const Vector2f& size);
 
     virtual void update(float deltaTime, GameStateManager& gameStateManager) override;
-    virtual void render() override;
+    virtual void collectDrawItems(RenderPacket& packet) override;
+    virtual void draw(const DrawItem& item) override;
     virtual BoundingBox getBoundingBox() const override;
 
+    /** @brief Entrega ao LightBaker uma superfície por bloco. */
+    void collectBakeSurfaces(std::vector<BakeSurface>& out);
+    /** @brief A placa do chão, que bloqueia a luz que vem de baixo no LightBaker. */
+    BoundingBox getOccluderBox() const;
+    /** @brief Usa o lightmap calculado com as superfícies de collectBakeSurfaces. */
+    void setLightmap(Lightmap* lightmap);
+
 private:
+    /** @brief A peça da grade visual; as demais peças são os índices dos blocos. */
+    enum { GRID = -1 };
+
     Vector3f _position;
     Vector2f _size;
+    Transform _root;                ///< O chão inteiro; os blocos são filhos dele.
+    std::vector<Transform> _chunks; ///< Blocos de até Config::FLOOR_CHUNK_SIZE de lado.
+    std::vector<int> _chunkLods;    ///< Nível de detalhe de cada bloco no último quadro.
+    Vector2f _chunkSize;
+    Lightmap* _lightmap;
+    int _firstSurface;              ///< A superfície do lightmap do primeiro bloco.
 };
 
 #endif // FLOOR_H
@@ -0,0 +1,75 @@
+/**
+ * @file FramePipeline.h
+ * @brief Define o FramePipeline, a fila limitada de RenderPackets entre a thread de
+ * simulação (produtora) e a thread de OpenGL (consumidora).
+ */
+#ifndef FRAMEPIPELINE_H
+#define FRAMEPIPELINE_H
+
+#include "RenderPacket.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+/**
+ * @class FramePipeline
+ * @brief Anel de pacotes com profundidade configurável.
+ *
+ * A profundidade é quantos quadros prontos podem esperar pela thread de GL.
+ * Com profundidade 1, a simulação do quadro N+1 roda enquanto o quadro N é
+ * desenhado, mas não avança além disso. Os pacotes são reaproveitados, então
+ * não há alocação por quadro depois que os vetores atingem o tamanho da cena.
+ */
+class FramePipeline {
+public:
+    /**
+     * @param depth Número máximo de pacotes prontos aguardando consumo (mínimo 1).
+     */
+    explicit FramePipeline(int depth);
+
+    /**
+     * @brief Obtém um pacote livre para a simulação preencher.
+     *
+     * @param block Se true, espera enquanto a fila estiver cheia. Se false, descarta
+     * o pacote pronto mais antigo para abrir espaço.
+     * @return O pacote a preencher, ou nullptr se o pipeline foi fechado.
+     */
+    RenderPacket* beginWrite(bool block);
+
+    /** @brief Publica o pacote obtido em beginWrite. */
+    void endWrite();
+
+    /** @brief Devolve sem publicar o pacote obtido em beginWrite (o quadro não mudou). */
+    void cancelWrite();
+
+    /**
+     * @brief Obtém o próximo pacote a desenhar, sem bloquear.
+     *
+     * Se houver um pacote pronto, o pacote lido anteriormente é devolvido à
+     * simulação e o novo passa a ser o atual. Caso contrário, o atual é mantido,
+     * o que permite redesenhar a janela (por exemplo, após ser descoberta).
+     *
+     * @return O pacote atual, ou nullptr se nenhum quadro foi publicado ainda.
+     */
+    const RenderPacket* acquireFrame();
+
+    /** @brief Indica se há algum pacote pronto aguardando consumo. */
+    bool hasReadyFrame();
+
+    /** @brief Acorda e libera a produtora; chamadas futuras de beginWrite retornam nullptr. */
+    void close();
+
+private:
+    int _depth;
+    std::vector<RenderPacket> _packets;
+    std::deque<int> _free;
+    std::deque<int> _ready;
+    int _writing;
+    int _reading;
+    bool _closed;
+    std::mutex _mutex;
+    std::condition_variable _spaceAvailable;
+};
+
+#endif // FRAMEPIPELINE_H
@@ -0,0 +1,55 @@
+/**
+ * @file FrameTimer.h
+ * @brief Define o FrameTimer, que mede o tempo de desenho dos quadros sem parar a
+ * CPU esperando a GPU.
+ *
+ * Com timer queries, cada quadro fica entre um glBeginQuery/glEndQuery de
+ * GL_TIME_ELAPSED. As queries formam um anel de QUERY_COUNT posições e o resultado
+ * só é lido quando o OpenGL avisa que já está pronto, em geral um ou dois quadros
+ * depois; se o anel encher, o quadro fica sem medida em vez de esperar.
+ *
+ * Sem timer queries, a medida é o tempo de CPU de begin até poll, chamado depois
+ * da troca de buffers: quando a GPU fica para trás, é a troca que espera por ela.
+ *
+ * A mesma medida alimenta a resolução dinâmica e o QualityGovernor. Thread de OpenGL.
+ */
+#ifndef FRAMETIMER_H
+#define FRAMETIMER_H
+
+#include <GL/glut.h>
+#include <chrono>
+
+class FrameTimer {
+public:
+    FrameTimer();
+
+    FrameTimer(const FrameTimer&) = delete;
+    FrameTimer& operator=(const FrameTimer&) = delete;
+
+    /** @brief Marca o início do quadro. Na primeira chamada, cria as queries. */
+    void begin();
+
+    /** @brief Marca o fim do desenho do quadro, antes da troca de buffers. */
+    void end();
+
+    /**
+     * @brief Lê a medida mais antiga que já estiver pronta, sem bloquear.
+     * @param frameMs Recebe o tempo do quadro medido, em ms.
+     * @return false se nenhuma medida nova estiver pronta.
+     */
+    bool poll(float& frameMs);
+
+private:
+    static const int QUERY_COUNT = 4;
+
+    GLuint _queries[QUERY_COUNT];
+    bool _pending[QUERY_COUNT];  ///< A query foi encerrada e o resultado ainda não foi lido.
+    int _write;                  ///< A próxima query a ser usada.
+    int _read;                   ///< A query mais antiga ainda não lida.
+    bool _initialized;
+    bool _useQueries;
+    bool _measuring;             ///< begin abriu uma query (ou marcou o tempo) neste quadro.
+    std::chrono::steady_clock::time_point _cpuStart;
+};
+
+#endif // FRAMETIMER_H
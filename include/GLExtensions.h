@@ -0,0 +1,145 @@
+/**
+ * @file GLExtensions.h
+ * @brief Carrega as funções de OpenGL posteriores à 1.1 usadas pelo jogo.
+ *
+ * A biblioteca do OpenGL do Windows só exporta a versão 1.1; o resto precisa ser
+ * buscado em tempo de execução (glutGetProcAddress): multitextura, framebuffer
+ * objects, shaders e timer queries. Quem usa um recurso deve consultar se ele está disponível e
+ * ter um caminho alternativo.
+ */
+#ifndef GLEXTENSIONS_H
+#define GLEXTENSIONS_H
+
+#include <GL/glut.h>
+#include <cstdint>
+
+#ifndef GL_TEXTURE0
+#define GL_TEXTURE0 0x84C0
+#endif
+#ifndef GL_TEXTURE1
+#define GL_TEXTURE1 0x84C1
+#endif
+#ifndef GL_CLAMP_TO_EDGE
+#define GL_CLAMP_TO_EDGE 0x812F
+#endif
+#ifndef GL_TEXTURE_BASE_LEVEL
+#define GL_TEXTURE_BASE_LEVEL 0x813C
+#endif
+
+// Framebuffer objects (OpenGL 3.0 / EXT_framebuffer_object, com EXT_packed_depth_stencil).
+#ifndef GL_FRAMEBUFFER
+#define GL_FRAMEBUFFER 0x8D40
+#endif
+#ifndef GL_RENDERBUFFER
+#define GL_RENDERBUFFER 0x8D41
+#endif
+#ifndef GL_COLOR_ATTACHMENT0
+#define GL_COLOR_ATTACHMENT0 0x8CE0
+#endif
+#ifndef GL_DEPTH_ATTACHMENT
+#define GL_DEPTH_ATTACHMENT 0x8D00
+#endif
+#ifndef GL_STENCIL_ATTACHMENT
+#define GL_STENCIL_ATTACHMENT 0x8D20
+#endif
+#ifndef GL_DEPTH24_STENCIL8
+#define GL_DEPTH24_STENCIL8 0x88F0
+#endif
+#ifndef GL_FRAMEBUFFER_COMPLETE
+#define GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#endif
+#ifndef GL_FRAMEBUFFER_BINDING
+#define GL_FRAMEBUFFER_BINDING 0x8CA6
+#endif
+#ifndef GL_DEPTH_COMPONENT24
+#define GL_DEPTH_COMPONENT24 0x81A6
+#endif
+
+// Shaders (OpenGL 2.0).
+#ifndef GL_FRAGMENT_SHADER
+#define GL_FRAGMENT_SHADER 0x8B30
+#endif
+#ifndef GL_VERTEX_SHADER
+#define GL_VERTEX_SHADER 0x8B31
+#endif
+#ifndef GL_COMPILE_STATUS
+#define GL_COMPILE_STATUS 0x8B81
+#endif
+#ifndef GL_LINK_STATUS
+#define GL_LINK_STATUS 0x8B82
+#endif
+
+// --- Timer queries ---
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED 0x88BF
+#endif
+#ifndef GL_QUERY_RESULT
+#define GL_QUERY_RESULT 0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#endif
+
+/**
+ * @class GLExtensions
+ * @brief Ponteiros para as funções opcionais do OpenGL. Thread de OpenGL.
+ */
+class GLExtensions {
+public:
+    /** @brief Busca as funções. Exige o contexto de OpenGL já criado. */
+    static void init();
+
+    /** @brief Multitextura (OpenGL 1.3 / ARB_multitexture), com pelo menos duas unidades. */
+    static bool hasMultitexture();
+
+    /** @brief Framebuffer objects com depth + stencil num único renderbuffer. */
+    static bool hasFramebuffers();
+
+    /** @brief Shaders GLSL (OpenGL 2.0). */
+    static bool hasShaders();
+
+    /** @brief Timer queries (OpenGL 3.3 / ARB_timer_query / EXT_timer_query). */
+    static bool hasTimerQueries();
+
+    /** @brief glActiveTexture. */
+    static void activeTexture(GLenum unit);
+    /** @brief glMultiTexCoord2f. */
+    static void multiTexCoord2f(GLenum unit, float s, float t);
+
+    // --- Framebuffer objects (só com hasFramebuffers) ---
+    static void genFramebuffers(GLsizei count, GLuint* ids);
+    static void deleteFramebuffers(GLsizei count, const GLuint* ids);
+    static void bindFramebuffer(GLenum target, GLuint framebuffer);
+    static void framebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+    static GLenum checkFramebufferStatus(GLenum target);
+    static void genRenderbuffers(GLsizei count, GLuint* ids);
+    static void deleteRenderbuffers(GLsizei count, const GLuint* ids);
+    static void bindRenderbuffer(GLenum target, GLuint renderbuffer);
+    static void renderbufferStorage(GLenum target, GLenum format, GLsizei width, GLsizei height);
+    static void framebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbufferTarget, GLuint renderbuffer);
+
+    // --- Shaders (só com hasShaders) ---
+
+    /**
+     * @brief Compila e liga um programa com um vertex e um fragment shader.
+     * @param name Nome usado nas mensagens de erro.
+     * @return O programa, ou 0 se a compilação ou a ligação falhar (o log vai para std::cerr).
+     */
+    static GLuint buildProgram(const char* name, const char* vertexSource, const char* fragmentSource);
+    static void deleteProgram(GLuint program);
+    static void useProgram(GLuint program);
+    static GLint getUniformLocation(GLuint program, const char* name);
+    static void uniform1i(GLint location, GLint value);
+    static void uniform1f(GLint location, GLfloat value);
+    static void uniform2f(GLint location, GLfloat x, GLfloat y);
+
+    // --- Timer queries (só com hasTimerQueries) ---
+    static void genQueries(GLsizei count, GLuint* ids);
+    static void deleteQueries(GLsizei count, const GLuint* ids);
+    static void beginQuery(GLenum target, GLuint id);
+    static void endQuery(GLenum target);
+    static void getQueryObjectiv(GLuint id, GLenum name, GLint* value);
+    static void getQueryObjectui64v(GLuint id, GLenum name, uint64_t* value);
+};
+
+#endif // GLEXTENSIONS_H
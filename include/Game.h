@@ -5,6 +5,21 @@
 #include "LightManager.h"
 #include "SceneManager.h"
 #include "GameStateManager.h"
+#include "FramePipeline.h"
+#include "Overlay.h"
+#include "PostProcess.h"
+#include "DynamicResolution.h"
+#include "FrameTimer.h"
+#include "TimerWheel.h"
+#include "AnimationSystem.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 /**
  * @file Game.h
@@ -25,37 +40,142 @@ public:
      */
     Game();
 
+    /**
+     * @brief Destrutor. Encerra a thread de simulao, se estiver rodando.
+     */
+    ~Game();
+
     /**
      * @brief Inicializa o jogo, configurando o OpenGL e todos os sistemas.
+     *
+     * Se Config::RENDER_PIPELINE_DEPTH for maior que zero, inicia tambm a
+     * thread de simulao.
+     *
+     * @return false se as regras dos puzzles (Config::RULES_FILE) no puderam ser
+     * carregadas.
+     */
+    bool init();
+
+    /**
+     * @brief Encerra a thread de simulao e, depois dela, as trabalhadoras do JobSystem.
+     *
+     * Chamado pelo main ao fechar a janela e no atexit, antes dos destrutores
+     * estticos (cuja ordem entre arquivos no  definida). Pode ser chamado mais de uma vez.
      */
-    void init();
+    void shutdown();
 
     /**
      * @brief Atualiza a lgica do jogo a cada frame.
+     * @note Roda na thread de simulao e no pode fazer chamadas de OpenGL.
      * @param deltaTime O tempo (em ms) desde o ltimo frame.
      */
     void update(float deltaTime);
 
     /**
-     * @brief Renderiza a cena do jogo.
+     * @brief Chamado pelo temporizador do GLUT, na thread de OpenGL.
+     *
+     * Sem a thread de simulao, atualiza e publica o quadro aqui mesmo.
+     * Em ambos os casos, pede um redesenho quando h quadro novo e trata
+     * o pedido de sada.
+     *
+     * @param deltaTime O tempo (em ms) desde a ltima chamada.
+     */
+    void tick(float deltaTime);
+
+    /**
+     * @brief Em quantos ms o temporizador do GLUT deve chamar tick de novo:
+     * Config::IDLE_POLL_MS enquanto o jogo estiver ocioso, seno o passo da simulao.
+     */
+    int getTickInterval() const;
+
+    /**
+     * @brief Define a funo chamada (na thread do GLUT) quando uma entrada chega com o
+     * jogo ocioso, para antecipar o prximo tick.
+     */
+    void setWakeCallback(std::function<void()> onWake);
+
+    /**
+     * @brief Renderiza o ltimo quadro publicado pela simulao.
      */
     void render();
 
     // --- Processamento de Entrada ---
+    // Chamados pelos callbacks do GLUT; apenas enfileiram o evento para a simulao.
     void processKeyDown(unsigned char key, int x, int y);
     void processKeyUp(unsigned char key, int x, int y);
     void processMouseMotion(int x, int y);
 
 private:
+    /**
+     * @brief Um evento de entrada aguardando a simulao.
+     */
+    struct InputEvent {
+        enum Type { KEY_DOWN, KEY_UP, MOUSE_MOTION };
+        Type type;
+        unsigned char key;
+        int x, y;
+    };
+
+    /**
+     * @brief Esferas dos interagveis, separadas por componente para o
+     * VectorMath::raySphereBatch. Reaproveitada a cada clique.
+     */
+    struct InteractionBatch {
+        std::vector<InteractableObject*> candidates;
+        std::vector<float> centerX, centerY, centerZ, radius;
+        std::vector<float> hitDistances;
+    };
+
     void processInteraction();
+    void handleKeyDown(unsigned char key);
+    void pushInput(const InputEvent& event);
+    void drainInput();
+    bool publishFrame(bool block);
+    void updateIdle(bool published);
+    void waitForInput(std::chrono::steady_clock::time_point deadline);
+    void queueDebugShapes();
+    void drawItems(const RenderPacket& packet, const Matrix4& view, size_t first, size_t count);
+    void drawDepthPrepass(const RenderPacket& packet, const Matrix4& view);
+    void drawPortals(const RenderPacket& packet, const Matrix4& view, int parent, int stencil);
+    void setPortalScissor(const PortalView& portal);
+    void drawHud(const RenderPacket& packet);
+    void registerQualityKnobs();
+    void simulationLoop();
+    void stopSimulation();
 
     // --- Membros do Jogo ---
     Player       _player;
     LightManager _lightManager;
+    Overlay      _overlay; ///< HUD, usado s pela thread de OpenGL.
+    PostProcess  _postProcess; ///< Bloom e FXAA da cena, tambm s da thread de OpenGL.
+    DynamicResolution _resolution; ///< Escolhe a escala da cena a partir do tempo de desenho.
+    FrameTimer   _frameTimer; ///< Mede o tempo de desenho sem glFinish (thread de OpenGL).
+    AnimationSystem _animations; ///< Declarado antes da cena: os objetos cancelam as suas transies ao serem destrudos.
     SceneManager _sceneManager;
     GameStateManager _gameStateManager;
     GameState    _currentState;
-    GameStateManager _gsm;
+    TimerWheel   _timers; ///< Avana s em PLAYING, ento fica pausada fora do jogo.
+
+    // --- Pipeline Simulao/Renderizao ---
+    FramePipeline _pipeline;
+    std::thread _simulationThread;
+    std::atomic<bool> _running;        ///< Mantm o lao da thread de simulao ativo.
+    std::atomic<bool> _quitRequested;  ///< Pedido de sada, atendido na thread do GLUT.
+    std::mutex _inputMutex;
+    std::vector<InputEvent> _pendingInput; ///< Eventos enfileirados pelos callbacks do GLUT.
+    std::vector<InputEvent> _inputBatch;   ///< Eventos sendo processados pela simulao.
+    unsigned long _frameIndex;
+    InteractionBatch _interaction; ///< Usado s pela simulao, em processInteraction.
+
+    // --- Renderizao sob demanda (Config::RENDER_ON_DEMAND) ---
+    std::condition_variable _inputArrived; ///< Acorda a simulao ociosa.
+    std::function<void()> _onWake;
+    std::atomic<bool> _idle;       ///< Nada mudou h IDLE_STEPS_BEFORE_SLEEP passos.
+    bool _sceneChanged;            ///< Entrada, animao ou timer desde o ltimo quadro publicado.
+    uint64_t _publishedSignature;  ///< RenderPacket::signature do ltimo quadro publicado.
+    uint64_t _timersFired;         ///< TimerWheel::getFiredCount no ltimo passo.
+    int _idleSteps;
+    float _tickBacklog;            ///< Tempo ainda no simulado no modo sem thread, em ms.
 };
 
 #endif // GAME_H
@@ -24,6 +24,15 @@ namespace PuzzleID {
     const std::string Sala2_FormasEncaixadas = "S2_FormasEncaixadas";
     const std::string Sala3_SequenciaBotoes = "S3_SequenciaBotoes";
     const std::string Sala_Cubos = "S_Cubos";
+
+    // Travas de portas, abertas pelas regras em res/rules/puzzles.txt
+    const std::string Porta_Sala3 = "Porta_Sala3";
+    const std::string Porta_Final = "Porta_Final";
+}
+
+// Canais de entrada declarados no arquivo de regras
+namespace InputChannel {
+    const std::string Keypad = "keypad";
 }
 
 #endif // GAMEDATA_H
@@ -2,16 +2,48 @@
 #define GAMEOBJECT_H
 
 #include "Vector.h"
+#include "RenderPacket.h"
 
 class GameStateManager;
+struct RigidBody;
 
 class GameObject {
 public:
     virtual ~GameObject() {}
 
+    /**
+     * @brief Atualiza o próprio estado. Pode rodar em paralelo com outros objetos da sala,
+     * então só deve alterar o próprio objeto e apenas ler o GameStateManager.
+     */
     virtual void update(float deltaTime, GameStateManager& gameStateManager) = 0;
-    virtual void render() = 0;
+
+    /**
+     * @brief Fase serial executada após o update de todos os objetos da sala.
+     * Efeitos que alteram outros objetos ou o GameStateManager devem ficar aqui.
+     */
+    virtual void commit(GameStateManager& gameStateManager) {}
+
+    /**
+     * @brief Registra no pacote do quadro o que for preciso para desenhar o objeto.
+     * Roda na thread de simulação. Todo estado do visual que muda depois da construção
+     * (cor, visibilidade, posição, nível de detalhe) é copiado para os itens aqui.
+     */
+    virtual void collectDrawItems(RenderPacket& packet) = 0;
+
+    /**
+     * @brief Desenha um item do pacote. Roda na thread de OpenGL, em paralelo com a
+     * simulação, então só pode ler o item e dados que não mudam após a construção.
+     * Objetos que só registram itens de outros (o seu visual) não a sobrescrevem.
+     */
+    virtual void draw(const DrawItem& item) {}
+
     virtual BoundingBox getBoundingBox() const = 0;
+
+    /**
+     * @brief Corpo rígido do objeto, se ele participar da física da sala.
+     * A sala registra o corpo no seu PhysicsWorld ao receber o objeto.
+     */
+    virtual RigidBody* getRigidBody() { return nullptr; }
 };
 
 #endif // GAMEOBJECT_H
@@ -7,17 +7,26 @@
 #include "GameData.h"
 #include "Vector.h"
 #include "SceneManager.h"
+#include "RuleEngine.h"
+#include "TimerWheel.h"
+#include "AnimationSystem.h"
 class SceneManager;
 class Player;
 
 class GameStateManager {
 public:
     GameStateManager();
+    bool loadRules(const std::string& path);
+    void setTimerWheel(TimerWheel* timers);
+    TimerWheel* getTimerWheel() const;
+    void setAnimationSystem(AnimationSystem* animations);
+    AnimationSystem* getAnimationSystem() const;
     void setPuzzleState(const std::string& puzzleId, bool isSolved);
     bool isPuzzleSolved(const std::string& puzzleId) const;
     void addItemToInventory(ItemType item);
     bool playerHasItem(ItemType item) const;
     void removeItemFromInventory(ItemType item);
+    const std::vector<ItemType>& getInventory() const;
     void cycleFlashlightColor();
     Vector3f getCurrentFlashlightColor();
     void appendToKeypadInput(char digit);
@@ -25,6 +34,8 @@ public:
     std::string getKeypadInput();
     void setActiveKeypad(bool isActive);
     bool isKeypadActive() const;
+    void appendToInput(const std::string& channel, char symbol);
+    std::string getInput(const std::string& channel) const;
 
 private:
     std::map<std::string, bool> _puzzleStates;
@@ -32,6 +43,13 @@ private:
     int _currentFlashlightColorIndex;
     std::string _keypadInput;
     bool _isKeypadActive;
+    std::map<std::string, std::string> _inputs;
+    RuleEngine _rules;
+    TimerWheel* _timers;
+    AnimationSystem* _animations;
+    std::map<std::string, TimerWheel::TimerId> _inputTimeouts;
+
+    bool pushInputSymbol(const std::string& channel, std::string& buffer, char symbol);
 };
 
 #endif // GAMESTATEMANAGER_H
@@ -0,0 +1,35 @@
+/**
+ * @file Hash.h
+ * @brief Define o fnv1a, o hash FNV-1a de 64 bits usado nas chaves dos caches
+ * em disco e no resumo do pacote do quadro.
+ */
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstddef>
+#include <cstdint>
+
+/** @brief Valor inicial do FNV-1a de 64 bits. */
+const uint64_t FNV1A_OFFSET = 14695981039346656037ull;
+
+/**
+ * @brief Acumula bytes num hash FNV-1a de 64 bits.
+ *
+ * Para hashear vários blocos em sequência, passe o resultado de uma chamada
+ * como `seed` da seguinte.
+ *
+ * @param data Os bytes.
+ * @param size O número de bytes.
+ * @param seed O hash acumulado até aqui.
+ * @return O hash com os bytes acumulados.
+ */
+inline uint64_t fnv1a(const void* data, size_t size, uint64_t seed = FNV1A_OFFSET) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        seed ^= bytes[i];
+        seed *= 1099511628211ull;
+    }
+    return seed;
+}
+
+#endif // HASH_H
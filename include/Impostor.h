@@ -0,0 +1,69 @@
+/**
+ * @file Impostor.h
+ * @brief Define o Impostor, uma foto de um objeto guardada numa textura e desenhada
+ * como um único quadrilátero quando o objeto está longe.
+ *
+ * A foto é tirada de frente, em projeção ortográfica, num framebuffer object, uma
+ * única vez: na primeira vez que o impostor é desenhado. De longe, o objeto registra
+ * um único item no pacote, e o custo do desenho deixa de depender de quantas peças
+ * ele tem.
+ *
+ * Por isso o conteúdo do objeto precisa ser fixo (as cores e o texto das placas e
+ * das portas de puzzle são definidos no construtor); só a posição pode mudar.
+ *
+ * Feito para objetos achatados e sem iluminação (placas, portas), vistos de frente:
+ * o quadrilátero fica no plano da frente do objeto (+Z local). Sem framebuffer
+ * objects, select() sempre retorna false e o objeto continua inteiro.
+ */
+#ifndef IMPOSTOR_H
+#define IMPOSTOR_H
+
+#include "Vector.h"
+#include "VectorMath.h"
+#include <GL/glut.h>
+#include <atomic>
+#include <functional>
+
+class Impostor {
+public:
+    /**
+     * @brief Desenha o objeto inteiro em coordenadas locais. Cada peça carrega
+     * `view` * (matriz local da peça) antes de se desenhar.
+     */
+    using DrawFunction = std::function<void(const Matrix4& view)>;
+
+    /** @param localBounds A caixa do objeto nas suas coordenadas locais (a frente é +Z). */
+    explicit Impostor(const BoundingBox& localBounds);
+
+    Impostor(const Impostor&) = delete;
+    Impostor& operator=(const Impostor&) = delete;
+
+    /**
+     * @brief Decide se o objeto é desenhado como impostor neste quadro, com histerese
+     * em volta de Config::IMPOSTOR_DISTANCE. Thread de simulação.
+     * @param eye A posição da câmera.
+     * @param center O centro do objeto, nas mesmas coordenadas.
+     */
+    bool select(const Vector3f& eye, const Vector3f& center);
+
+    /**
+     * @brief Desenha o quadrilátero, tirando a foto antes se preciso. Thread de OpenGL,
+     * com a matriz de modelo-visão do objeto carregada.
+     *
+     * Se a foto não puder ser tirada, desenha o objeto inteiro com `drawFull`.
+     */
+    void draw(const DrawFunction& drawFull);
+
+private:
+    bool capture(const DrawFunction& drawFull);
+    void drawQuad() const;
+
+    BoundingBox _bounds;
+    GLuint _texture;                   ///< A foto (thread de OpenGL).
+    int _width, _height;
+    bool _captured;                    ///< A foto já foi tirada (thread de OpenGL).
+    std::atomic<bool> _failed;         ///< A foto não pôde ser tirada: o objeto fica sempre inteiro.
+    bool _selected;                    ///< A escolha do quadro anterior, para a histerese (simulação).
+};
+
+#endif // IMPOSTOR_H
@@ -0,0 +1,129 @@
+/**
+ * @file JobSystem.h
+ * @brief Define o JobSystem, um pool de threads com roubo de tarefas (work stealing),
+ * e o TaskGraph, que executa tarefas respeitando dependências entre elas.
+ *
+ * Cada thread trabalhadora possui sua própria fila. Ela consome tarefas do fim da
+ * própria fila e, quando fica ociosa, "rouba" tarefas do início da fila das outras.
+ * Quem espera por um conjunto de tarefas (JobSystem::wait) também ajuda a executá-las,
+ * então a thread principal nunca fica parada enquanto há trabalho pendente.
+ */
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @struct JobCounter
+ * @brief Contador de tarefas pendentes, usado para esperar um grupo de tarefas terminar.
+ */
+struct JobCounter {
+    std::atomic<int> pending;
+    JobCounter() : pending(0) {}
+};
+
+/**
+ * @class JobSystem
+ * @brief Pool global de threads trabalhadoras com filas de roubo de tarefas.
+ *
+ * Se o sistema não for inicializado (ou for inicializado com zero trabalhadoras),
+ * todas as chamadas executam de forma serial na thread que as fez.
+ */
+class JobSystem {
+public:
+    typedef std::function<void()> Job;
+    typedef std::function<void(size_t begin, size_t end)> RangeJob;
+
+    /**
+     * @brief Cria as threads trabalhadoras.
+     * @param workerCount Número de trabalhadoras. 0 usa (núcleos - 1).
+     */
+    static void init(unsigned int workerCount);
+
+    /**
+     * @brief Encerra e aguarda todas as threads trabalhadoras.
+     */
+    static void shutdown();
+
+    /**
+     * @brief Obtém o número de threads trabalhadoras ativas.
+     */
+    static unsigned int getWorkerCount();
+
+    /**
+     * @brief Enfileira uma tarefa.
+     * @param job A função a ser executada.
+     * @param counter Contador incrementado agora e decrementado quando a tarefa terminar (pode ser nulo).
+     */
+    static void submit(const Job& job, JobCounter* counter);
+
+    /**
+     * @brief Bloqueia até o contador chegar a zero, executando tarefas enquanto espera.
+     */
+    static void wait(JobCounter& counter);
+
+    /**
+     * @brief Divide o intervalo [0, count) em blocos e os executa em paralelo.
+     *
+     * Blocos menores que minBatch não são criados; se count <= minBatch,
+     * o corpo é executado direto na thread chamadora.
+     *
+     * @param count Número total de elementos.
+     * @param minBatch Tamanho mínimo de cada bloco.
+     * @param body Função chamada com o intervalo [begin, end) de cada bloco.
+     */
+    static void parallelFor(size_t count, size_t minBatch, const RangeJob& body);
+};
+
+/**
+ * @class TaskGraph
+ * @brief Grafo de tarefas: cada tarefa só começa quando todas as suas dependências terminaram.
+ *
+ * O grafo pode ser executado várias vezes (por exemplo, uma vez por quadro).
+ */
+class TaskGraph {
+public:
+    typedef int TaskId;
+
+    /**
+     * @brief Adiciona uma tarefa ao grafo.
+     * @return O identificador da tarefa, usado em addDependency.
+     */
+    TaskId addTask(const JobSystem::Job& job);
+
+    /**
+     * @brief Declara que `after` só pode começar depois que `before` terminar.
+     * @return false (e nada muda) se algum identificador for inválido ou se a
+     * dependência fechar um ciclo, que deixaria as tarefas do ciclo sem começar nunca.
+     */
+    bool addDependency(TaskId before, TaskId after);
+
+    /**
+     * @brief Executa todas as tarefas e bloqueia até o fim.
+     */
+    void run();
+
+    /**
+     * @brief Remove todas as tarefas e dependências.
+     */
+    void clear();
+
+private:
+    struct Node {
+        JobSystem::Job job;
+        std::vector<TaskId> successors;
+        int predecessorCount;
+    };
+
+    void launch(TaskId id, JobCounter& counter);
+    bool reaches(TaskId from, TaskId to) const;
+
+    std::vector<Node> _nodes;
+    std::unique_ptr<std::atomic<int>[]> _remaining; ///< Dependências ainda não concluídas de cada tarefa.
+};
+
+#endif // JOBSYSTEM_H
@@ -16,7 +16,7 @@ public:
         const Vector3f& scale = {0.4f, 0.4f, 0.4f});
 
     virtual void update(float deltaTime, GameStateManager& gameStateManager) override;
-    virtual void render() override;
+    virtual void collectDrawItems(RenderPacket& packet) override;
     virtual void onClick(GameStateManager& gameStateManager) override;
     virtual float getCollisionRadius() const override;
     virtual BoundingBox getBoundingBox() const override;
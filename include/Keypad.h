@@ -2,17 +2,21 @@
 #define KEYPAD_H
 
 #include "InteractableObject.h"
+#include "PrimitiveObject.h"
 
 class Keypad : public InteractableObject {
 public:
     Keypad(const Vector3f& position);
 
     virtual void update(float deltaTime, GameStateManager& gameStateManager) override;
-    virtual void render() override;
+    virtual void collectDrawItems(RenderPacket& packet) override;
     virtual void onClick(GameStateManager& gameStateManager) override;
     virtual float getCollisionRadius() const override;
 
     virtual BoundingBox getBoundingBox() const override;
+
+private:
+    PrimitiveObject _visual;
 };
 
 #endif // KEYPAD_H
@@ -0,0 +1,67 @@
+/**
+ * @file LightBaker.h
+ * @brief Define o LightBaker, que calcula na CPU a iluminação estática de uma sala
+ * (oclusão de ambiente e luzes fixas) e a grava num Lightmap.
+ */
+#ifndef LIGHTBAKER_H
+#define LIGHTBAKER_H
+
+#include "Vector.h"
+#include "Lightmap.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Uma superfície estática: o paralelogramo origin + s·axisU + t·axisV, com s, t em [0, 1].
+ */
+struct BakeSurface {
+    Vector3f origin;
+    Vector3f axisU;
+    Vector3f axisV;
+    Vector3f normal;
+    Vector3f albedo;  ///< Multiplica a luz calculada (branco se o material vier de uma textura).
+    bool hidden;      ///< Face que nunca aparece (voltada para dentro de uma parede): não recebe texels.
+};
+
+/**
+ * @brief Uma luz pontual fixa, somada ao lightmap.
+ */
+struct BakedLight {
+    Vector3f position;
+    Vector3f color;
+    float radius;     ///< Distância em que a luz chega a zero.
+};
+
+/**
+ * @class LightBaker
+ * @brief Calcula lightmaps, com as superfícies divididas entre as threads do JobSystem.
+ */
+class LightBaker {
+public:
+    /**
+     * @brief Monta o lightmap de um conjunto de superfícies.
+     *
+     * Se o cache existir e tiver sido calculado para as mesmas superfícies, oclusores,
+     * luzes e parâmetros, ele é lido; senão o lightmap é calculado e gravado.
+     *
+     * @param surfaces As superfícies; o índice de cada uma é o usado em Lightmap::getRect.
+     * @param occluders Caixas que bloqueiam a luz.
+     * @param lights As luzes fixas.
+     * @param cacheFile O arquivo do cache.
+     * @param out Recebe o lightmap.
+     */
+    static void bake(const std::vector<BakeSurface>& surfaces, const std::vector<BoundingBox>& occluders,
+                     const std::vector<BakedLight>& lights, const std::string& cacheFile, Lightmap& out);
+
+private:
+    static bool layout(const std::vector<BakeSurface>& surfaces, Lightmap& out, std::vector<int>& placement);
+    static void bakeSurface(const BakeSurface& surface, const std::vector<BoundingBox>& occluders,
+                            const std::vector<BakedLight>& lights, int x, int y, int width, int height, Lightmap& out);
+    static uint64_t cacheKey(const std::vector<BakeSurface>& surfaces, const std::vector<BoundingBox>& occluders,
+                             const std::vector<BakedLight>& lights);
+    static bool load(const std::string& path, uint64_t key, Lightmap& out);
+    static void save(const std::string& path, uint64_t key, const Lightmap& lightmap);
+};
+
+#endif // LIGHTBAKER_H
@@ -0,0 +1,75 @@
+/**
+ * @file Lightmap.h
+ * @brief Define o Lightmap, a textura com a iluminação pré-calculada de uma sala.
+ *
+ * Cada superfície estática (um quadrilátero de parede, um bloco do chão) recebe um
+ * retângulo da textura com a luz ambiente (já com a oclusão) e a das luzes fixas.
+ * Na hora de desenhar, a unidade de textura 0 soma o lightmap à iluminação do
+ * OpenGL, que fica só com a lanterna, e a unidade 1 multiplica o resultado pelo
+ * material: cor = material · (lanterna + lightmap).
+ */
+#ifndef LIGHTMAP_H
+#define LIGHTMAP_H
+
+#include <cstdint>
+#include <vector>
+#include <GL/glut.h>
+
+/**
+ * @brief A área de uma superfície no lightmap, em coordenadas de textura.
+ *
+ * O canto (u0, v0) corresponde à origem da superfície e (u1, v1) ao canto oposto.
+ */
+struct LightmapRect {
+    float u0, v0, u1, v1;
+};
+
+class Lightmap {
+public:
+    Lightmap();
+
+    bool isEmpty() const;
+    int getWidth() const;
+    int getHeight() const;
+
+    /**
+     * @brief A área de uma superfície, pelo índice em que ela foi entregue ao LightBaker.
+     * Superfícies escondidas recebem a área escura (ver getDarkRect).
+     */
+    const LightmapRect& getRect(int surface) const;
+
+    /** @brief Uma área sem luz, para faces que nunca aparecem. */
+    const LightmapRect& getDarkRect() const;
+
+    /**
+     * @brief Prepara o desenho de geometria com este lightmap.
+     *
+     * Liga o lightmap na unidade 0, zera a luz ambiente global (ela já está no
+     * lightmap) e deixa a unidade 1 ativa, para a textura do material.
+     *
+     * @return false (sem mudar nada) se o lightmap estiver vazio ou não houver multitextura.
+     */
+    bool bind();
+
+    /**
+     * @brief Gera as coordenadas do lightmap a partir da posição (plano XZ centrado na
+     * origem do objeto), para malhas sem coordenadas próprias como os blocos do chão.
+     * Só vale entre bind() e unbind().
+     */
+    static void setPlanarMapping(const LightmapRect& rect, float width, float depth);
+
+    /** @brief Desfaz bind(): desliga as duas unidades e restaura a luz ambiente. */
+    static void unbind();
+
+private:
+    friend class LightBaker;
+
+    int _width;
+    int _height;
+    std::vector<uint8_t> _pixels;        ///< RGB, linha por linha.
+    std::vector<LightmapRect> _rects;    ///< Uma área por superfície.
+    LightmapRect _darkRect;
+    GLuint _texture;
+};
+
+#endif // LIGHTMAP_H
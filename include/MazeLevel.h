@@ -0,0 +1,74 @@
+/**
+ * @file MazeLevel.h
+ * @brief Define o MazeLevel, um labirinto de blocos lido de um arquivo de nível.
+ *
+ * O arquivo tem uma linha por fileira da grade: '1' é parede, '0' é livre, 'S' é
+ * a entrada e 'E' é a saída. Cada célula vira Config::TILE_SIZE unidades de lado
+ * e as paredes têm Config::WALL_HEIGHT de altura. A geometria é dividida por
+ * célula, e só as células do conjunto potencialmente visível (MazeVisibility) da
+ * célula da câmera são desenhadas.
+ */
+#ifndef MAZELEVEL_H
+#define MAZELEVEL_H
+
+#include "GameObject.h"
+#include "MazeVisibility.h"
+#include "StaticBatch.h"
+#include "Vector.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <GL/glut.h>
+
+class MazeLevel : public GameObject {
+public:
+    /**
+     * @param levelFile O arquivo do nível. O PVS fica em cache ao lado dele (mesmo nome, extensão .pvs).
+     * @param textureFile A textura das paredes (entra no atlas de materiais).
+     */
+    MazeLevel(const std::string& levelFile, const std::string& textureFile);
+
+    /** @brief Se o arquivo do nível foi lido. */
+    bool isLoaded() const;
+
+    /** @brief O centro da célula de entrada ('S'), no chão. */
+    Vector3f getStartPosition() const;
+    /** @brief O centro da célula de saída ('E'), no chão. */
+    Vector3f getExitPosition() const;
+
+    /** @brief As caixas de colisão das paredes (fileiras de blocos juntadas). */
+    const std::vector<BoundingBox>& getColliders() const;
+
+    /** @brief A célula livre que contém o ponto, ou -1 (fora da grade ou dentro de uma parede). */
+    int getCellAt(const Vector3f& position) const;
+
+    void update(float deltaTime, GameStateManager& gameStateManager) override {}
+    void collectDrawItems(RenderPacket& packet) override;
+    void draw(const DrawItem& item) override;
+    BoundingBox getBoundingBox() const override;
+
+private:
+    bool readLevel(const std::string& levelFile, std::string& text);
+    void loadVisibility(const std::string& levelFile, const std::string& text);
+    void buildGeometry();
+    void buildColliders();
+    void buildLists();
+    bool isSolid(int column, int row) const;
+    Vector3f getCellCenter(int cell) const;
+    void pushCell(RenderPacket& packet, int cell);
+
+    int _width;
+    int _height;
+    std::vector<uint8_t> _solid; ///< Uma entrada por célula: 1 para paredes.
+    Vector3f _origin;            ///< O canto da célula (0, 0) de menor x e maior z.
+    int _startCell;
+    int _exitCell;
+    int _material;
+    std::vector<std::vector<StaticVertex> > _cellWalls; ///< Faces de parede de cada célula.
+    std::vector<BoundingBox> _colliders;
+    MazeVisibility _visibility;
+    GLuint _lists;               ///< Uma display list por célula, a partir deste número.
+    unsigned int _atlasVersion;  ///< Versão do atlas usada nas display lists.
+};
+
+#endif // MAZELEVEL_H
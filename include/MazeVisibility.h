@@ -0,0 +1,86 @@
+/**
+ * @file MazeVisibility.h
+ * @brief Define o MazeVisibility, o conjunto potencialmente visível (PVS) de um
+ * labirinto de blocos.
+ *
+ * Para cada célula livre do labirinto, guarda quais células (livres ou paredes)
+ * podem ser vistas de algum ponto dentro dela. Como as paredes ocupam a altura
+ * toda, a visibilidade é calculada em 2D, sobre a grade. O resultado é
+ * conservador: pode sobrar célula, mas nenhuma visível fica de fora. O cálculo é
+ * feito uma vez, em paralelo, e o resultado pode ser guardado em disco.
+ */
+#ifndef MAZEVISIBILITY_H
+#define MAZEVISIBILITY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class MazeVisibility
+ * @brief Visibilidade célula a célula de uma grade de blocos.
+ *
+ * As células são numeradas por linha: célula = linha * largura + coluna.
+ */
+class MazeVisibility {
+public:
+    MazeVisibility();
+
+    /**
+     * @brief Calcula a visibilidade de todas as células livres.
+     *
+     * Uma célula é visível de outra se algum segmento entre pontos das duas só
+     * atravessa células livres. Em vez de amostrar segmentos, o cálculo propaga o
+     * conjunto de retas que passa pelas arestas das células (ver traceOctant).
+     * As células de origem são divididas entre as threads do JobSystem.
+     *
+     * @param width Colunas da grade.
+     * @param height Linhas da grade.
+     * @param solid Uma entrada por célula: diferente de zero para paredes.
+     */
+    void build(int width, int height, const std::vector<uint8_t>& solid);
+
+    /**
+     * @brief Lê o resultado de um cálculo anterior.
+     * @param path O arquivo do cache.
+     * @param key A chave do nível atual; um cache com outra chave é ignorado.
+     * @return false se o arquivo não existir, estiver corrompido ou for de outro nível.
+     */
+    bool load(const std::string& path, uint64_t key);
+
+    /** @brief Grava o resultado em disco, com a chave do nível. */
+    bool save(const std::string& path, uint64_t key) const;
+
+    /**
+     * @brief A chave de cache de um nível: um hash do texto do nível e do
+     * formato do cache. Mudar qualquer um dos dois invalida o cache.
+     */
+    static uint64_t cacheKey(const std::string& levelText);
+
+    bool isEmpty() const;
+    int getWidth() const;
+    int getHeight() const;
+
+    /** @brief Se `to` pode ser vista de algum ponto de `from`. */
+    bool isVisible(int from, int to) const;
+
+    /** @brief As células visíveis de `from` (incluindo ela mesma), em ordem crescente. */
+    const std::vector<int>& getVisibleCells(int from) const;
+
+    /** @brief Número total de pares (origem, célula visível). */
+    size_t getVisiblePairCount() const;
+
+private:
+    void buildRow(int from, const std::vector<uint8_t>& solid);
+    void buildLists();
+    void traceOctant(int from, int octant, const std::vector<uint8_t>& solid, uint64_t* row) const;
+
+    int _width;
+    int _height;
+    size_t _wordsPerRow;
+    std::vector<uint64_t> _bits;          ///< Uma linha de bits por célula de origem.
+    std::vector<std::vector<int> > _lists; ///< As mesmas linhas, como listas de células.
+};
+
+#endif // MAZEVISIBILITY_H
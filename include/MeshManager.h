@@ -0,0 +1,75 @@
+/**
+ * @file MeshManager.h
+ * @brief Define o MeshManager, que guarda as malhas procedurais (esfera, cone,
+ * cilindro, toro e plano) em cadeias de níveis de detalhe (LOD).
+ *
+ * Cada malha tem LOD_COUNT versões, da mais detalhada (0) à mais simples. Elas são
+ * compiladas em display lists na primeira vez que são desenhadas e reaproveitadas
+ * por todos os objetos com as mesmas dimensões.
+ *
+ * O nível de cada objeto é escolhido pela simulação em collectDrawItems, pelo raio
+ * projetado na tela (em pixels), e vai para o DrawItem. Uma faixa de histerese em
+ * volta de cada limiar evita que o objeto fique trocando de nível ("popping")
+ * quando a câmera para perto de um limiar.
+ */
+#ifndef MESHMANAGER_H
+#define MESHMANAGER_H
+
+#include "Vector.h"
+#include <atomic>
+#include <map>
+#include <tuple>
+#include <GL/glut.h>
+
+class MeshManager {
+public:
+    static const int LOD_COUNT = 4;
+
+    /**
+     * @brief Escolhe o nível de detalhe de um objeto. Roda na thread de simulação.
+     * @param eye A posição da câmera.
+     * @param center O centro do objeto no mundo.
+     * @param radius O raio de uma esfera que envolve o objeto.
+     * @param previousLod O nível usado no quadro anterior (para a histerese).
+     * @return O nível, de 0 (perto) a LOD_COUNT - 1 (longe).
+     */
+    static int selectLod(const Vector3f& eye, const Vector3f& center, float radius, int previousLod);
+
+    // Desenho das malhas (thread de OpenGL). As malhas seguem as convenções do GLUT.
+    static void drawSphere(float radius, int lod);
+    /** @brief Cone com a base em z = 0 e a ponta em z = height. */
+    static void drawCone(float base, float height, int lod);
+    /** @brief Cilindro fechado, de z = 0 a z = height. */
+    static void drawCylinder(float radius, float height, int lod);
+    /** @brief Toro no plano XY. */
+    static void drawTorus(float innerRadius, float outerRadius, int lod);
+    /** @brief Plano horizontal (normal +Y) centrado na origem, subdividido em quadrados. */
+    static void drawPlane(float width, float depth, int lod);
+
+    static void clear(); // libera todas as display lists
+
+    // Qualidade (ver QualityGovernor).
+    /**
+     * @brief Multiplica os limiares de Config::LOD_SCREEN_RADIUS; acima de 1, os objetos
+     * passam para os níveis mais simples mais perto da câmera. Qualquer thread.
+     */
+    static void setLodBias(float bias);
+    /**
+     * @brief Fração dos segmentos das tabelas de detalhe, em todos os níveis. Mudar o
+     * valor libera as display lists, que são recompiladas no próximo desenho. Thread de OpenGL.
+     */
+    static void setTessellation(float density);
+
+private:
+    enum MeshType { SPHERE, CONE, CYLINDER, TORUS, PLANE };
+    typedef std::tuple<int, float, float, int> MeshKey; // tipo, dimensões, nível
+
+    static GLuint getList(MeshType type, float a, float b, int lod);
+    static void build(MeshType type, float a, float b, int lod);
+
+    static std::map<MeshKey, GLuint> _lists;
+    static std::atomic<float> _lodBias;
+    static float _tessellation;
+};
+
+#endif // MESHMANAGER_H
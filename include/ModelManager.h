@@ -0,0 +1,112 @@
+/**
+ * @file ModelManager.h
+ * @brief Define o ModelManager, que carrega modelos (.obj) de res/models numa thread
+ * própria e guarda uma cópia de cada um, compartilhada por todos os objetos.
+ *
+ * O carregamento não trava o jogo: load() só registra o pedido e devolve um ID, e
+ * o modelo aparece quando estiver pronto. O arquivo é lido e convertido numa malha
+ * indexada, com os triângulos reordenados para aproveitar a cache de vértices da
+ * placa de vídeo; o resultado é gravado num cache binário (.mesh) ao lado do .obj,
+ * e as próximas execuções leem o cache em vez de interpretar o texto.
+ *
+ * A malha vai para a placa de vídeo (uma display list) no primeiro draw, na thread
+ * de OpenGL, e a cópia na memória é descartada.
+ */
+#ifndef MODELMANAGER_H
+#define MODELMANAGER_H
+
+#include "Vector.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <GL/glut.h>
+
+/** @brief Um vértice de modelo. */
+struct ModelVertex {
+    Vector3f position;
+    Vector3f normal;
+    float s, t;
+};
+
+/** @brief Uma malha de triângulos indexada. */
+struct ModelMesh {
+    std::vector<ModelVertex> vertices;
+    std::vector<uint32_t> indices; ///< Três por triângulo.
+    BoundingBox bounds;
+};
+
+class ModelManager {
+public:
+    /**
+     * @brief Pede um modelo. Pode ser chamado de qualquer thread.
+     *
+     * Pedidos do mesmo arquivo recebem o mesmo ID e compartilham a malha.
+     *
+     * @param filename O arquivo .obj.
+     * @return O ID do modelo.
+     */
+    static int load(const std::string& filename);
+
+    /** @brief Se o modelo já foi carregado (false também se o carregamento falhou). */
+    static bool isReady(int model);
+
+    /**
+     * @brief A caixa do modelo, em coordenadas locais.
+     * @return false se o modelo ainda não estiver pronto.
+     */
+    static bool getBounds(int model, BoundingBox& out);
+
+    /**
+     * @brief Desenha o modelo. Thread de OpenGL.
+     * @return false (sem desenhar nada) se o modelo ainda não estiver pronto.
+     */
+    static bool draw(int model);
+
+    /** @brief Libera as display lists e esquece todos os modelos. Thread de OpenGL. */
+    static void clear();
+
+    /**
+     * @brief Interpreta um arquivo .obj (posições, coordenadas de textura, normais e
+     * faces, que são divididas em triângulos). Vértices sem normal recebem a média das
+     * normais das faces que os usam.
+     */
+    static bool parseObj(const std::string& text, ModelMesh& out);
+
+    /**
+     * @brief Reordena os triângulos para a cache de vértices (algoritmo de Forsyth) e
+     * depois os vértices na ordem do primeiro uso.
+     */
+    static void optimize(ModelMesh& mesh);
+
+    /**
+     * @brief Média de vértices transformados por triângulo (ACMR) numa cache FIFO do
+     * tamanho dado: 3 sem reaproveitamento, perto de 0,5 no melhor caso.
+     */
+    static float averageCacheMissRatio(const ModelMesh& mesh, int cacheSize);
+
+private:
+    enum State { QUEUED, READY, FAILED };
+
+    struct Model {
+        std::string filename;
+        std::atomic<int> state; ///< State; escrito pela thread de carregamento.
+        ModelMesh mesh;         ///< Esvaziada depois de ir para a display list.
+        BoundingBox bounds;
+        GLuint list;
+    };
+
+    static void loaderLoop();
+    static void loadModel(Model* model);
+    static void upload(Model* model);
+    static uint64_t cacheKey(const std::string& text);
+    static std::string cachePath(const std::string& filename);
+    static bool loadCache(const std::string& path, uint64_t key, ModelMesh& out);
+    static void saveCache(const std::string& path, uint64_t key, const ModelMesh& mesh);
+
+    static std::unordered_map<std::string, int> _ids; // mapa: arquivo -> ID do modelo
+    static std::vector<Model*> _models;
+};
+
+#endif // MODELMANAGER_H
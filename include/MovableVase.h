@@ -0,0 +1,34 @@
+#ifndef MOVABLEVASE_H
+#define MOVABLEVASE_H
+
+#include "GameObject.h"
+#include "PhysicsWorld.h"
+#include "Transform.h"
+
+/**
+ * @file MovableVase.h
+ * @brief Define a classe MovableVase, um vaso que o jogador pode empurrar.
+ *
+ * A posição do vaso é a do seu corpo rígido, simulado pelo PhysicsWorld da sala.
+ */
+
+class MovableVase : public GameObject {
+public:
+    MovableVase(const Vector3f& position, const Vector3f& color, float height = 0.8f, float radius = 0.3f);
+
+    void update(float deltaTime, GameStateManager& gameStateManager) override;
+    void collectDrawItems(RenderPacket& packet) override;
+    void draw(const DrawItem& item) override;
+    BoundingBox getBoundingBox() const override;
+    RigidBody* getRigidBody() override { return &_body; }
+
+private:
+    RigidBody _body;
+    Transform _transform;
+    Vector3f _color;
+    float _height;
+    float _radius;
+    int _lod; ///< Nível de detalhe das malhas no último quadro.
+};
+
+#endif // MOVABLEVASE_H
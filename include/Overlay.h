@@ -0,0 +1,89 @@
+/**
+ * @file Overlay.h
+ * @brief Define o Overlay, a camada 2D (HUD) desenhada por cima da cena.
+ *
+ * Todos os elementos do HUD (texto, mira, visor do teclado, inventário) viram
+ * quadriláteros num único vetor de vértices, desenhado com uma só chamada por
+ * quadro. O texto usa um atlas: a fonte bitmap do GLUT é rasterizada uma única
+ * vez numa textura, e cada caractere passa a ser um quadrilátero texturizado em
+ * vez de um glRasterPos/glutBitmapCharacter.
+ */
+#ifndef OVERLAY_H
+#define OVERLAY_H
+
+#include "Vector.h"
+#include <string>
+#include <vector>
+#include <GL/glut.h>
+
+/**
+ * @class Overlay
+ * @brief Acumula os quadriláteros do HUD e os desenha em lote.
+ *
+ * Usado apenas pela thread de OpenGL. As coordenadas são em pixels, com a origem
+ * no canto inferior esquerdo da janela (como gluOrtho2D).
+ */
+class Overlay {
+public:
+    Overlay();
+
+    /**
+     * @brief Começa um novo quadro, descartando os quadriláteros do anterior.
+     *
+     * Na primeira chamada, rasteriza a fonte no atlas (exige a janela já visível).
+     */
+    void begin();
+
+    /** @brief Um retângulo de cor sólida. */
+    void addRect(float x, float y, float width, float height, const Vector3f& color, float alpha = 1.0f);
+
+    /** @brief A borda de um retângulo, com a espessura dada (para dentro). */
+    void addFrame(float x, float y, float width, float height, float thickness, const Vector3f& color, float alpha = 1.0f);
+
+    /**
+     * @brief Uma linha de texto.
+     * @param x A posição do início do texto.
+     * @param y A linha de base do texto.
+     */
+    void addText(const std::string& text, float x, float y, const Vector3f& color, float alpha = 1.0f);
+
+    /** @brief Uma linha de texto centralizada em centerX. */
+    void addCenteredText(const std::string& text, float centerX, float y, const Vector3f& color, float alpha = 1.0f);
+
+    /** @brief A largura do texto, em pixels. */
+    float measureText(const std::string& text) const;
+
+    /** @brief A altura de uma linha de texto, em pixels. */
+    float getLineHeight() const;
+
+    /** @brief Desenha todos os quadriláteros acumulados, numa única chamada. */
+    void flush();
+
+private:
+    enum { FIRST_GLYPH = 32, GLYPH_COUNT = 95, ATLAS_COLUMNS = 16 };
+
+    struct Vertex {
+        float x, y;
+        float u, v;
+        GLubyte r, g, b, a;
+    };
+
+    struct Glyph {
+        float u0, v0, u1, v1;
+        float width;   ///< Avanço da caneta, em pixels.
+    };
+
+    void buildAtlas();
+    void addQuad(float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1,
+                 const Vector3f& color, float alpha);
+
+    GLuint _atlas;
+    Glyph _glyphs[GLYPH_COUNT];
+    float _cellWidth;
+    float _cellHeight;
+    float _descent;        ///< Distância da base da célula até a linha de base.
+    float _whiteU, _whiteV; ///< Um texel branco do atlas, para os retângulos sólidos.
+    std::vector<Vertex> _vertices;
+};
+
+#endif // OVERLAY_H
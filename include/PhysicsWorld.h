@@ -0,0 +1,129 @@
+/**
+ * @file PhysicsWorld.h
+ * @brief Define o RigidBody e o PhysicsWorld, uma simulação simples de corpos rígidos
+ * para os objetos móveis de uma sala (vasos empurráveis, formas carregáveis).
+ *
+ * Os corpos são caixas alinhadas aos eixos ou esferas, sem rotação. O mundo integra
+ * em passos fixos, resolve contatos contra as paredes da sala, o chão (y = 0) e
+ * os outros corpos, e agrupa corpos que se tocam em "ilhas". Quando todos os corpos
+ * de uma ilha ficam parados por um tempo, a ilha dorme: corpos dormindo não são
+ * integrados nem testados entre si, e uma sala só com corpos dormindo não custa nada.
+ */
+#ifndef PHYSICSWORLD_H
+#define PHYSICSWORLD_H
+
+#include "Vector.h"
+#include "Collision.h"
+#include <vector>
+
+/** @brief Formas de colisão suportadas. */
+enum class BodyShape { BOX, SPHERE };
+
+/**
+ * @struct RigidBody
+ * @brief Um corpo rígido sem rotação.
+ *
+ * O corpo pertence ao objeto que o usa (por exemplo, MovableVase); o PhysicsWorld
+ * guarda apenas um ponteiro para ele.
+ */
+struct RigidBody {
+    BodyShape shape;
+    Vector3f position;     ///< Centro do corpo.
+    Vector3f velocity;     ///< Velocidade, em unidades por segundo.
+    Vector3f halfExtents;  ///< Meias dimensões (BOX).
+    float radius;          ///< Raio (SPHERE).
+    float inverseMass;     ///< 1 / massa. Zero para corpos imóveis.
+    float restitution;     ///< Quanto da velocidade normal é devolvida num choque [0, 1].
+    float friction;        ///< Coeficiente de atrito nos contatos.
+    bool enabled;          ///< Corpos desativados (ex.: carregados pelo jogador) ficam fora da simulação.
+    bool asleep;           ///< Se o corpo está dormindo junto com a sua ilha.
+    float restTime;        ///< Há quanto tempo (s) o corpo está quase parado.
+
+    RigidBody();
+
+    /**
+     * @brief Cria uma caixa.
+     * @param position O centro da caixa.
+     * @param halfExtents As meias dimensões.
+     * @param mass A massa (0 para um corpo imóvel).
+     */
+    static RigidBody makeBox(const Vector3f& position, const Vector3f& halfExtents, float mass);
+
+    /**
+     * @brief Cria uma esfera.
+     * @param position O centro da esfera.
+     * @param radius O raio.
+     * @param mass A massa (0 para um corpo imóvel).
+     */
+    static RigidBody makeSphere(const Vector3f& position, float radius, float mass);
+
+    /** @brief Caixa delimitadora do corpo na posição atual. */
+    BoundingBox getBounds() const;
+
+    /** @brief Acorda o corpo, que volta a ser simulado no próximo passo. */
+    void wake();
+
+    /**
+     * @brief Aplica um impulso instantâneo (variação de momento) e acorda o corpo.
+     * @param impulse O impulso, em massa * unidades / s.
+     */
+    void applyImpulse(const Vector3f& impulse);
+};
+
+/**
+ * @class PhysicsWorld
+ * @brief Simula os corpos rígidos de uma sala.
+ */
+class PhysicsWorld {
+public:
+    PhysicsWorld();
+
+    /**
+     * @brief Define as caixas estáticas (paredes) contra as quais os corpos colidem.
+     * @param colliders Ponteiro para o vetor de caixas, que deve viver mais que o mundo.
+     */
+    void setStaticColliders(const std::vector<BoundingBox>* colliders);
+
+    /** @brief Registra um corpo no mundo. */
+    void addBody(RigidBody* body);
+
+    /** @brief Remove um corpo do mundo. */
+    void removeBody(RigidBody* body);
+
+    /**
+     * @brief Avança a simulação, em passos fixos de Config::PHYSICS_STEP_MS.
+     *
+     * Se não houver nenhum corpo acordado, retorna imediatamente.
+     *
+     * @param deltaTime O tempo decorrido (em ms).
+     */
+    void step(float deltaTime);
+
+    /**
+     * @brief Empurra os corpos que a cápsula do jogador estiver tocando.
+     *
+     * Corpos tocados são tirados de dentro da cápsula e recebem, na direção do
+     * contato, pelo menos a velocidade do jogador.
+     *
+     * @param capsule A cápsula do jogador.
+     * @param velocity A velocidade horizontal do jogador, em unidades por segundo.
+     */
+    void pushBodies(const Capsule& capsule, const Vector3f& velocity);
+
+    /** @brief Número de corpos ativos e acordados. */
+    int getAwakeCount() const;
+
+private:
+    void simulate(float dt);
+    void updateSleep(float dt);
+    int findRoot(int index);
+    void unite(int a, int b);
+
+    std::vector<RigidBody*> _bodies;
+    std::vector<int> _islandParent; ///< Union-find das ilhas do passo atual.
+    std::vector<char> _islandCanSleep; ///< Por raiz de ilha, reaproveitado a cada passo.
+    const std::vector<BoundingBox>* _staticColliders;
+    float _accumulator;             ///< Tempo (ms) ainda não simulado.
+};
+
+#endif // PHYSICSWORLD_H
@@ -4,11 +4,10 @@
 #include "FPSCamera.h"
 #include "GameObject.h"
 #include "GameStateManager.h"
+#include "Collision.h"
 #include <map>
 #include <vector>
 
-bool checkCollision(const BoundingBox& a, const BoundingBox& b);
-
 class Player {
 public:
     Player();
@@ -17,14 +16,17 @@ public:
     void handleKeyUp(unsigned char key);
     void handleMouseMotion(int x, int y);
 
-    void update(float deltaTime, const std::vector<GameObject*>& objects, GameStateManager& gameStateManager);
+    void update(float deltaTime, const std::vector<BoundingBox>& colliders, GameStateManager& gameStateManager);
 
     void setPosition(const Vector3f& pos);
     FPSCamera& getCamera();
     BoundingBox getBoundingBox() const;
+    Capsule getCapsule() const;
+    const Vector3f& getVelocity() const;
 
 private:
     Vector3f _position; // A nica varivel de posio para o corpo E a cmera
+    Vector3f _velocity; // Deslocamento do ltimo passo, em unidades por segundo
     FPSCamera _camera;
     float _movementSpeed;
     float _collisionRadius;
@@ -0,0 +1,108 @@
+/**
+ * @file PostProcess.h
+ * @brief Define o PostProcess, a cadeia de pós-processamento da cena: bloom e FXAA.
+ *
+ * A cena é desenhada numa textura (framebuffer object) em vez de ir direto para a
+ * tela. Depois, shaders em tela cheia:
+ * 1. Extraem a parte emissiva da cena numa textura BLOOM_DOWNSAMPLE vezes menor.
+ * 2. Desfocam essa textura com um filtro gaussiano separável (horizontal e vertical).
+ * 3. Compõem na tela a cena (com FXAA) mais o brilho desfocado.
+ *
+ * O canal emissivo é o alfa da cena: tudo é desenhado com alfa 1 (glColor3f), e
+ * objetos que brilham usam alfa 1 - emissão (ver emissiveColor). Assim o brilho
+ * custa o mesmo por quadro, qualquer que seja o número de objetos brilhando.
+ *
+ * A cena pode ser desenhada em resolução menor que a da tela (setRenderScale), no
+ * canto da mesma textura; a composição amplia e aplica um filtro de nitidez. O HUD,
+ * desenhado depois de endScene, fica sempre na resolução da tela.
+ *
+ * Sem framebuffer objects ou shaders, a cena vai direto para a tela e os objetos
+ * que brilham usam o seu próprio efeito (isBloomActive() retorna false).
+ */
+#ifndef POSTPROCESS_H
+#define POSTPROCESS_H
+
+#include "Vector.h"
+#include <GL/glut.h>
+
+class PostProcess {
+public:
+    PostProcess();
+
+    /**
+     * @brief Cria os alvos e os shaders. Thread de OpenGL, depois de GLExtensions::init.
+     * @return false se o OpenGL não tiver os recursos necessários (a cena vai direto para a tela).
+     */
+    bool init(int width, int height);
+
+    bool isActive() const;
+
+    void setBloomEnabled(bool enabled);
+    void setFxaaEnabled(bool enabled);
+    bool isBloomEnabled() const;
+    bool isFxaaEnabled() const;
+
+    /**
+     * @brief Fração da resolução da tela em que a cena é desenhada (em cada eixo),
+     * limitada a [Config::RENDER_SCALE_MIN, 1]. Vale a partir do próximo beginScene.
+     */
+    void setRenderScale(float scale);
+    /** @brief A escala em uso; 1 se o pós-processamento estiver inativo. */
+    float getRenderScale() const;
+
+    /** @brief Direciona o desenho da cena para a textura. Sem efeito se inativo. */
+    void beginScene();
+
+    /**
+     * @brief Aplica o bloom e o FXAA e desenha o resultado na tela. Sem efeito se inativo.
+     *
+     * Deixa a tela (framebuffer 0) como destino e restaura os estados alterados;
+     * o que vier depois (depuração, HUD) é desenhado por cima, sem pós-processamento.
+     */
+    void endScene();
+
+    /**
+     * @brief Define a cor de um desenho que brilha.
+     * @param color A cor.
+     * @param emission Quanto da cor vira brilho, de 0 a 1.
+     */
+    static void emissiveColor(const Vector3f& color, float emission);
+
+    /** @brief Se a cena do quadro atual está sendo desenhada com bloom. */
+    static bool isBloomActive();
+
+    /**
+     * @brief Liga ou desliga o bloom para o que for desenhado em seguida. Usado por
+     * desenhos fora da cena (a foto de um Impostor), em que o alfa não é o canal emissivo.
+     * @return O estado anterior, para ser restaurado depois.
+     */
+    static bool setBloomActive(bool active);
+
+private:
+    /** @brief Uma textura que pode ser alvo do desenho. */
+    struct Target {
+        GLuint framebuffer;
+        GLuint texture;
+        int width, height;
+    };
+
+    bool createTarget(Target& target, int width, int height, GLenum format, GLuint depthStencil);
+    void release();
+    static void drawFullscreenQuad();
+    void getRenderSize(int& width, int& height) const;
+
+    Target _scene;
+    Target _bloom[2];          ///< Ida e volta do desfoque.
+    GLuint _depthStencil;      ///< Profundidade e stencil da cena (os portais usam o stencil).
+    GLuint _brightProgram;
+    GLuint _blurProgram;
+    GLuint _compositeProgram;
+    bool _active;
+    bool _bloomEnabled;
+    bool _fxaaEnabled;
+    float _renderScale;
+
+    static bool _bloomFrame;
+};
+
+#endif // POSTPROCESS_H
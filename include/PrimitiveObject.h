@@ -3,24 +3,32 @@
 
 #include "GameObject.h"
 #include "Vector.h"
+#include "Transform.h"
+#include <string>
 
-enum class PrimitiveShape { SPHERE, CONE, TORUS, TEAPOT, CUBE };
+enum class PrimitiveShape { SPHERE, CONE, TORUS, TEAPOT, CUBE, MODEL };
 
 class PrimitiveObject : public GameObject {
 public:
     PrimitiveObject(PrimitiveShape shape, const Vector3f& position, const Vector3f& color, const Vector3f& scale = {1.0f, 1.0f, 1.0f});
+    /** @brief Objeto desenhado com um modelo de res/models (ver ModelManager). */
+    PrimitiveObject(const std::string& modelFile, const Vector3f& position, const Vector3f& color, const Vector3f& scale = {1.0f, 1.0f, 1.0f});
 
     virtual void update(float deltaTime, GameStateManager& gameStateManager) override;
-    virtual void render() override;
+    virtual void collectDrawItems(RenderPacket& packet) override;
+    virtual void draw(const DrawItem& item) override;
     virtual BoundingBox getBoundingBox() const override;
 
     void setColor(const Vector3f& c) {_color = c;}
+    Transform& getTransform() { return _transform; }
+    const Transform& getTransform() const { return _transform; }
 
 private:
     PrimitiveShape _shape;
-    Vector3f _position;
+    Transform _transform;
     Vector3f _color;
-    Vector3f _scale;
+    int _lod; ///< Nível de detalhe do último quadro (esfera, cone e toro).
+    int _model; ///< ID do modelo no ModelManager (só em PrimitiveShape::MODEL).
 };
 
 #endif // PRIMITIVEOBJECT_H
@@ -2,6 +2,8 @@
 #define PUZZLEDOOR_H
 
 #include "Door.h" // Herda diretamente de Door
+#include "Transform.h"
+#include "Impostor.h"
 
 class PuzzleDoor : public Door {
 public:
@@ -15,12 +17,22 @@ public:
                Icon icon = Icon::None,
                const Vector3f& iconGlow = {1.0f, 1.0f, 1.0f});
 
-    virtual void render() override;
+    virtual void collectDrawItems(RenderPacket& packet) override;
+    virtual void draw(const DrawItem& item) override;
 
 private:
-    Vector3f _doorColor;
-    Vector3f _iconGlow;
+    /** @brief As peas da porta; cada uma vira um item do pacote. */
+    enum Part { FRAME, LEAF, PANEL_TOP, PANEL_BOTTOM, HANDLE, ICON, PART_COUNT,
+                IMPOSTOR = PART_COUNT }; ///< De longe, a porta inteira vira um item s.
+
+    void drawParts(const Matrix4& view);
+
     Icon _icon;
+    Transform _root;                ///< A porta inteira, na posio do mundo.
+    Transform _parts[PART_COUNT];   ///< As peas, filhas de _root.
+    Vector3f _partColors[PART_COUNT];
+    Matrix4 _partLocal[PART_COUNT]; ///< Matrizes locais das peas, para a foto do impostor (fixas).
+    Impostor _impostor;
 };
 
 #endif // PUZZLEDOOR_H
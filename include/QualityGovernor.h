@@ -0,0 +1,77 @@
+/**
+ * @file QualityGovernor.h
+ * @brief Define o QualityGovernor, que sobe e desce a qualidade gráfica conforme o
+ * tempo de desenho dos quadros.
+ *
+ * Cada ajuste de qualidade (tesselação, nível de detalhe, filtragem, efeitos) é
+ * registrado como um "botão" com alguns degraus, do mais barato (0) ao melhor.
+ * O governador guarda o tempo dos últimos Config::QUALITY_WINDOW quadros e, com a
+ * janela cheia:
+ * - se a média passar do orçamento mais QUALITY_DOWN_MARGIN, desce um degrau do
+ *   botão que estiver mais alto (proporcionalmente; no empate, o registrado primeiro);
+ * - se ficar abaixo do orçamento menos QUALITY_UP_MARGIN, sobe um degrau do botão
+ *   que estiver mais baixo (no empate, o registrado por último).
+ * A distância entre as duas margens e a janela esvaziada a cada decisão (que mede
+ * de novo, já com a qualidade nova) formam a histerese.
+ *
+ * Os tempos vêm do FrameTimer do Game, o mesmo da resolução dinâmica, e chegam
+ * um ou dois quadros atrasados.
+ *
+ * Cada decisão é mostrada no console e acrescentada a Config::QUALITY_LOG_FILE
+ * (CSV), para análise posterior. Tudo roda na thread de OpenGL.
+ */
+#ifndef QUALITYGOVERNOR_H
+#define QUALITYGOVERNOR_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+class QualityGovernor {
+public:
+    /** @brief Aplica um degrau (de 0 a tierCount - 1). */
+    typedef std::function<void(int tier)> ApplyFunction;
+
+    /**
+     * @brief Registra um botão, que começa no degrau mais alto (aplicado na hora).
+     * @param name O nome usado no log.
+     * @param tierCount Quantos degraus o botão tem.
+     * @param apply Aplica um degrau.
+     */
+    static void registerKnob(const std::string& name, int tierCount, ApplyFunction apply);
+
+    /**
+     * @brief Registra o tempo de desenho de um quadro e decide, se for a hora.
+     * @param frameMs O tempo do quadro, em ms.
+     * @param allowDown Se a qualidade pode descer agora (ex.: a resolução dinâmica já
+     * está no mínimo).
+     * @param allowUp Se a qualidade pode subir agora.
+     * @return true se algum botão mudou de degrau.
+     */
+    static bool addFrame(float frameMs, bool allowDown = true, bool allowUp = true);
+
+    /** @brief O degrau atual de um botão, ou -1 se não houver botão com esse nome. */
+    static int getTier(const std::string& name);
+
+    /** @brief Remove todos os botões e esvazia a janela. */
+    static void clear();
+
+private:
+    struct Knob {
+        std::string name;
+        int tierCount;
+        int tier;
+        ApplyFunction apply;
+    };
+
+    static bool step(int direction, float averageMs);
+    static void log(const Knob& knob, int from, float averageMs);
+
+    static std::vector<Knob> _knobs;
+    static std::vector<float> _window; ///< Tempos dos últimos quadros (circular).
+    static size_t _next;
+    static size_t _count;
+    static unsigned long _frame;
+};
+
+#endif // QUALITYGOVERNOR_H
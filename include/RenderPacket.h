@@ -0,0 +1,171 @@
+/**
+ * @file RenderPacket.h
+ * @brief Define o RenderPacket, a "fotografia" imutável de um quadro produzida pela
+ * simulação e consumida pela thread de OpenGL.
+ *
+ * Tudo o que a thread de GL precisa para desenhar um quadro está no pacote:
+ * câmera, lanterna e a lista de itens de desenho. Objetos cujo visual depende
+ * de estado da simulação (animações, visibilidade) copiam esse estado para o
+ * DrawItem, de forma que a simulação do próximo quadro pode seguir em paralelo.
+ */
+#ifndef RENDERPACKET_H
+#define RENDERPACKET_H
+
+#include "Vector.h"
+#include "VectorMath.h"
+#include "Transform.h"
+#include "GameData.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class GameObject;
+
+/**
+ * @brief Estado da câmera em um quadro.
+ */
+struct CameraSnapshot {
+    Vector3f position;
+    Vector3f front;
+    Vector3f up;
+};
+
+/**
+ * @brief Estado da lanterna (GL_LIGHT0) em um quadro.
+ */
+struct LightSnapshot {
+    Vector3f position;
+    Vector3f direction;
+    Vector3f color;
+};
+
+/**
+ * @brief Em que ordem um item é desenhado dentro da sua sala (ver RenderPacket::sortFrontToBack).
+ */
+enum class DrawLayer : uint8_t {
+    Opaque,     ///< Da frente para trás, pela profundidade da origem do item na visão.
+    Enclosing,  ///< Envolve a sala (as paredes): quase tudo fica na frente, então vai depois dos opacos.
+    Overlay     ///< Sobre outra peça (texto, brilho), com teste de profundidade: por último, na ordem em que foi registrado.
+};
+
+/**
+ * @brief Um item a ser desenhado: o objeto responsável e o estado copiado dele.
+ *
+ * A thread de GL carrega Visão * transform direto na matriz de modelo-visão
+ * (glLoadMatrixf) antes de chamar GameObject::draw, então draw desenha em
+ * coordenadas locais e não mexe na pilha de matrizes para posicionar o objeto.
+ * Como a matriz é recarregada a cada item, draw pode alterá-la sem restaurá-la.
+ */
+struct DrawItem {
+    GameObject* object;   ///< Objeto que sabe desenhar este item (GameObject::draw).
+    Matrix4 transform;    ///< Matriz de modelo (mundo), em ordem coluna-maior.
+    Vector3f color;       ///< Cor base do material.
+    int part;             ///< Peça do objeto, para objetos desenhados em vários itens.
+    int lod;              ///< Nível de detalhe da malha, escolhido pela simulação (ver MeshManager).
+    DrawLayer layer;      ///< Ordem de desenho; Opaque, a não ser que o objeto diga o contrário.
+
+    explicit DrawItem(GameObject* obj = nullptr);
+
+    /**
+     * @brief Cria um item com a matriz de mundo (em cache) de um Transform.
+     * @param obj O objeto que desenhará o item.
+     * @param objectTransform A transformação do objeto ou da peça.
+     * @param part A peça do objeto.
+     */
+    DrawItem(GameObject* obj, const Transform& objectTransform, int part = 0);
+};
+
+/**
+ * @brief Estado do jogo mostrado no HUD em um quadro.
+ */
+struct HudSnapshot {
+    bool keypadActive = false;
+    std::string keypadInput;
+    std::vector<ItemType> inventory;
+};
+
+/**
+ * @brief Um vértice das linhas de depuração (ver DebugDraw).
+ */
+struct DebugVertex {
+    float x, y, z;
+    uint8_t r, g, b, a;
+};
+
+/**
+ * @brief Um texto de depuração, preso a um ponto do mundo.
+ */
+struct DebugText {
+    Vector3f position;
+    std::string text;
+    Vector3f color;
+};
+
+/**
+ * @brief Uma sala vizinha vista através de uma porta (portal).
+ *
+ * Tudo está nas coordenadas da sala atual. Os portais ficam em pré-ordem (o pai
+ * antes dos filhos), e os itens de cada um ocupam um trecho contíguo de items.
+ */
+struct PortalView {
+    int parent;           ///< Portal através do qual este é visto (-1: visto da sala atual).
+    int depth;            ///< 1 para os portais da sala atual, 2 para os vistos através deles...
+    Vector3f corners[4];  ///< A abertura da porta.
+    Vector4f clipPlane;   ///< Descarta a geometria da sala de destino entre a câmera e a porta.
+    Matrix4 offset;       ///< Leva coordenadas da sala de destino para as da sala atual.
+    int scissor[4];       ///< Retângulo da abertura na tela (x, y, largura, altura).
+    size_t firstItem;
+    size_t itemCount;
+};
+
+/** @brief Chave de ordenação de um item (ver RenderPacket::sortFrontToBack). */
+struct DrawSortKey {
+    DrawLayer layer;
+    float depth;    ///< Profundidade na visão; 0 fora da camada Opaque.
+    uint32_t index; ///< Posição do item no trecho, que desempata e torna a ordem estável.
+};
+
+/**
+ * @struct RenderPacket
+ * @brief Tudo o que é necessário para desenhar um quadro.
+ *
+ * Os pacotes são reaproveitados entre quadros; clear() mantém a memória
+ * já alocada pelos vetores.
+ */
+struct RenderPacket {
+    unsigned long frameIndex = 0;
+    CameraSnapshot camera;
+    LightSnapshot flashlight;
+    std::vector<DrawItem> items;
+    size_t roomItemCount = 0;         ///< Itens da sala atual; os seguintes são dos portais.
+    bool depthPrepass = false;        ///< Desenha só a profundidade dos itens opacos da sala antes da cor.
+    std::vector<PortalView> portals;
+    std::vector<DebugVertex> debugLines;  ///< Pares de vértices, desenhados como GL_LINES.
+    std::vector<DebugText> debugTexts;
+    HudSnapshot hud;
+    int gameState = 0; ///< Valor do enum GameState no momento da captura.
+    std::vector<DrawSortKey> sortKeys; ///< Espaço de trabalho de sortFrontToBack, reaproveitado entre quadros.
+
+    /** @brief Esvazia as listas do pacote sem liberar sua memória. */
+    void clear();
+
+    /**
+     * @brief Resumo (hash) de tudo o que o pacote mostra: câmera, lanterna, itens,
+     * portais, HUD e estado do jogo. Como GameObject::draw só usa o DrawItem, dois
+     * pacotes com o mesmo resumo produzem o mesmo quadro (ver Game::publishFrame).
+     * Não inclui frameIndex nem o desenho de depuração.
+     */
+    uint64_t signature() const;
+
+    /**
+     * @brief Ordena os itens a partir de `first` por DrawLayer e, entre os opacos, da
+     * frente para trás, de forma que o teste de profundidade descarte o que fica atrás
+     * antes de ser sombreado.
+     * @param first O primeiro item do trecho (o trecho vai até o fim da lista).
+     * @param eye A posição da câmera, nas coordenadas dos itens.
+     * @param front A direção da câmera.
+     */
+    void sortFrontToBack(size_t first, const Vector3f& eye, const Vector3f& front);
+};
+
+#endif // RENDERPACKET_H
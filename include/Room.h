@@ -2,9 +2,16 @@
 #define ROOM_H
 
 
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "GameObject.h"
+#include "PhysicsWorld.h"
+#include "TriggerSystem.h"
+#include "StaticBatch.h"
+#include "Lightmap.h"
+#include "LightBaker.h"
 
 
 /**
@@ -16,6 +23,8 @@
  */
 
 class InteractableObject;
+class Door;
+class Floor;
 class Room {
 public:
     /**
@@ -42,18 +51,68 @@ public:
     void update(float deltaTime, GameStateManager& gameStateManager);
 
     /**
-     * @brief Renderiza todos os objetos na sala.
+     * @brief Registra no pacote do quadro os itens de desenho de todos os objetos da sala.
+     * @param packet O pacote sendo montado pela simulao.
      */
-    void render();
+    void collectDrawItems(RenderPacket& packet);
     std::vector<InteractableObject*>& getInteractableObjects();
     const std::vector<GameObject*>& getObjects() const;
 
+    /** @brief As portas da sala (candidatas a portal). */
+    const std::vector<Door*>& getDoors() const;
+
+    /**
+     * @brief Obtm as caixas de coliso estticas da sala (as paredes).
+     * @note As caixas so calculadas uma vez, quando cada parede  adicionada.
+     */
+    const std::vector<BoundingBox>& getStaticColliders() const;
+
+    /**
+     * @brief Obtm o mundo fsico da sala, com os corpos dos seus objetos mveis.
+     */
+    PhysicsWorld& getPhysics();
+
+    /**
+     * @brief Informa a caixa atual do jogador aos volumes de gatilho da sala.
+     */
+    void trackPlayer(const BoundingBox& bounds);
+
+    /**
+     * @brief Retira o jogador dos volumes de gatilho (ao sair da sala).
+     */
+    void untrackPlayer();
+
+    /**
+     * @brief Acrescenta uma luz fixa, que entra no lightmap da sala em bakeLighting.
+     */
+    void addBakedLight(const BakedLight& light) { _bakedLights.push_back(light); }
+
+    /**
+     * @brief Calcula (ou l do cache) o lightmap das paredes e do cho da sala.
+     *
+     * Deve ser chamado depois que todos os objetos estticos forem adicionados.
+     *
+     * @param cacheFile O arquivo do cache do lightmap.
+     */
+    void bakeLighting(const std::string& cacheFile);
+
     void setSpawnPoint(const Vector3f& pos) { _spawnPoint = pos; }
     const Vector3f& getSpawnPoint() const { return _spawnPoint; }
 private:
     Vector3f _spawnPoint = {0.0f, 1.6f, 0.0f};
     std::vector<GameObject*> _objects;
+    std::vector<GameObject*> _drawObjects; ///< Os objetos desenhados um a um (tudo menos as paredes).
+    StaticBatch _staticBatch;              ///< As paredes da sala, desenhadas num nico lote.
+    std::vector<Floor*> _floors;
+    std::vector<BakedLight> _bakedLights;
+    Lightmap _lightmap;                    ///< Iluminao esttica das paredes e do cho.
     std::vector<InteractableObject*> _interactables;
+    std::vector<Door*> _doors;
+    std::vector<BoundingBox> _staticColliders;
+    PhysicsWorld _physics;
+    TriggerSystem _triggers;
+    std::vector<std::pair<RigidBody*, int> > _trackedBodies; ///< Corpos e seus identificadores no TriggerSystem.
+    int _playerHandle;
 };
 
 #endif // ROOM_H
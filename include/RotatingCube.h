@@ -3,39 +3,43 @@
 
 #include "InteractableObject.h"
 #include "Vector.h"
-#include <random>
+#include "Transform.h"
 
 class CubePuzzle; // Forward declaration
+class AnimationSystem;
 
 class RotatingCube : public InteractableObject {
 public:
     RotatingCube(const Vector3f& position, float size, int row, int col, CubePuzzle* puzzleManager);
-    ~RotatingCube() override = default;
+    ~RotatingCube() override;
 
     void update(float deltaTime, GameStateManager& gameStateManager) override;
-    void render() override;
+    void collectDrawItems(RenderPacket& packet) override;
+    void draw(const DrawItem& item) override;
     void onClick(GameStateManager& gameStateManager) override;
     BoundingBox getBoundingBox() const override;
     float getCollisionRadius() const override;
 
-    void rotate();
+    void rotate(AnimationSystem* animations);
     int getRotationState() const { return _rotationState; }
-    void setRotationState(int state) { _rotationState = state % 4; }
+    void setRotationState(int state);
     int getRow() const { return _row; }
     int getCol() const { return _col; }
 
     // Animação de movimento
-    void moveTo(const Vector3f& newPos) { _targetPosition = newPos; }
+    void moveTo(const Vector3f& newPos, AnimationSystem* animations);
 
 private:
     float _size;
     int _rotationState; // 0=0°, 1=90°, 2=180°, 3=270°
-    float _currentAngle; // Para animação de rotação
-    float _targetAngle;  // Para animação de rotação
+    float _currentAngle; // Animado pelo AnimationSystem
+    float _targetAngle;  // Ângulo final da rotação em andamento
     int _row, _col;
     CubePuzzle* _puzzleManager;
-    Vector3f _currentPosition; // Para animação de movimento
-    Vector3f _targetPosition;  // Para animação de movimento
+    Vector3f _currentPosition; // Animado pelo AnimationSystem
+    Vector3f _targetPosition;  // Posição final do movimento em andamento
+    Transform _transform;      // Sincronizado com a animação em collectDrawItems
+    AnimationSystem* _animations; // Sistema das transições em andamento, cancelado no destrutor
 };
 
 #endif // ROTATINGCUBE_H
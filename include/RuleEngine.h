@@ -0,0 +1,147 @@
+/**
+ * @file RuleEngine.h
+ * @brief Define o RuleEngine, que carrega as regras dos puzzles de um arquivo texto,
+ * compila-as para bytecode e as avalia quando um evento relevante acontece.
+ *
+ * Formato do arquivo (uma declaração por linha, '#' inicia comentário):
+ *
+ *     input <canal> <tamanho>      declara um canal de entrada (ex.: keypad 3)
+ *     rule <nome>                  inicia uma regra
+ *       when <condição>            flag <ID> | item <ITEM> | input <canal> "<valor>",
+ *                                  combinadas com not, and, or e parênteses
+ *       do <ação> <argumento>      set, clear, unlock, reveal <ID> | give, take <ITEM>
+ *     end
+ *
+ * Cada condição vira uma sequência pós-fixa de instruções avaliada por uma pilha de
+ * tamanho fixo. Na compilação, cada regra é indexada pelas flags, itens e canais que
+ * ela lê; um evento só reavalia as regras daquele índice, e nada é alocado durante
+ * a avaliação.
+ */
+#ifndef RULEENGINE_H
+#define RULEENGINE_H
+
+#include "GameData.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class GameStateManager;
+
+/**
+ * @class RuleEngine
+ * @brief Compilador e máquina virtual das regras dos puzzles.
+ */
+class RuleEngine {
+public:
+    RuleEngine();
+
+    /**
+     * @brief Lê e compila um arquivo de regras, substituindo as regras atuais.
+     *
+     * Linhas com erro são informadas no console e a regra correspondente é descartada.
+     *
+     * @param path O caminho do arquivo.
+     * @return false se o arquivo não pôde ser aberto ou tiver algum erro.
+     */
+    bool loadFromFile(const std::string& path);
+
+    /**
+     * @brief Compila regras a partir de um texto.
+     * @param source O conteúdo, no formato descrito no início deste arquivo.
+     * @param sourceName Nome usado nas mensagens de erro.
+     * @return O número de erros encontrados (0 se tudo compilou).
+     */
+    int compile(const std::string& source, const std::string& sourceName);
+
+    /**
+     * @brief Avalia todas as regras que não dependem de entrada.
+     *
+     * Usado logo após o carregamento, para que regras já satisfeitas pelo estado
+     * inicial disparem.
+     */
+    void evaluateAll(GameStateManager& gameStateManager);
+
+    /** @brief Evento: uma flag de puzzle mudou de valor. */
+    void onFlagChanged(const std::string& flag, GameStateManager& gameStateManager);
+
+    /** @brief Evento: um item entrou ou saiu do inventário. */
+    void onItemChanged(ItemType item, GameStateManager& gameStateManager);
+
+    /**
+     * @brief Evento: um canal de entrada completou o seu tamanho.
+     * @param channel O nome do canal.
+     * @param value Os símbolos digitados.
+     * @return true se alguma regra disparou com esta entrada.
+     */
+    bool onInput(const std::string& channel, const std::string& value, GameStateManager& gameStateManager);
+
+    /**
+     * @brief Quantos símbolos um canal junta antes de ser avaliado.
+     * @return O tamanho declarado, ou 0 se o canal não existir.
+     */
+    int getInputLength(const std::string& channel) const;
+
+    /** @brief Número de regras compiladas. */
+    int getRuleCount() const;
+
+private:
+    /** @brief Instruções do bytecode. */
+    enum Op {
+        OP_FLAG,   ///< Empilha o valor da flag [id].
+        OP_ITEM,   ///< Empilha se o jogador tem o item [item].
+        OP_INPUT,  ///< Empilha se a entrada atual do canal [canal] é a constante [valor].
+        OP_NOT,
+        OP_AND,
+        OP_OR,
+        OP_END,    ///< Fim da condição; o topo da pilha é o resultado.
+        ACT_SET,   ///< Marca a flag [id] como resolvida.
+        ACT_CLEAR, ///< Marca a flag [id] como não resolvida.
+        ACT_GIVE,  ///< Dá o item [item] ao jogador.
+        ACT_TAKE   ///< Tira o item [item] do jogador.
+    };
+
+    /** @brief Profundidade máxima da pilha de avaliação. */
+    static const int STACK_SIZE = 16;
+
+    struct Rule {
+        std::string name;
+        int conditionStart;  ///< Índice da primeira instrução da condição em _code.
+        int actionStart;     ///< Índice da primeira ação em _code.
+        int actionCount;
+        bool readsInput;     ///< Regras de entrada disparam a cada entrada que as satisfaz.
+        bool lastResult;     ///< As demais disparam só quando a condição passa de falsa a verdadeira.
+        bool queued;
+    };
+
+    struct Channel {
+        std::string name;
+        int length;
+        std::vector<int> rules;
+    };
+
+    struct Parser;
+
+    int internFlag(const std::string& flag);
+    int internConstant(const std::string& value);
+    int findChannel(const std::string& channel) const;
+    void buildIndex();
+
+    bool evaluate(const Rule& rule, const GameStateManager& gameStateManager, int channel, const std::string* input) const;
+    void execute(const Rule& rule, GameStateManager& gameStateManager);
+    void enqueue(const std::vector<int>& rules);
+    void runQueue(GameStateManager& gameStateManager);
+
+    std::vector<int> _code;
+    std::vector<Rule> _rules;
+    std::vector<std::string> _flagNames;
+    std::unordered_map<std::string, int> _flagIds;
+    std::vector<std::string> _constants;
+    std::vector<Channel> _channels;
+
+    std::vector<std::vector<int>> _flagRules; ///< Regras que leem cada flag.
+    std::vector<std::vector<int>> _itemRules; ///< Regras que leem cada item.
+    std::vector<int> _queue;                  ///< Regras aguardando avaliação (reservada com o número de regras).
+    bool _running;                            ///< Evita reentrada quando uma ação gera novos eventos.
+};
+
+#endif // RULEENGINE_H
@@ -4,6 +4,7 @@
 #include <vector>
 #include <string>
 #include "Vector.h"
+#include "VectorMath.h"
 
 // Forward declarations
 class GameObject;
@@ -11,6 +12,7 @@ class InteractableObject;
 class Room;
 class Player;
 class GameStateManager;
+struct RenderPacket;
 
 class SceneManager {
 public:
@@ -19,15 +21,21 @@ public:
 
     void init(Player& player);
     void update(float deltaTime, GameStateManager& gameStateManager);
-    void render();
+    void collectDrawItems(RenderPacket& packet);
 
     void switchToRoom(int roomIndex, Player& player, const Vector3f& spawnPosition);
 
     void setActiveRoom(int index);
     std::vector<InteractableObject*>& getInteractableObjects();
     const std::vector<GameObject*>& getCurrentRoomObjects() const;
+    const std::vector<BoundingBox>& getCurrentRoomColliders() const;
 
 private:
+    static Matrix4 cameraProjection();
+    static bool useDepthPrepass(const RenderPacket& packet);
+    void collectPortals(Room* room, const Matrix4& offset, const Frustum& frustum, const Matrix4& viewProjection,
+                        int parent, int depth, RenderPacket& packet);
+
     std::vector<Room*> _rooms;
     int _currentRoomIndex;
     Player* _player;
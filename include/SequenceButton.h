@@ -0,0 +1,47 @@
+#ifndef SEQUENCEBUTTON_H
+#define SEQUENCEBUTTON_H
+
+#include "InteractableObject.h"
+#include "Transform.h"
+#include <string>
+
+class AnimationSystem;
+
+/**
+ * @file SequenceButton.h
+ * @brief Define a classe SequenceButton, um botão que, ao ser pressionado, envia um
+ * símbolo para um canal de entrada das regras dos puzzles.
+ *
+ * Vários botões no mesmo canal formam um puzzle de sequência: quando o canal junta
+ * o número de símbolos declarado no arquivo de regras, a sequência é avaliada.
+ */
+
+class SequenceButton : public InteractableObject {
+public:
+    /**
+     * @param position A posição do botão (o centro da esfera).
+     * @param channel O canal de entrada que recebe o símbolo.
+     * @param symbol O símbolo enviado ao pressionar.
+     * @param color A cor do botão.
+     */
+    SequenceButton(const Vector3f& position, const std::string& channel, char symbol, const Vector3f& color);
+    ~SequenceButton() override;
+
+    void update(float deltaTime, GameStateManager& gameStateManager) override;
+    void collectDrawItems(RenderPacket& packet) override;
+    void draw(const DrawItem& item) override;
+    void onClick(GameStateManager& gameStateManager) override;
+    float getCollisionRadius() const override;
+    BoundingBox getBoundingBox() const override;
+
+private:
+    Transform _transform;
+    std::string _channel;
+    char _symbol;
+    Vector3f _color;
+    float _glow; ///< Brilho após o clique, de 1 (recém pressionado) a 0; animado pelo AnimationSystem.
+    int _lod;    ///< Nível de detalhe da esfera no último quadro.
+    AnimationSystem* _animations; ///< Sistema que anima o brilho; cancelado no destrutor.
+};
+
+#endif // SEQUENCEBUTTON_H
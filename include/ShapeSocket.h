@@ -0,0 +1,59 @@
+#ifndef SHAPESOCKET_H
+#define SHAPESOCKET_H
+
+#include "InteractableObject.h"
+#include "TriggerSystem.h"
+#include "Transform.h"
+#include <string>
+#include <vector>
+
+class CollectableShape;
+
+/**
+ * @file ShapeSocket.h
+ * @brief Define a classe ShapeSocket, um encaixe no chão onde uma forma deve ser colocada.
+ *
+ * O encaixe é um volume de gatilho: ele não verifica os objetos da sala a cada
+ * quadro, apenas reage quando algo entra ou sai do seu volume. Sem forma
+ * esperada, funciona como placa de pressão, ativada por qualquer objeto ou
+ * pelo jogador.
+ */
+
+class ShapeSocket : public InteractableObject, public TriggerListener {
+public:
+    /**
+     * @param position O centro do encaixe, no chão.
+     * @param expectedShape A forma aceita, ou nullptr para uma placa de pressão.
+     * @param puzzleId O puzzle marcado como resolvido quando o grupo inteiro estiver ocupado.
+     */
+    ShapeSocket(const Vector3f& position, CollectableShape* expectedShape, const std::string& puzzleId);
+
+    void update(float deltaTime, GameStateManager& gameStateManager) override;
+    void collectDrawItems(RenderPacket& packet) override;
+    void draw(const DrawItem& item) override;
+    void onClick(GameStateManager& gameStateManager) override;
+    float getCollisionRadius() const override;
+    BoundingBox getBoundingBox() const override;
+
+    BoundingBox getTriggerVolume() const override;
+    void onTriggerEvent(TriggerEvent event, GameObject* other, GameStateManager& gameStateManager) override;
+
+    /**
+     * @brief Liga encaixes que formam um único puzzle: ele só é resolvido com todos ocupados.
+     */
+    static void linkGroup(const std::vector<ShapeSocket*>& sockets);
+
+    bool isFilled() const { return _occupants > 0; }
+
+private:
+    bool accepts(GameObject* other) const;
+
+    CollectableShape* _expectedShape;
+    std::string _puzzleId;
+    std::vector<ShapeSocket*> _group;
+    Transform _transform;
+    Vector3f _color;
+    int _occupants;
+};
+
+#endif // SHAPESOCKET_H
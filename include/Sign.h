@@ -3,22 +3,47 @@
 
 #include "InteractableObject.h"
 #include "Vector.h"
+#include "Transform.h"
+#include "Impostor.h"
 #include <string>
+#include <vector>
 
 class Sign : public InteractableObject {
 public:
     Sign(const Vector3f& pos, const std::string& text);
 
     void update(float /*dt*/, GameStateManager& /*gsm*/) override {}
-    void render() override;
+    void collectDrawItems(RenderPacket& packet) override;
+    void draw(const DrawItem& item) override;
     void onClick(GameStateManager& /*gsm*/) override {}
 
     float getCollisionRadius() const override { return 0.0f; }
     BoundingBox getBoundingBox() const override { return {{0,0,0},{0,0,0}}; }
 
 private:
+    enum { BOARDS = 5 };
+
+    /** @brief As peças da placa; cada uma vira um item do pacote. */
+    enum Part { ROPE_LEFT, ROPE_RIGHT, BOARD_FIRST, TEXT = BOARD_FIRST + BOARDS, PART_COUNT,
+                IMPOSTOR = PART_COUNT }; ///< De longe, a placa inteira vira um item só.
+
+    void layoutText();
+    void drawText(const Vector3f& rgb);
+    void drawParts(const Matrix4& view);
+
     Vector3f _pos;
     std::string _text;
+    Transform _root;                ///< A placa inteira, na posição do mundo.
+    Transform _parts[PART_COUNT];   ///< As peças, filhas de _root.
+    Vector3f _partColors[PART_COUNT];
+    Matrix4 _partLocal[PART_COUNT]; ///< Matrizes locais das peças, para a foto do impostor (fixas).
+    Impostor _impostor;
+
+    // Usados apenas pela thread de OpenGL (o texto é quebrado na primeira vez que é desenhado).
+    std::vector<std::string> _lines;
+    float _textScale;
+    bool _textReady;
+    int _ropeLod; ///< Nível de detalhe das cordas no último quadro.
 };
 
 #endif
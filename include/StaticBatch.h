@@ -0,0 +1,77 @@
+/**
+ * @file StaticBatch.h
+ * @brief Define o StaticBatch, que junta a geometria estática de uma sala (as
+ * paredes) numa única display list.
+ *
+ * Todas as paredes usam o atlas de materiais do TextureManager, então paredes de
+ * materiais diferentes entram no mesmo lote: a sala inteira é desenhada com uma
+ * troca de textura e uma chamada. Se a sala tiver um lightmap, a luz ambiente e
+ * a das luzes fixas vêm dele (ver Lightmap).
+ */
+#ifndef STATICBATCH_H
+#define STATICBATCH_H
+
+#include "GameObject.h"
+#include "Vector.h"
+#include "TextureManager.h"
+#include "LightBaker.h"
+#include <vector>
+#include <GL/glut.h>
+
+class Wall;
+
+/**
+ * @brief Um vértice de geometria estática.
+ *
+ * (s, t) são coordenadas dentro de uma repetição do material, em [0, 1]; elas só
+ * viram coordenadas do atlas na hora de desenhar (ver emitVertices).
+ */
+struct StaticVertex {
+    Vector3f position;
+    Vector3f normal;
+    float s, t;
+};
+
+class StaticBatch : public GameObject {
+public:
+    StaticBatch();
+
+    /** @brief Inclui a parede no lote. A parede não pode mudar depois disso. */
+    void addWall(const Wall* wall);
+    bool isEmpty() const;
+
+    /** @brief Entrega ao LightBaker um quadrilátero por vez de cada parede, na ordem do lote. */
+    void collectBakeSurfaces(std::vector<BakeSurface>& out);
+    /** @brief Usa o lightmap calculado com as superfícies de collectBakeSurfaces. */
+    void setLightmap(Lightmap* lightmap);
+
+    void update(float deltaTime, GameStateManager& gameStateManager) override {}
+    /** @brief Um único item, desenhado depois dos objetos da sala (que ficam na frente das paredes). */
+    void collectDrawItems(RenderPacket& packet) override;
+    void draw(const DrawItem& item) override;
+    BoundingBox getBoundingBox() const override;
+
+    /**
+     * @brief Emite vértices de quadriláteros (dentro de glBegin(GL_QUADS)).
+     * @param vertices Os vértices, quatro por quadrilátero.
+     * @param region A área do material no atlas.
+     * @param transform Matriz aplicada às posições e normais, ou nullptr.
+     * @param lightmap Se informado, o material vai para a unidade de textura 1 e a
+     * área de cada quadrilátero no lightmap para a unidade 0.
+     * @param firstSurface A superfície do lightmap do primeiro quadrilátero.
+     */
+    static void emitVertices(const std::vector<StaticVertex>& vertices, const MaterialRegion& region,
+                             const Matrix4* transform, const Lightmap* lightmap = nullptr, int firstSurface = 0);
+
+private:
+    void build(bool baked);
+
+    std::vector<const Wall*> _walls;
+    GLuint _list;
+    unsigned int _atlasVersion; ///< Versão do atlas usada na display list.
+    Lightmap* _lightmap;
+    int _firstSurface;
+    bool _listBaked;            ///< Se a display list tem as coordenadas do lightmap.
+};
+
+#endif // STATICBATCH_H
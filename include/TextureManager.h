@@ -3,15 +3,62 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <GL/glut.h>
 
+/**
+ * @brief A área de um material dentro do atlas, em coordenadas de textura.
+ *
+ * Uma coordenada (s, t) em [0, 1] do material corresponde a
+ * (u0 + s·(u1 - u0), v0 + t·(v1 - v0)) no atlas.
+ */
+struct MaterialRegion {
+    float u0, v0, u1, v1;
+};
+
 class TextureManager {
 public:
     static GLuint loadTexture(const std::string& filename); // carrega ou retorna existente
     static void clear(); // limpa todas as texturas carregadas
 
+    // --- Atlas de materiais ---
+    // As texturas das paredes são empacotadas numa única textura (o atlas), para que
+    // materiais diferentes possam ser desenhados sem trocar de textura. Cada arquivo
+    // recebe um ID de material; o material 0 é branco (sem textura).
+
+    /** @brief O ID de material de um arquivo de textura; registra o arquivo na primeira vez. */
+    static int getMaterial(const std::string& filename);
+
+    /** @brief O atlas com todos os materiais registrados, (re)montado se preciso. Thread de OpenGL. */
+    static GLuint getAtlasTexture();
+
+    /** @brief A área do material no atlas (válida depois de getAtlasTexture). */
+    static MaterialRegion getMaterialRegion(int material);
+
+    /** @brief Muda sempre que o atlas é remontado (as áreas dos materiais podem mudar). */
+    static unsigned int getAtlasVersion();
+
+    static const int FILTER_TIERS = 3;
+    /**
+     * @brief Filtragem do atlas (ver QualityGovernor): 2 trilinear, 1 bilinear no mipmap
+     * mais próximo, 0 como o 1 mas a partir do segundo mipmap (viés de +1 nível, um
+     * quarto dos texels lidos). Thread de OpenGL.
+     */
+    static void setFilterTier(int tier);
+
 private:
+    static void buildAtlas();
+    static void applyFilter();
+
     static std::unordered_map<std::string, GLuint> _textures; // mapa: arquivo -> ID da textura
+
+    static std::unordered_map<std::string, int> _materialIds; // mapa: arquivo -> ID do material
+    static std::vector<std::string> _materialFiles;          // arquivo de cada material
+    static std::vector<MaterialRegion> _materialRegions;
+    static GLuint _atlas;
+    static bool _atlasDirty;
+    static unsigned int _atlasVersion;
+    static int _filterTier;
 };
 
 #endif // TEXTUREMANAGER_H
@@ -0,0 +1,133 @@
+/**
+ * @file TimerWheel.h
+ * @brief Define o TimerWheel, um agendador de callbacks atrasados e repetitivos
+ * guiado pelo relógio da simulação.
+ *
+ * Os timers ficam numa roda hierárquica: 4 níveis de 64 posições, com resolução de
+ * 1 ms no primeiro nível e 64 vezes maior em cada nível seguinte (alcance de ~4,6 h;
+ * atrasos maiores são reencaixados ao chegar no último nível). Cada posição é uma
+ * lista duplamente ligada de índices, então agendar e cancelar custam O(1). A cada
+ * milissegundo só a posição atual do primeiro nível é visitada; os níveis de cima
+ * descem ("cascateiam") para os de baixo quando o relógio vira a sua posição.
+ *
+ * Timers que vencem no mesmo milissegundo disparam na ordem em que foram agendados,
+ * o que torna a execução reprodutível num replay com os mesmos passos de simulação.
+ */
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * @class TimerWheel
+ * @brief Roda hierárquica de timers.
+ *
+ * Deve ser usada apenas pela thread de simulação.
+ */
+class TimerWheel {
+public:
+    typedef uint64_t TimerId;
+    typedef std::function<void()> Callback;
+
+    /** @brief Identificador que nunca corresponde a um timer. */
+    static const TimerId INVALID_TIMER = 0;
+
+    TimerWheel();
+
+    /**
+     * @brief Agenda um callback para daqui a `delayMs` milissegundos de simulação.
+     * @param delayMs O atraso (mínimo 1 ms: nunca dispara no passo atual).
+     * @param callback A função a chamar.
+     * @return O identificador do timer, para cancelar.
+     */
+    TimerId schedule(uint32_t delayMs, Callback callback);
+
+    /**
+     * @brief Agenda um callback que se repete a cada `intervalMs` milissegundos.
+     *
+     * O timer continua ativo até ser cancelado (inclusive de dentro do próprio callback).
+     *
+     * @param intervalMs O intervalo (mínimo 1 ms).
+     * @param callback A função a chamar.
+     * @return O identificador do timer.
+     */
+    TimerId scheduleRepeating(uint32_t intervalMs, Callback callback);
+
+    /**
+     * @brief Cancela um timer pendente.
+     * @param id O identificador retornado por schedule.
+     * @return false se o timer já disparou (e não se repete) ou foi cancelado.
+     */
+    bool cancel(TimerId id);
+
+    /** @brief Indica se o timer ainda vai disparar. */
+    bool isPending(TimerId id) const;
+
+    /**
+     * @brief Avança o relógio e dispara os timers vencidos.
+     *
+     * Não faz nada enquanto a roda estiver pausada. Sem timers pendentes, só o
+     * relógio avança.
+     *
+     * @param deltaTime O tempo decorrido (em ms).
+     */
+    void advance(float deltaTime);
+
+    /** @brief Pausa ou retoma o relógio; timers pausados não perdem o tempo restante. */
+    void setPaused(bool paused);
+    bool isPaused() const;
+
+    /** @brief O tempo de simulação acumulado, em ms. */
+    uint64_t getTime() const;
+
+    /** @brief Número de timers pendentes. */
+    size_t getPendingCount() const;
+
+    /** @brief Quantos callbacks já dispararam, para saber se algum disparou num passo. */
+    uint64_t getFiredCount() const;
+
+private:
+    static const int LEVELS = 4;
+    static const int SLOT_BITS = 6;
+    static const int SLOTS = 1 << SLOT_BITS;
+
+    /** @brief Onde o timer está: numa posição da roda, disparando ou livre. */
+    enum { FREE = -1, FIRING = -2 };
+
+    struct Timer {
+        uint64_t due;         ///< Instante (ms) em que dispara.
+        uint64_t sequence;    ///< Ordem de agendamento, para desempates.
+        uint32_t interval;    ///< 0 para timers de disparo único.
+        uint32_t generation;  ///< Invalida identificadores antigos quando a entrada é reutilizada.
+        int slot;             ///< Posição na roda (nível * SLOTS + índice), FREE ou FIRING.
+        int prev;
+        int next;
+        Callback callback;
+    };
+
+    TimerId add(uint32_t delayMs, uint32_t interval, Callback callback);
+    int find(TimerId id) const;
+    void insert(int index);
+    void unlink(int index);
+    void release(int index);
+    void cascade(int level, int slot);
+    void tick();
+
+    std::vector<Timer> _timers;
+    std::vector<int> _freeList;
+    int _heads[LEVELS * SLOTS];
+    int _tails[LEVELS * SLOTS];
+    std::vector<std::pair<uint64_t, int>> _firing; ///< (sequência, índice) do milissegundo atual.
+    uint64_t _now;
+    float _fraction;     ///< Fração de milissegundo ainda não contada.
+    uint64_t _sequence;
+    size_t _pending;
+    uint64_t _fired;
+    bool _paused;
+};
+
+#endif // TIMERWHEEL_H
@@ -0,0 +1,69 @@
+/**
+ * @file Transform.h
+ * @brief Define o Transform, a posição, rotação e escala de um objeto com a matriz
+ * de mundo guardada em cache.
+ *
+ * A matriz só é recalculada quando algum valor muda (ou quando o pai muda), então
+ * objetos parados custam apenas uma cópia de 16 floats por quadro. Os setters
+ * ignoram valores iguais aos atuais, de forma que objetos animados que chegaram
+ * ao destino também deixam de recalcular.
+ *
+ * Objetos compostos (ex.: PuzzleDoor, Sign) ligam as transformações das suas peças
+ * à do objeto com setParent; a matriz de mundo de uma peça é Pai * Local.
+ */
+#ifndef TRANSFORM_H
+#define TRANSFORM_H
+
+#include "VectorMath.h"
+#include <cstdint>
+
+/**
+ * @class Transform
+ * @brief Translação * Rotação * Escala, com a matriz de mundo em cache.
+ *
+ * Deve ser usado apenas pela thread de simulação (a matriz é copiada para o
+ * DrawItem em collectDrawItems).
+ */
+class Transform {
+public:
+    Transform();
+    explicit Transform(const Vector3f& position, const Vector3f& scale = {1.0f, 1.0f, 1.0f});
+
+    void setPosition(const Vector3f& position);
+    void setRotation(const Quaternion& rotation);
+    /** @brief Rotação em torno de Y, em graus (como glRotatef(angle, 0, 1, 0)). */
+    void setRotationY(float degrees);
+    void setScale(const Vector3f& scale);
+
+    const Vector3f& getPosition() const { return _position; }
+    const Quaternion& getRotation() const { return _rotation; }
+    const Vector3f& getScale() const { return _scale; }
+
+    /**
+     * @brief Define a transformação pai. O pai deve viver mais que este Transform.
+     * @param parent O pai, ou nullptr para uma transformação em coordenadas de mundo.
+     */
+    void setParent(const Transform* parent);
+    const Transform* getParent() const { return _parent; }
+
+    /** @brief A matriz de mundo, recalculada apenas se algo mudou desde a última chamada. */
+    const Matrix4& getWorldMatrix() const;
+
+    /** @brief Translação * Rotação * Escala, sem o pai (calculada a cada chamada). */
+    Matrix4 getLocalMatrix() const;
+    /** @brief A origem deste Transform em coordenadas de mundo. */
+    Vector3f getWorldPosition() const;
+
+private:
+    Vector3f _position;
+    Quaternion _rotation;
+    Vector3f _scale;
+    const Transform* _parent;
+
+    mutable Matrix4 _world;
+    mutable bool _dirty;
+    mutable uint32_t _version;       ///< Incrementada a cada recálculo da matriz de mundo.
+    mutable uint32_t _parentVersion; ///< Versão do pai usada no último recálculo.
+};
+
+#endif // TRANSFORM_H
@@ -0,0 +1,120 @@
+/**
+ * @file TriggerSystem.h
+ * @brief Define o TriggerSystem, que detecta quando objetos entram, permanecem ou
+ * saem de volumes de gatilho (encaixes de formas, placas de pressão).
+ *
+ * Os volumes ficam numa grade uniforme no plano XZ. Objetos rastreados só são
+ * testados quando se movem (ou são desativados): um objeto parado não custa nada,
+ * e cada movimento só é comparado com os volumes das células que ele ocupa.
+ */
+#ifndef TRIGGERSYSTEM_H
+#define TRIGGERSYSTEM_H
+
+#include "Vector.h"
+#include <unordered_map>
+#include <vector>
+
+class GameObject;
+class GameStateManager;
+
+/** @brief Tipos de evento de gatilho. */
+enum class TriggerEvent {
+    ENTER, ///< O objeto passou a sobrepor o volume.
+    STAY,  ///< O objeto se moveu, mas continua dentro do volume.
+    EXIT   ///< O objeto deixou o volume (ou foi desativado).
+};
+
+/**
+ * @class TriggerListener
+ * @brief Interface de quem possui um volume de gatilho.
+ *
+ * A sala registra automaticamente o volume de qualquer objeto que implemente
+ * esta interface.
+ */
+class TriggerListener {
+public:
+    virtual ~TriggerListener() {}
+
+    /** @brief O volume (fixo) monitorado pelo objeto. */
+    virtual BoundingBox getTriggerVolume() const = 0;
+
+    /**
+     * @brief Recebe um evento. Chamado na fase serial da atualização da sala.
+     * @param event O tipo do evento.
+     * @param other O objeto que causou o evento (nullptr para o jogador).
+     * @param gameStateManager O gerenciador de estado do jogo.
+     */
+    virtual void onTriggerEvent(TriggerEvent event, GameObject* other, GameStateManager& gameStateManager) = 0;
+};
+
+/**
+ * @class TriggerSystem
+ * @brief Fase ampla (grade uniforme) e despacho de eventos dos gatilhos de uma sala.
+ */
+class TriggerSystem {
+public:
+    TriggerSystem();
+
+    /**
+     * @brief Registra um volume de gatilho.
+     * @param volume O volume, que não muda depois de registrado.
+     * @param listener Quem recebe os eventos do volume.
+     */
+    void addTrigger(const BoundingBox& volume, TriggerListener* listener);
+
+    /**
+     * @brief Começa a rastrear um objeto.
+     * @param owner O objeto (nullptr representa o jogador).
+     * @return O identificador usado em moveTracked e disableTracked.
+     */
+    int addTracked(GameObject* owner);
+
+    /**
+     * @brief Informa a caixa atual de um objeto rastreado.
+     * Só marca o objeto para teste se a caixa mudou ou ele estava desativado.
+     */
+    void moveTracked(int handle, const BoundingBox& bounds);
+
+    /**
+     * @brief Desativa um objeto rastreado; ele sai de todos os volumes no próximo despacho.
+     */
+    void disableTracked(int handle);
+
+    /**
+     * @brief Testa os objetos marcados e envia os eventos das mudanças.
+     *
+     * Os ouvintes podem mover ou desativar objetos, mas não registrar objetos ou
+     * volumes novos durante o despacho.
+     *
+     * @param gameStateManager Repassado aos ouvintes.
+     */
+    void dispatch(GameStateManager& gameStateManager);
+
+private:
+    struct Trigger {
+        BoundingBox volume;
+        TriggerListener* listener;
+    };
+
+    struct Tracked {
+        GameObject* owner;
+        BoundingBox bounds;
+        bool active;
+        bool dirty;
+        std::vector<int> inside; ///< Volumes que o objeto sobrepõe, em ordem crescente.
+    };
+
+    long long cellKey(int x, int z) const;
+    int cellCoord(float value) const;
+    void gatherCandidates(const BoundingBox& bounds, std::vector<int>& out) const;
+
+    std::vector<Trigger> _triggers;
+    std::vector<Tracked> _tracked;
+    std::vector<int> _dirty;
+    std::unordered_map<long long, std::vector<int> > _cells; ///< Célula da grade -> volumes que a tocam.
+    std::vector<int> _scratch;
+    std::vector<int> _pending; ///< Os marcados sendo despachados (troca de lugar com _dirty).
+    std::vector<int> _before;  ///< Os volumes de um objeto antes do despacho.
+};
+
+#endif // TRIGGERSYSTEM_H
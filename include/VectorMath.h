@@ -0,0 +1,139 @@
+/**
+ * @file VectorMath.h
+ * @brief Operações de vetores (Vector3f, Vector4f), matrizes 4x4, quatérnios e
+ * núcleos em lote (raio contra esferas, transformação de pontos).
+ *
+ * As operações de um único vetor são inline e escalares. Os núcleos em lote
+ * processam quatro elementos por vez com SSE (x86) ou NEON (AArch64), escolhidos
+ * na compilação; definir JOGO3D_NO_SIMD força a versão escalar em qualquer
+ * plataforma. Todas as versões produzem os mesmos resultados (a menos de
+ * arredondamento).
+ */
+#ifndef VECTORMATH_H
+#define VECTORMATH_H
+
+#include "Vector.h"
+#include "Ray.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(JOGO3D_NO_SIMD) && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+    #define JOGO3D_SIMD_SSE 1
+#elif !defined(JOGO3D_NO_SIMD) && defined(__ARM_NEON) && defined(__aarch64__)
+    #define JOGO3D_SIMD_NEON 1
+#endif
+
+// --- VECTOR3F ---
+
+inline Vector3f operator+(const Vector3f& a, const Vector3f& b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+inline Vector3f operator-(const Vector3f& a, const Vector3f& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+inline Vector3f operator-(const Vector3f& v) { return {-v.x, -v.y, -v.z}; }
+inline Vector3f operator*(const Vector3f& v, float s) { return {v.x * s, v.y * s, v.z * s}; }
+inline Vector3f operator*(float s, const Vector3f& v) { return {v.x * s, v.y * s, v.z * s}; }
+inline Vector3f operator/(const Vector3f& v, float s) { return {v.x / s, v.y / s, v.z / s}; }
+inline Vector3f& operator+=(Vector3f& a, const Vector3f& b) { a.x += b.x; a.y += b.y; a.z += b.z; return a; }
+inline Vector3f& operator-=(Vector3f& a, const Vector3f& b) { a.x -= b.x; a.y -= b.y; a.z -= b.z; return a; }
+inline Vector3f& operator*=(Vector3f& v, float s) { v.x *= s; v.y *= s; v.z *= s; return v; }
+
+/** @brief Produto escalar. */
+inline float dot(const Vector3f& a, const Vector3f& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+/** @brief Produto vetorial (regra da mão direita). */
+inline Vector3f cross(const Vector3f& a, const Vector3f& b) {
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+inline float lengthSquared(const Vector3f& v) { return dot(v, v); }
+inline float length(const Vector3f& v) { return std::sqrt(dot(v, v)); }
+
+/** @brief Vetor de comprimento 1 na mesma direção; o vetor nulo continua nulo. */
+inline Vector3f normalize(const Vector3f& v) {
+    float len = length(v);
+    return (len > 0.0f) ? v / len : Vector3f{0.0f, 0.0f, 0.0f};
+}
+
+// --- VECTOR4F, MATRIZ E QUATÉRNIO ---
+
+struct Vector4f {
+    float x, y, z, w;
+};
+
+/**
+ * @brief Matriz 4x4 em ordem coluna-maior, como o OpenGL (pode ir direto para glMultMatrixf).
+ */
+struct Matrix4 {
+    float m[16];
+
+    static Matrix4 identity();
+    static Matrix4 translation(const Vector3f& t);
+    static Matrix4 scale(const Vector3f& s);
+    /** @brief Rotação em torno de Y, em graus (como glRotatef(angle, 0, 1, 0)). */
+    static Matrix4 rotationY(float degrees);
+    /** @brief Projeção perspectiva, como gluPerspective. */
+    static Matrix4 perspective(float fovYDegrees, float aspect, float zNear, float zFar);
+    /** @brief Matriz de visão, como gluLookAt. */
+    static Matrix4 lookAt(const Vector3f& eye, const Vector3f& center, const Vector3f& up);
+
+    Matrix4 operator*(const Matrix4& other) const;
+    Vector3f transformPoint(const Vector3f& p) const;
+    Vector3f transformDirection(const Vector3f& d) const;
+    Vector4f transform(const Vector4f& v) const;
+};
+
+/**
+ * @brief Quatérnio unitário para rotações.
+ */
+struct Quaternion {
+    float x, y, z, w;
+
+    static Quaternion identity() { return {0.0f, 0.0f, 0.0f, 1.0f}; }
+    /** @brief Rotação de `degrees` em torno do eixo (normalizado internamente). */
+    static Quaternion fromAxisAngle(const Vector3f& axis, float degrees);
+
+    Quaternion operator*(const Quaternion& q) const;
+    Vector3f rotate(const Vector3f& v) const;
+    Matrix4 toMatrix() const;
+    Quaternion normalized() const;
+};
+
+/**
+ * @brief Os seis planos de um volume de visão, com normais apontando para dentro.
+ *
+ * Um ponto p está do lado de dentro de um plano (a, b, c, d) se a·x + b·y + c·z + d >= 0.
+ */
+struct Frustum {
+    Vector4f planes[6];
+
+    /** @brief Extrai os planos de uma matriz projeção * visão (Gribb/Hartmann). */
+    static Frustum fromMatrix(const Matrix4& viewProjection);
+};
+
+// --- NÚCLEOS EM LOTE ---
+
+namespace VectorMath {
+    /** @brief Nome do conjunto de instruções em uso: "SSE", "NEON" ou "escalar". */
+    const char* simdBackend();
+
+    /**
+     * @brief Interseção de um raio com uma esfera.
+     * @return A distância (em unidades da direção) até a primeira superfície, que é
+     * negativa se a origem estiver dentro da esfera; -1 se o raio não a atingir ou se
+     * a esfera estiver toda atrás da origem.
+     */
+    float raySphere(const Ray& ray, const Vector3f& center, float radius);
+
+    /**
+     * @brief raySphere para várias esferas, guardadas em vetores separados por componente.
+     * @param out Recebe `count` distâncias, com a mesma convenção de raySphere.
+     */
+    void raySphereBatch(const Ray& ray, const float* centerX, const float* centerY, const float* centerZ,
+                        const float* radius, size_t count, float* out);
+
+    /**
+     * @brief Aplica uma matriz a vários pontos (w = 1). `in` e `out` podem ser o mesmo vetor.
+     */
+    void transformPoints(const Matrix4& matrix, const Vector3f* in, Vector3f* out, size_t count);
+}
+
+#endif // VECTORMATH_H
@@ -3,6 +3,9 @@
 
 #include "GameObject.h"
 #include "Vector.h"
+#include "Transform.h"
+#include "StaticBatch.h"
+#include <vector>
 #include <string>
 #include <GL/freeglut.h>
 
@@ -13,13 +16,23 @@ public:
     Wall(const Vector3f& position, const Vector3f& size);
 
     virtual void update(float deltaTime, GameStateManager& gameStateManager) override;
-    virtual void render() override;
+    virtual void collectDrawItems(RenderPacket& packet) override;
+    virtual void draw(const DrawItem& item) override;
     virtual BoundingBox getBoundingBox() const override;
 
+    /** @brief O material da parede no atlas do TextureManager (0 = sem textura). */
+    int getMaterial() const { return _material; }
+    /** @brief Os quadriláteros da parede, em coordenadas locais. */
+    const std::vector<StaticVertex>& getGeometry() const { return _geometry; }
+    const Matrix4& getWorldMatrix() const { return _transform.getWorldMatrix(); }
+
 private:
-    Vector3f _position;
+    void buildGeometry();
+
+    Transform _transform;
     Vector3f _size;
-    GLuint _textureID = 0; // ID da textura OpenGL
+    int _material; // ID do material no atlas
+    std::vector<StaticVertex> _geometry;
 };
 
 #endif // WALL_H
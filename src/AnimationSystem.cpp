@@ -0,0 +1,198 @@
+/**
+ * @file AnimationSystem.cpp
+ * @brief Implementação do AnimationSystem, as transições de valores em estrutura de vetores.
+ */
+
+#include "../include/AnimationSystem.h"
+#include <algorithm>
+
+/**
+ * @brief Coeficientes do polinômio e(t) = a·t + b·t² + c·t³ de cada curva.
+ *
+ * Escrever as curvas como polinômios deixa o laço de update igual para todas
+ * as transições, sem um switch por elemento.
+ */
+static void curveCoefficients(Ease ease, float& a, float& b, float& c) {
+    switch (ease) {
+        case Ease::LINEAR: a = 1.0f; b = 0.0f;  c = 0.0f;  break;
+        case Ease::OUT:    a = 2.0f; b = -1.0f; c = 0.0f;  break; // 1 - (1 - t)²
+        default:           a = 0.0f; b = 3.0f;  c = -2.0f; break; // 3t² - 2t³
+    }
+}
+
+/**
+ * @brief Anima um valor do seu estado atual até `to`.
+ * @param value O valor animado.
+ * @param to O valor final.
+ * @param durationMs A duração, em milissegundos.
+ * @param ease A curva de aceleração.
+ * @param onComplete Chamado ao fim da transição.
+ */
+void AnimationSystem::animate(float* value, float to, float durationMs, Ease ease, Callback onComplete) {
+    if (durationMs <= 0.0f) {
+        cancel(value);
+        *value = to;
+        if (onComplete) onComplete();
+        return;
+    }
+
+    float a, b, c;
+    curveCoefficients(ease, a, b, c);
+
+    auto it = _indexOf.find(value);
+    size_t i;
+    if (it != _indexOf.end()) {
+        i = it->second;
+    } else {
+        i = _targets.size();
+        _targets.push_back(value);
+        _from.push_back(0.0f);
+        _delta.push_back(0.0f);
+        _elapsed.push_back(0.0f);
+        _invDuration.push_back(0.0f);
+        _curveA.push_back(0.0f);
+        _curveB.push_back(0.0f);
+        _curveC.push_back(0.0f);
+        _values.push_back(0.0f);
+        _callbacks.push_back(nullptr);
+        _indexOf[value] = i;
+    }
+
+    _from[i] = *value;
+    _delta[i] = to - *value;
+    _elapsed[i] = 0.0f;
+    _invDuration[i] = 1.0f / durationMs;
+    _curveA[i] = a;
+    _curveB[i] = b;
+    _curveC[i] = c;
+    _callbacks[i] = onComplete;
+}
+
+/**
+ * @brief Anima as três componentes de um vetor.
+ *
+ * São três transições independentes; só a da componente Z leva o callback,
+ * já que as três terminam no mesmo passo.
+ */
+void AnimationSystem::animate(Vector3f* value, const Vector3f& to, float durationMs, Ease ease, Callback onComplete) {
+    animate(&value->x, to.x, durationMs, ease);
+    animate(&value->y, to.y, durationMs, ease);
+    animate(&value->z, to.z, durationMs, ease, onComplete);
+}
+
+/**
+ * @brief Interrompe a animação de um valor, mantendo-o onde está.
+ * @param value O valor animado.
+ */
+void AnimationSystem::cancel(float* value) {
+    auto it = _indexOf.find(value);
+    if (it != _indexOf.end()) {
+        removeAt(it->second);
+    }
+}
+
+/**
+ * @brief Interrompe a animação das três componentes de um vetor.
+ * @param value O vetor animado.
+ */
+void AnimationSystem::cancel(Vector3f* value) {
+    cancel(&value->x);
+    cancel(&value->y);
+    cancel(&value->z);
+}
+
+/**
+ * @brief Indica se o valor está sendo animado.
+ * @param value O valor.
+ * @return true se houver uma transição ativa para ele.
+ */
+bool AnimationSystem::isAnimating(const float* value) const {
+    return _indexOf.find(value) != _indexOf.end();
+}
+
+/**
+ * @brief Remove a transição i, movendo a última para o seu lugar.
+ * @param index A posição da transição.
+ */
+void AnimationSystem::removeAt(size_t index) {
+    size_t last = _targets.size() - 1;
+    _indexOf.erase(_targets[index]);
+    if (index != last) {
+        _targets[index] = _targets[last];
+        _from[index] = _from[last];
+        _delta[index] = _delta[last];
+        _elapsed[index] = _elapsed[last];
+        _invDuration[index] = _invDuration[last];
+        _curveA[index] = _curveA[last];
+        _curveB[index] = _curveB[last];
+        _curveC[index] = _curveC[last];
+        _values[index] = _values[last];
+        _callbacks[index] = std::move(_callbacks[last]);
+        _indexOf[_targets[index]] = index;
+    }
+    _targets.pop_back();
+    _from.pop_back();
+    _delta.pop_back();
+    _elapsed.pop_back();
+    _invDuration.pop_back();
+    _curveA.pop_back();
+    _curveB.pop_back();
+    _curveC.pop_back();
+    _values.pop_back();
+    _callbacks.pop_back();
+}
+
+/**
+ * @brief Avança todas as transições, retira as concluídas e chama os seus callbacks.
+ *
+ * O primeiro laço só lê e escreve vetores contíguos de float e pode ser
+ * vetorizado pelo compilador. Os alvos são atualizados num segundo laço, já que
+ * escrever através de ponteiros impediria a vetorização.
+ *
+ * @param deltaTime O tempo decorrido (em ms).
+ */
+void AnimationSystem::update(float deltaTime) {
+    const size_t count = _targets.size();
+    if (count == 0) return;
+
+    float* elapsed = _elapsed.data();
+    const float* invDuration = _invDuration.data();
+    const float* from = _from.data();
+    const float* delta = _delta.data();
+    const float* curveA = _curveA.data();
+    const float* curveB = _curveB.data();
+    const float* curveC = _curveC.data();
+    float* values = _values.data();
+
+    for (size_t i = 0; i < count; ++i) {
+        elapsed[i] += deltaTime;
+        float t = std::min(elapsed[i] * invDuration[i], 1.0f);
+        values[i] = from[i] + delta[i] * (t * (curveA[i] + t * (curveB[i] + t * curveC[i])));
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        *_targets[i] = values[i];
+    }
+
+    // Retira as concluídas de trás para frente (removeAt traz a última para o lugar).
+    for (size_t i = count; i-- > 0;) {
+        if (_elapsed[i] * _invDuration[i] >= 1.0f) {
+            if (_callbacks[i]) _finished.push_back(std::move(_callbacks[i]));
+            removeAt(i);
+        }
+    }
+
+    // Callbacks por último: eles podem iniciar novas transições (animate e cancel
+    // não mexem em _finished).
+    for (Callback& callback : _finished) {
+        callback();
+    }
+    _finished.clear();
+}
+
+/**
+ * @brief Número de transições ativas.
+ */
+size_t AnimationSystem::getActiveCount() const {
+    return _targets.size();
+}
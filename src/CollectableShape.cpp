@@ -0,0 +1,129 @@
+/**
+ * @file CollectableShape.cpp
+ * @brief Implementação da classe CollectableShape, uma forma que pode ser carregada e solta.
+ */
+
+#include "../include/CollectableShape.h"
+#include "../include/MeshManager.h"
+#include <GL/freeglut.h>
+#include <iostream>
+
+/**
+ * @brief Construtor da classe CollectableShape.
+ *
+ * A esfera usa um corpo esférico; o cubo e a pirâmide usam uma caixa.
+ *
+ * @param position A posição inicial da forma.
+ * @param shapeType O tipo de forma (e de item no inventário).
+ * @param color A cor da forma.
+ */
+CollectableShape::CollectableShape(const Vector3f& position, ItemType shapeType, const Vector3f& color)
+    : InteractableObject(position), _shapeType(shapeType), _color(color), _size(0.25f), _isCarried(false), _lod(0) {
+    if (shapeType == ItemType::FORMA_ESFERA) {
+        _body = RigidBody::makeSphere(position, _size, 1.0f);
+    } else {
+        _body = RigidBody::makeBox(position, {_size, _size, _size}, 1.0f);
+    }
+}
+
+/**
+ * @brief Mantém a posição de interação igual à do corpo rígido.
+ * @param deltaTime O tempo decorrido desde o último quadro.
+ * @param gameStateManager O gerenciador de estado do jogo.
+ */
+void CollectableShape::update(float deltaTime, GameStateManager& gameStateManager) {
+    if (!_isCarried) {
+        _position = _body.position;
+    }
+}
+
+/**
+ * @brief Registra a forma no pacote do quadro, se ela estiver no chão.
+ * @param packet O pacote do quadro sendo montado pela simulação.
+ */
+void CollectableShape::collectDrawItems(RenderPacket& packet) {
+    if (_isCarried) return;
+    _transform.setPosition(_body.position);
+    DrawItem item(this, _transform);
+    item.color = _color;
+    _lod = MeshManager::selectLod(packet.camera.position, _body.position, _size, _lod);
+    item.lod = _lod;
+    packet.items.push_back(item);
+}
+
+/**
+ * @brief Desenha a forma a partir de um item do pacote.
+ * @param item O item com a posição capturada na simulação.
+ */
+void CollectableShape::draw(const DrawItem& item) {
+    glColor3f(item.color.x, item.color.y, item.color.z);
+
+    switch (_shapeType) {
+        case ItemType::FORMA_ESFERA:
+            MeshManager::drawSphere(_size, item.lod);
+            break;
+        case ItemType::FORMA_PIRAMIDE:
+            // Um cone de 4 lados, com a base apoiada no fundo da caixa de colisão.
+            glTranslatef(0.0f, -_size, 0.0f);
+            glRotatef(-90.0f, 1.0f, 0.0f, 0.0f);
+            glRotatef(45.0f, 0.0f, 0.0f, 1.0f);
+            glutSolidCone(_size * 1.41f, _size * 2.0f, 4, 1);
+            break;
+        default:
+            glutSolidCube(_size * 2.0f);
+            break;
+    }
+}
+
+/**
+ * @brief Pega a forma: ela vai para o inventário e sai da simulação física.
+ * @param gameStateManager O gerenciador de estado do jogo.
+ */
+void CollectableShape::onClick(GameStateManager& gameStateManager) {
+    if (_isCarried) return;
+
+    std::cout << "Forma coletada!" << std::endl;
+    _isCarried = true;
+    _body.enabled = false;
+    setInteractable(false);
+    gameStateManager.addItemToInventory(_shapeType);
+}
+
+/**
+ * @brief Solta a forma carregada.
+ *
+ * O corpo volta à simulação, parado, na posição indicada; a gravidade cuida
+ * de assentá-lo.
+ *
+ * @param position Onde a forma reaparece.
+ * @param gameStateManager O gerenciador de estado do jogo.
+ */
+void CollectableShape::dropAt(const Vector3f& position, GameStateManager& gameStateManager) {
+    if (!_isCarried) return;
+
+    gameStateManager.removeItemFromInventory(_shapeType);
+    _isCarried = false;
+    _position = position;
+    _body.position = position;
+    _body.velocity = {0.0f, 0.0f, 0.0f};
+    _body.enabled = true;
+    _body.wake();
+    setInteractable(true);
+}
+
+/**
+ * @brief Obtém o raio de colisão (para a interação por raio).
+ * @return Um raio um pouco maior que a forma.
+ */
+float CollectableShape::getCollisionRadius() const {
+    return _size * 1.5f;
+}
+
+/**
+ * @brief Obtém a caixa delimitadora da forma.
+ * @return A caixa do corpo rígido, ou uma caixa vazia enquanto a forma é carregada.
+ */
+BoundingBox CollectableShape::getBoundingBox() const {
+    if (_isCarried) return {{0,0,0}, {0,0,0}};
+    return _body.getBounds();
+}
@@ -0,0 +1,242 @@
+/**
+ * @file Collision.cpp
+ * @brief Implementação da varredura de cápsula contra AABB e do deslizamento.
+ */
+
+#include "../include/Collision.h"
+#include "../include/Config.h"
+#include "../include/VectorMath.h"
+#include <cmath>
+
+// --- FUNÇÕES AUXILIARES ---
+
+/**
+ * @brief Calcula o raio do círculo que a cápsula projeta no plano XZ na altura da caixa.
+ *
+ * Se o segmento da cápsula cruza a faixa Y da caixa, é o próprio raio. Se não,
+ * apenas uma tampa pode tocar a caixa, e o raio efetivo encolhe com a distância
+ * vertical até ela.
+ *
+ * @param capsule A cápsula.
+ * @param box A caixa.
+ * @param radius Recebe o raio efetivo.
+ * @return false se a cápsula não alcança a caixa em Y.
+ */
+static bool effectiveRadius(const Capsule& capsule, const BoundingBox& box, float& radius) {
+    float segmentMin = capsule.center.y - capsule.halfHeight;
+    float segmentMax = capsule.center.y + capsule.halfHeight;
+
+    float gap = 0.0f;
+    if (segmentMax < box.min.y) gap = box.min.y - segmentMax;
+    else if (segmentMin > box.max.y) gap = segmentMin - box.max.y;
+
+    if (gap >= capsule.radius) return false;
+    radius = std::sqrt(capsule.radius * capsule.radius - gap * gap);
+    return true;
+}
+
+/**
+ * @brief Interseção de um raio 2D com um círculo, para t em [0, 1].
+ */
+static bool rayCircle(float px, float pz, float dx, float dz, float cx, float cz, float radius, float& t) {
+    float mx = px - cx;
+    float mz = pz - cz;
+    float a = dx * dx + dz * dz;
+    float b = mx * dx + mz * dz;
+    float c = mx * mx + mz * mz - radius * radius;
+    float discriminant = b * b - a * c;
+    if (a <= 0.0f || discriminant < 0.0f) return false;
+
+    t = (-b - std::sqrt(discriminant)) / a;
+    return t >= 0.0f && t <= 1.0f;
+}
+
+// --- IMPLEMENTAÇÃO DAS CONSULTAS ---
+
+/**
+ * @brief Verifica a colisão entre duas caixas delimitadoras (Bounding Boxes).
+ * @param a A primeira BoundingBox.
+ * @param b A segunda BoundingBox.
+ * @return Retorna 'true' se as caixas se sobrepõem, 'false' caso contrário.
+ */
+bool checkCollision(const BoundingBox& a, const BoundingBox& b) {
+    return (a.min.x < b.max.x && a.max.x > b.min.x) &&
+           (a.min.y < b.max.y && a.max.y > b.min.y) &&
+           (a.min.z < b.max.z && a.max.z > b.min.z);
+}
+
+/**
+ * @brief Varre a cápsula ao longo de um deslocamento horizontal contra uma caixa.
+ *
+ * No plano XZ o problema vira um raio (o centro da cápsula) contra um retângulo
+ * de cantos arredondados. Primeiro o raio é testado contra o retângulo expandido
+ * pelo raio; se a entrada cair numa região de canto, o teste é refeito contra o
+ * círculo daquele canto.
+ *
+ * @param capsule A cápsula na posição inicial.
+ * @param motion O deslocamento (X e Z).
+ * @param box A caixa a testar.
+ * @param hit Preenchido com o instante e a normal do contato.
+ * @return true se houver contato dentro do deslocamento.
+ */
+bool Collision::sweepCapsule(const Capsule& capsule, const Vector3f& motion, const BoundingBox& box, SweepHit& hit) {
+    float radius;
+    if (!effectiveRadius(capsule, box, radius)) return false;
+
+    const float px = capsule.center.x;
+    const float pz = capsule.center.z;
+    const float dx = motion.x;
+    const float dz = motion.z;
+
+    // Já encostado ou sobreposto: só é contato se o movimento for para dentro.
+    float closestX = std::fmax(box.min.x, std::fmin(px, box.max.x));
+    float closestZ = std::fmax(box.min.z, std::fmin(pz, box.max.z));
+    const Vector3f offset = {px - closestX, 0.0f, pz - closestZ};
+    float distanceSq = lengthSquared(offset);
+    if (distanceSq < radius * radius) {
+        if (distanceSq <= 0.0f) return false; // centro dentro da caixa: cabe ao pushOut
+        const Vector3f normal = offset / std::sqrt(distanceSq);
+        if (dot(motion, normal) >= 0.0f) return false;
+        hit.time = 0.0f;
+        hit.normal = normal;
+        return true;
+    }
+
+    // Raio contra o retângulo expandido (teste de faixas).
+    const float lo[2] = {box.min.x - radius, box.min.z - radius};
+    const float hi[2] = {box.max.x + radius, box.max.z + radius};
+    const float p[2] = {px, pz};
+    const float d[2] = {dx, dz};
+
+    float tEnter = 0.0f;
+    float tExit = 1.0f;
+    int hitAxis = -1;
+    for (int axis = 0; axis < 2; ++axis) {
+        if (std::fabs(d[axis]) < 1e-8f) {
+            if (p[axis] < lo[axis] || p[axis] > hi[axis]) return false;
+            continue;
+        }
+        float t1 = (lo[axis] - p[axis]) / d[axis];
+        float t2 = (hi[axis] - p[axis]) / d[axis];
+        if (t1 > t2) { float tmp = t1; t1 = t2; t2 = tmp; }
+        if (t1 > tEnter) { tEnter = t1; hitAxis = axis; }
+        if (t2 < tExit) tExit = t2;
+        if (tEnter > tExit) return false;
+    }
+
+    // Sem entrada por uma faixa (hitAxis < 0), o centro já começa no retângulo
+    // expandido, com q = p: só pode estar no quadrado de um canto, fora do círculo
+    // (o caso de já encostar foi tratado acima), e o contato é com esse círculo.
+    float qx = px + dx * tEnter;
+    float qz = pz + dz * tEnter;
+    bool outsideX = qx < box.min.x || qx > box.max.x;
+    bool outsideZ = qz < box.min.z || qz > box.max.z;
+
+    if (outsideX && outsideZ) {
+        // Região de canto: o contato, se houver, é com o círculo deste canto.
+        float cornerX = (qx < box.min.x) ? box.min.x : box.max.x;
+        float cornerZ = (qz < box.min.z) ? box.min.z : box.max.z;
+        float t;
+        if (!rayCircle(px, pz, dx, dz, cornerX, cornerZ, radius, t)) return false;
+        hit.time = t;
+        hit.normal = normalize(Vector3f{px + dx * t - cornerX, 0.0f, pz + dz * t - cornerZ});
+        return true;
+    }
+    if (hitAxis < 0) return false;
+
+    hit.time = tEnter;
+    hit.normal = {0.0f, 0.0f, 0.0f};
+    if (hitAxis == 0) hit.normal.x = (dx > 0.0f) ? -1.0f : 1.0f;
+    else hit.normal.z = (dz > 0.0f) ? -1.0f : 1.0f;
+    return true;
+}
+
+/**
+ * @brief Empurra a cápsula horizontalmente para fora da caixa, se estiver sobreposta.
+ *
+ * Usa o ponto da caixa mais próximo do centro; se o centro estiver dentro da
+ * caixa, sai pela face mais próxima.
+ *
+ * @param capsule A cápsula, atualizada no lugar.
+ * @param box A caixa.
+ * @return true se a cápsula foi movida.
+ */
+bool Collision::pushOut(Capsule& capsule, const BoundingBox& box) {
+    float radius;
+    if (!effectiveRadius(capsule, box, radius)) return false;
+
+    Vector3f& c = capsule.center;
+    float closestX = std::fmax(box.min.x, std::fmin(c.x, box.max.x));
+    float closestZ = std::fmax(box.min.z, std::fmin(c.z, box.max.z));
+    const Vector3f offset = {c.x - closestX, 0.0f, c.z - closestZ};
+    float distanceSq = lengthSquared(offset);
+    if (distanceSq >= radius * radius) return false;
+
+    if (distanceSq > 0.0f) {
+        float distance = std::sqrt(distanceSq);
+        float push = radius - distance + Config::COLLISION_SKIN;
+        c += offset * (push / distance);
+        return true;
+    }
+
+    // Centro dentro da caixa: sai pela face de menor penetração.
+    float toMinX = c.x - box.min.x;
+    float toMaxX = box.max.x - c.x;
+    float toMinZ = c.z - box.min.z;
+    float toMaxZ = box.max.z - c.z;
+    float best = std::fmin(std::fmin(toMinX, toMaxX), std::fmin(toMinZ, toMaxZ));
+    float push = best + radius + Config::COLLISION_SKIN;
+    if (best == toMinX) c.x -= push;
+    else if (best == toMaxX) c.x += push;
+    else if (best == toMinZ) c.z -= push;
+    else c.z += push;
+    return true;
+}
+
+/**
+ * @brief Move a cápsula pelo deslocamento, deslizando pelas superfícies atingidas.
+ *
+ * A cada iteração, encontra o primeiro contato entre todas as caixas, avança até
+ * ele (mantendo uma pequena folga) e remove do deslocamento restante a componente
+ * na direção da normal. Em cantos, a segunda superfície zera o que sobrou.
+ *
+ * @param capsule A cápsula na posição inicial.
+ * @param motion O deslocamento desejado (X e Z).
+ * @param colliders As caixas estáticas da sala.
+ * @return A posição final do centro da cápsula.
+ */
+Vector3f Collision::moveAndSlide(const Capsule& capsule, const Vector3f& motion, const std::vector<BoundingBox>& colliders) {
+    Capsule moving = capsule;
+    for (const BoundingBox& box : colliders) {
+        pushOut(moving, box);
+    }
+
+    Vector3f remaining = {motion.x, 0.0f, motion.z};
+    for (int i = 0; i < Config::COLLISION_MAX_SLIDES; ++i) {
+        if (lengthSquared(remaining) < 1e-12f) break;
+
+        SweepHit nearest = {1.0f, {0.0f, 0.0f, 0.0f}};
+        bool found = false;
+        for (const BoundingBox& box : colliders) {
+            SweepHit hit;
+            if (sweepCapsule(moving, remaining, box, hit) && (!found || hit.time < nearest.time)) {
+                nearest = hit;
+                found = true;
+            }
+        }
+
+        if (!found) {
+            moving.center += remaining;
+            break;
+        }
+
+        // As normais são horizontais, então o Y do centro não muda.
+        moving.center += remaining * nearest.time + nearest.normal * Config::COLLISION_SKIN;
+
+        // Desliza: o que sobrou do deslocamento, sem a componente contra a superfície.
+        remaining *= 1.0f - nearest.time;
+        remaining -= nearest.normal * dot(remaining, nearest.normal);
+    }
+
+    return moving.center;
+}
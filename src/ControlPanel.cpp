@@ -8,19 +8,17 @@
 #include <GL/freeglut.h>
 #include <iostream>
 
-/**
- * @brief Objeto visual esttico para representar o painel de controle.
- *
- * O objeto  um 'PrimitiveObject' do tipo 'SPHERE' (esfera)
- * com posies, cores e brilho predefinidos.
- */
-static PrimitiveObject visual(PrimitiveShape::SPHERE, {0,0,0}, {0.1f, 0.1f, 0.8f}, {0.8f, 0.8f, 0.1f});
-
 /**
  * @brief Construtor da classe ControlPanel.
+ *
+ * O visual  um 'PrimitiveObject' do tipo 'SPHERE' (esfera) com
+ * cor e escala predefinidas, j posicionado no lugar do painel.
+ *
  * @param position Posio do painel de controle no espao 3D.
  */
-ControlPanel::ControlPanel(const Vector3f& position) : InteractableObject(position) {}
+ControlPanel::ControlPanel(const Vector3f& position)
+    : InteractableObject(position),
+      _visual(PrimitiveShape::SPHERE, position, {0.1f, 0.1f, 0.8f}, {0.8f, 0.8f, 0.1f}) {}
 
 /**
  * @brief Atualiza o estado do painel de controle.
@@ -36,16 +34,11 @@ void ControlPanel::update(float deltaTime, GameStateManager& gameStateManager) {
 }
 
 /**
- * @brief Renderiza o painel de controle no ambiente 3D.
- *
- * Usa as funes glPushMatrix e glPopMatrix para isolar as transformaes
- * de renderizao do painel, garantindo que elas no afetem outros objetos.
+ * @brief Registra o visual do painel no pacote do quadro.
+ * @param packet O pacote do quadro sendo montado pela simulao.
  */
-void ControlPanel::render() {
-    glPushMatrix();
-    glTranslatef(_position.x, _position.y, _position.z);
-    visual.render();
-    glPopMatrix();
+void ControlPanel::collectDrawItems(RenderPacket& packet) {
+    _visual.collectDrawItems(packet);
 }
 
 /**
@@ -6,7 +6,9 @@
 #include "../include/CubePuzzle.h"
 #include "../include/GameStateManager.h"
 #include "../include/GameObject.h"
+#include "../include/CubeSolver.h"
 #include <iostream>
+#include <random>
 
 /**
  * @brief Obtém a Bounding Box (caixa delimitadora) que engloba todos os cubos do quebra-cabeça.
@@ -34,7 +36,8 @@ BoundingBox CubePuzzle::getBoundingBox() const {
  * @brief Construtor da classe CubePuzzle.
  *
  * O construtor inicializa a matriz de cubos, criando novas instâncias de RotatingCube
- * com base nos parâmetros fornecidos.
+ * com base nos parâmetros fornecidos. Os cubos devem ser adicionados à mesma sala
+ * que o quebra-cabeça, que passa a ser a dona deles.
  *
  * @param rows O número de linhas de cubos no quebra-cabeça.
  * @param cols O número de colunas de cubos no quebra-cabeça.
@@ -42,60 +45,64 @@ BoundingBox CubePuzzle::getBoundingBox() const {
  * @param spacing O espaçamento entre os cubos.
  * @param cubeSize O tamanho de cada cubo individual.
  * @param puzzleId Um identificador único para o quebra-cabeça.
+ * @param scrambleMoves Quantas jogadas aleatórias embaralham o tabuleiro (a dificuldade).
  */
-CubePuzzle::CubePuzzle(int rows, int cols, const Vector3f& startPos, float spacing, float cubeSize, const std::string& puzzleId)
+CubePuzzle::CubePuzzle(int rows, int cols, const Vector3f& startPos, float spacing, float cubeSize, const std::string& puzzleId, int scrambleMoves)
     : _rows(rows), _cols(cols), _puzzleId(puzzleId) {
+    // O tabuleiro é embaralhado com jogadas válidas, então sempre tem solução.
+    std::vector<int> board = CubeSolver::generate(rows, cols, scrambleMoves, std::random_device()());
+
     _cubes.resize(rows);
     for (int i = 0; i < rows; ++i) {
         _cubes[i].resize(cols);
         for (int j = 0; j < cols; ++j) {
             Vector3f pos = {startPos.x + j * spacing, startPos.y, startPos.z + i * spacing};
             _cubes[i][j] = new RotatingCube(pos, cubeSize, i, j, this);
+            _cubes[i][j]->setRotationState(board[i * cols + j]);
+            if (board[i * cols + j] != 0) ++_unsolvedCount;
         }
     }
+
+    std::cout << "Puzzle dos cubos " << rows << "x" << cols << " gerado (" << scrambleMoves << " jogadas de embaralhamento)." << std::endl;
 }
 
 /**
  * @brief Destrutor da classe CubePuzzle.
  *
- * O destrutor é responsável por liberar a memória alocada para cada cubo,
- * evitando vazamentos de memória.
+ * Os cubos são adicionados à sala junto com o quebra-cabeça, e é a sala que
+ * os atualiza, desenha e libera. Por isso o destrutor não os deleta.
  */
-CubePuzzle::~CubePuzzle() {
-    for (auto& row : _cubes)
-        for (auto* cube : row)
-            delete cube;
-}
+CubePuzzle::~CubePuzzle() {}
 
 /**
- * @brief Atualiza o estado de todos os cubos no quebra-cabeça.
+ * @brief Fase paralela da atualização.
+ *
+ * Os cubos são atualizados pela própria sala. Como jogadas alteram vários
+ * cubos de uma vez, elas ficam para a fase serial (commit).
+ *
  * @param deltaTime O tempo decorrido desde o último quadro.
  * @param gameStateManager A classe que gerencia o estado do jogo.
  */
-void CubePuzzle::update(float deltaTime, GameStateManager& gameStateManager) {
-    // Atualiza cada cubo individualmente
-    for (auto& row : _cubes)
-        for (auto* cube : row)
-            cube->update(deltaTime, gameStateManager);
-
-    // Chama a função de verificação a cada frame.
-    checkSolution(gameStateManager);
-}
+void CubePuzzle::update(float deltaTime, GameStateManager& gameStateManager) {}
 
 /**
- * @brief Renderiza todos os cubos no quebra-cabeça.
+ * @brief Fase serial: aplica as jogadas pendentes e verifica a solução.
+ * @param gameStateManager A classe que gerencia o estado do jogo.
  */
-void CubePuzzle::render() {
-    for (auto& row : _cubes)
-        for (auto* cube : row)
-            cube->render();
+void CubePuzzle::commit(GameStateManager& gameStateManager) {
+    for (const auto& click : _pendingClicks) {
+        applyMove(click.first, click.second, gameStateManager.getAnimationSystem());
+    }
+    _pendingClicks.clear();
+
+    checkSolution(gameStateManager);
 }
 
 /**
- * @brief Manipula o clique em um cubo específico.
+ * @brief Registra o clique em um cubo específico.
  *
- * Este método implementa a lógica do quebra-cabeça, rotacionando o cubo clicado
- * e os cubos adjacentes (superior, inferior, esquerdo e direito).
+ * A jogada altera o cubo clicado e seus vizinhos, então ela é apenas
+ * enfileirada aqui e aplicada na fase de commit da sala.
  *
  * @param row A linha do cubo clicado.
  * @param col A coluna do cubo clicado.
@@ -103,31 +110,59 @@ void CubePuzzle::render() {
 void CubePuzzle::onCubeClicked(int row, int col) {
     if (_solved) return; // Não faz nada se já estiver resolvido
     if (row < 0 || row >= _rows || col < 0 || col >= _cols) return;
-    _cubes[row][col]->rotate();
-    if (col > 0) _cubes[row][col - 1]->rotate();
-    if (col < _cols - 1) _cubes[row][col + 1]->rotate();
-    if (row > 0) _cubes[row - 1][col]->rotate();
-    if (row < _rows - 1) _cubes[row + 1][col]->rotate();
-    // Checa solução após cada jogada
-    // O GameStateManager deve ser passado de fora, então usa um ponteiro temporário se necessário
-    // Aqui, apenas marca para checar na próxima update
-    _solved = false;
+    _pendingClicks.push_back(std::make_pair(row, col));
+}
+
+/**
+ * @brief Aplica uma jogada: rotaciona o cubo e os adjacentes (superior, inferior, esquerdo e direito).
+ *
+ * Também atualiza a contagem de cubos fora do estado 0, para que a verificação
+ * da solução não precise percorrer o tabuleiro.
+ *
+ * @param row A linha do cubo clicado.
+ * @param col A coluna do cubo clicado.
+ * @param animations O sistema que anima as rotações.
+ */
+void CubePuzzle::applyMove(int row, int col, AnimationSystem* animations) {
+    if (_solved) return;
+    auto rotate = [this, animations](RotatingCube* cube) {
+        if (cube->getRotationState() == 0) ++_unsolvedCount;
+        cube->rotate(animations);
+        if (cube->getRotationState() == 0) --_unsolvedCount;
+    };
+    rotate(_cubes[row][col]);
+    if (col > 0) rotate(_cubes[row][col - 1]);
+    if (col < _cols - 1) rotate(_cubes[row][col + 1]);
+    if (row > 0) rotate(_cubes[row - 1][col]);
+    if (row < _rows - 1) rotate(_cubes[row + 1][col]);
+}
+
+/**
+ * @brief Calcula quantas vezes clicar em cada cubo para resolver o tabuleiro atual.
+ * @param presses Recebe, linha a linha, o número de cliques (0..3) de cada cubo.
+ * @return false se o tabuleiro não tiver solução.
+ */
+bool CubePuzzle::findSolution(std::vector<int>& presses) const {
+    std::vector<int> board(_rows * _cols);
+    for (int i = 0; i < _rows; ++i)
+        for (int j = 0; j < _cols; ++j)
+            board[i * _cols + j] = _cubes[i][j]->getRotationState();
+    return CubeSolver::solve(board, _rows, _cols, presses);
 }
 
 /**
  * @brief Verifica se o quebra-cabeça foi resolvido.
  *
  * O quebra-cabeça é considerado resolvido quando todos os cubos
- * estão no seu estado de rotação inicial (estado 0). Se resolvido,
- * o estado do jogo é atualizado.
+ * estão no seu estado de rotação inicial (estado 0), ou seja, quando a
+ * contagem mantida por applyMove chega a zero. Se resolvido, o estado
+ * do jogo é atualizado.
  *
  * @param gameStateManager A classe que gerencia o estado do jogo.
  */
 void CubePuzzle::checkSolution(GameStateManager& gameStateManager) {
-    for (auto& row : _cubes)
-        for (auto* cube : row)
-            if (cube->getRotationState() != 0.0f)
-                return;
+    if (_unsolvedCount != 0)
+        return;
     // Se chegou aqui, está resolvido
     if (!_solved) {
         gameStateManager.setPuzzleState(_puzzleId, true);
@@ -0,0 +1,237 @@
+/**
+ * @file CubeSolver.cpp
+ * @brief Implementação do resolvedor (sistema linear em Z/4) e do gerador de tabuleiros.
+ */
+
+#include "../include/CubeSolver.h"
+#include <cstdint>
+#include <random>
+#include <utility>
+
+// --- FUNÇÕES AUXILIARES ---
+
+/**
+ * @brief Lista os cubos afetados por uma jogada na célula indicada (ela e os vizinhos).
+ * @param out Recebe até 5 índices.
+ * @return Quantos índices foram escritos.
+ */
+static int crossCells(int rows, int cols, int cell, int out[5]) {
+    int row = cell / cols;
+    int col = cell % cols;
+    int count = 0;
+    out[count++] = cell;
+    if (col > 0) out[count++] = cell - 1;
+    if (col < cols - 1) out[count++] = cell + 1;
+    if (row > 0) out[count++] = cell - cols;
+    if (row < rows - 1) out[count++] = cell + cols;
+    return count;
+}
+
+/**
+ * @brief Calcula A·v nos inteiros (sem redução), onde A é a matriz da jogada em cruz.
+ *
+ * A é simétrica: o cubo e é afetado exatamente pelas jogadas na cruz de e.
+ */
+static std::vector<int> multiplyCross(const std::vector<int>& v, int rows, int cols) {
+    std::vector<int> out(v.size(), 0);
+    int cells[5];
+    for (int e = 0; e < static_cast<int>(v.size()); ++e) {
+        int count = crossCells(rows, cols, e, cells);
+        for (int k = 0; k < count; ++k) out[e] += v[cells[k]];
+    }
+    return out;
+}
+
+typedef std::vector<std::vector<uint64_t>> BitRows;
+
+static bool getBit(const std::vector<uint64_t>& row, int column) {
+    return (row[column >> 6] >> (column & 63)) & 1u;
+}
+
+static void setBit(std::vector<uint64_t>& row, int column) {
+    row[column >> 6] |= uint64_t(1) << (column & 63);
+}
+
+/**
+ * @brief Resolve M·x = b sobre Z/2 por eliminação de Gauss-Jordan.
+ *
+ * Cada linha guarda os coeficientes nas colunas 0..columns-1 e o termo
+ * independente na coluna `columns`.
+ *
+ * @param matrix As linhas do sistema (alteradas).
+ * @param columns O número de incógnitas.
+ * @param solution Recebe uma solução, com as variáveis livres em 0.
+ * @param kernel Se não for nulo, recebe uma base do núcleo de M.
+ * @return false se o sistema for impossível.
+ */
+static bool solveMod2(BitRows& matrix, int columns, std::vector<int>& solution, std::vector<std::vector<int>>* kernel) {
+    const int rowCount = static_cast<int>(matrix.size());
+    std::vector<int> pivotColumns;
+    int pivotRow = 0;
+
+    for (int column = 0; column < columns && pivotRow < rowCount; ++column) {
+        int found = -1;
+        for (int r = pivotRow; r < rowCount; ++r) {
+            if (getBit(matrix[r], column)) { found = r; break; }
+        }
+        if (found < 0) continue;
+        std::swap(matrix[found], matrix[pivotRow]);
+
+        const std::vector<uint64_t>& pivot = matrix[pivotRow];
+        for (int r = 0; r < rowCount; ++r) {
+            if (r != pivotRow && getBit(matrix[r], column)) {
+                for (size_t w = 0; w < pivot.size(); ++w) matrix[r][w] ^= pivot[w];
+            }
+        }
+        pivotColumns.push_back(column);
+        ++pivotRow;
+    }
+
+    for (int r = pivotRow; r < rowCount; ++r) {
+        if (getBit(matrix[r], columns)) return false; // 0 = 1
+    }
+
+    solution.assign(columns, 0);
+    std::vector<bool> isPivot(columns, false);
+    for (int r = 0; r < pivotRow; ++r) {
+        solution[pivotColumns[r]] = getBit(matrix[r], columns);
+        isPivot[pivotColumns[r]] = true;
+    }
+
+    if (kernel) {
+        kernel->clear();
+        for (int free = 0; free < columns; ++free) {
+            if (isPivot[free]) continue;
+            std::vector<int> vector(columns, 0);
+            vector[free] = 1;
+            for (int r = 0; r < pivotRow; ++r) {
+                if (getBit(matrix[r], free)) vector[pivotColumns[r]] = 1;
+            }
+            kernel->push_back(vector);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Monta as linhas de A (mod 2) com espaço para colunas extras e o termo independente.
+ */
+static BitRows crossRows(int rows, int cols, int extraColumns) {
+    const int n = rows * cols;
+    const int words = (n + extraColumns + 1 + 63) / 64;
+    BitRows matrix(n, std::vector<uint64_t>(words, 0));
+    int cells[5];
+    for (int e = 0; e < n; ++e) {
+        int count = crossCells(rows, cols, e, cells);
+        for (int k = 0; k < count; ++k) setBit(matrix[e], cells[k]);
+    }
+    return matrix;
+}
+
+// --- RESOLVEDOR E GERADOR ---
+
+/**
+ * @brief Aplica uma jogada (o cubo e os vizinhos giram 90°) a um tabuleiro.
+ * @param state O tabuleiro, alterado no lugar.
+ * @param rows O número de linhas.
+ * @param cols O número de colunas.
+ * @param row A linha da jogada.
+ * @param col A coluna da jogada.
+ */
+void CubeSolver::applyMove(std::vector<int>& state, int rows, int cols, int row, int col) {
+    int cells[5];
+    int count = crossCells(rows, cols, row * cols + col, cells);
+    for (int k = 0; k < count; ++k) state[cells[k]] = (state[cells[k]] + 1) % 4;
+}
+
+/**
+ * @brief Encontra um conjunto de jogadas que resolve o tabuleiro.
+ *
+ * Escrevendo x = x0 + Σ tᵢ·kᵢ + 2y, onde x0 resolve o sistema módulo 2 e os kᵢ
+ * formam o núcleo de A módulo 2, a condição módulo 4 vira um segundo sistema
+ * sobre Z/2 nas incógnitas (y, t):
+ *
+ *     A·y + Σ tᵢ·(A·kᵢ / 2) ≡ (b - A·x0) / 2   (mod 2)
+ *
+ * onde b = -s. As divisões são exatas porque A·kᵢ e b - A·x0 são pares.
+ *
+ * @param state O tabuleiro (valores em 0..3).
+ * @param rows O número de linhas.
+ * @param cols O número de colunas.
+ * @param presses Recebe quantas vezes (0..3) cada cubo deve ser clicado.
+ * @return false se o tabuleiro não tiver solução.
+ */
+bool CubeSolver::solve(const std::vector<int>& state, int rows, int cols, std::vector<int>& presses) {
+    const int n = rows * cols;
+    if (n <= 0 || static_cast<int>(state.size()) != n) return false;
+
+    std::vector<int> target(n);
+    for (int e = 0; e < n; ++e) target[e] = (4 - ((state[e] % 4) + 4) % 4) % 4;
+
+    // Etapa 1: A·x0 ≡ b (mod 2).
+    BitRows low = crossRows(rows, cols, 0);
+    for (int e = 0; e < n; ++e) {
+        if (target[e] & 1) setBit(low[e], n);
+    }
+    std::vector<int> x0;
+    std::vector<std::vector<int>> kernel;
+    if (!solveMod2(low, n, x0, &kernel)) return false;
+
+    // Etapa 2: o bit alto, com os vetores do núcleo como incógnitas extras.
+    const int d = static_cast<int>(kernel.size());
+    BitRows high = crossRows(rows, cols, d);
+    std::vector<int> ax0 = multiplyCross(x0, rows, cols);
+    for (int e = 0; e < n; ++e) {
+        if (((target[e] - ax0[e]) / 2) & 1) setBit(high[e], n + d);
+    }
+    for (int i = 0; i < d; ++i) {
+        std::vector<int> ak = multiplyCross(kernel[i], rows, cols);
+        for (int e = 0; e < n; ++e) {
+            if ((ak[e] / 2) & 1) setBit(high[e], n + i);
+        }
+    }
+    std::vector<int> yt;
+    if (!solveMod2(high, n + d, yt, nullptr)) return false;
+
+    presses.assign(n, 0);
+    for (int e = 0; e < n; ++e) {
+        int value = x0[e] + 2 * yt[e];
+        for (int i = 0; i < d; ++i) value += yt[n + i] * kernel[i][e];
+        presses[e] = value % 4;
+    }
+    return true;
+}
+
+/**
+ * @brief Gera um tabuleiro com solução garantida, embaralhando o tabuleiro resolvido.
+ * @param rows O número de linhas.
+ * @param cols O número de colunas.
+ * @param moves Quantas jogadas aleatórias aplicar.
+ * @param seed A semente do gerador.
+ * @return O tabuleiro gerado.
+ */
+std::vector<int> CubeSolver::generate(int rows, int cols, int moves, unsigned int seed) {
+    const int n = rows * cols;
+    std::vector<int> state(n > 0 ? n : 0, 0);
+    if (n <= 0) return state;
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+
+    auto scramble = [&]() {
+        int cell = pick(rng);
+        applyMove(state, rows, cols, cell / cols, cell % cols);
+    };
+    for (int i = 0; i < moves; ++i) scramble();
+
+    // Jogadas que se anularam podem deixar o tabuleiro já resolvido.
+    for (;;) {
+        bool solved = true;
+        for (int value : state) {
+            if (value != 0) { solved = false; break; }
+        }
+        if (!solved) break;
+        scramble();
+    }
+    return state;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file DebugDraw.cpp
+ * @brief Implementação do DebugDraw: fila de linhas e textos e o desenho em lote.
+ */
+
+#include "../include/DebugDraw.h"
+#include "../include/Overlay.h"
+#include "../include/Config.h"
+#include <GL/freeglut.h>
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+
+std::atomic<bool> DebugDraw::_enabled(Config::DEBUG_DRAW_ENABLED);
+std::vector<DebugVertex> DebugDraw::_lines;
+std::vector<DebugText> DebugDraw::_texts;
+
+/** @brief Protege a fila: objetos atualizados em paralelo (JobSystem) podem enfileirar formas. */
+static std::mutex s_queueMutex;
+
+bool DebugDraw::isEnabled() {
+    return _enabled;
+}
+
+void DebugDraw::setEnabled(bool enabled) {
+    _enabled = enabled;
+}
+
+void DebugDraw::toggle() {
+    _enabled = !_enabled;
+}
+
+/** @brief Acrescenta um vértice (a fila já deve estar travada). */
+void DebugDraw::push(const Vector3f& p, const Vector3f& color, float alpha) {
+    auto channel = [](float value) { return static_cast<uint8_t>(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f); };
+    _lines.push_back({p.x, p.y, p.z, channel(color.x), channel(color.y), channel(color.z), channel(alpha)});
+}
+
+void DebugDraw::line(const Vector3f& a, const Vector3f& b, const Vector3f& color, float alpha) {
+    if (!_enabled) return;
+    std::lock_guard<std::mutex> lock(s_queueMutex);
+    push(a, color, alpha);
+    push(b, color, alpha);
+}
+
+void DebugDraw::box(const BoundingBox& box, const Vector3f& color, float alpha) {
+    if (!_enabled) return;
+
+    // Canto i: bit 0 escolhe x, bit 1 escolhe y, bit 2 escolhe z (0 = min, 1 = max).
+    static const int EDGES[12][2] = {
+        {0, 1}, {2, 3}, {4, 5}, {6, 7},  // ao longo de x
+        {0, 2}, {1, 3}, {4, 6}, {5, 7},  // ao longo de y
+        {0, 4}, {1, 5}, {2, 6}, {3, 7}   // ao longo de z
+    };
+    auto corner = [&box](int i) {
+        return Vector3f{(i & 1) ? box.max.x : box.min.x, (i & 2) ? box.max.y : box.min.y, (i & 4) ? box.max.z : box.min.z};
+    };
+
+    std::lock_guard<std::mutex> lock(s_queueMutex);
+    for (const auto& edge : EDGES) {
+        push(corner(edge[0]), color, alpha);
+        push(corner(edge[1]), color, alpha);
+    }
+}
+
+void DebugDraw::sphere(const Vector3f& center, float radius, const Vector3f& color, float alpha) {
+    if (!_enabled) return;
+
+    const int segments = Config::DEBUG_SPHERE_SEGMENTS;
+    std::lock_guard<std::mutex> lock(s_queueMutex);
+    for (int i = 0; i < segments; ++i) {
+        const float a0 = 2.0f * 3.1415926535f * i / segments;
+        const float a1 = 2.0f * 3.1415926535f * (i + 1) / segments;
+        const float c0 = radius * std::cos(a0), s0 = radius * std::sin(a0);
+        const float c1 = radius * std::cos(a1), s1 = radius * std::sin(a1);
+        push({center.x + c0, center.y + s0, center.z}, color, alpha);
+        push({center.x + c1, center.y + s1, center.z}, color, alpha);
+        push({center.x + c0, center.y, center.z + s0}, color, alpha);
+        push({center.x + c1, center.y, center.z + s1}, color, alpha);
+        push({center.x, center.y + c0, center.z + s0}, color, alpha);
+        push({center.x, center.y + c1, center.z + s1}, color, alpha);
+    }
+}
+
+void DebugDraw::text(const Vector3f& position, const std::string& text, const Vector3f& color) {
+    if (!_enabled) return;
+    std::lock_guard<std::mutex> lock(s_queueMutex);
+    _texts.push_back({position, text, color});
+}
+
+/**
+ * @brief Troca os vetores da fila com os do pacote (que já estão vazios), de forma
+ * que a memória dos dois lados é reaproveitada nos quadros seguintes.
+ */
+void DebugDraw::collect(RenderPacket& packet) {
+    std::lock_guard<std::mutex> lock(s_queueMutex);
+    packet.debugLines.swap(_lines);
+    packet.debugTexts.swap(_texts);
+    _lines.clear();
+    _texts.clear();
+}
+
+/**
+ * @brief Desenha todas as linhas com uma chamada, sem iluminação e sem teste de
+ * profundidade (as caixas das paredes coincidem com as próprias paredes).
+ */
+void DebugDraw::draw(const RenderPacket& packet) {
+    if (packet.debugLines.empty()) return;
+
+    glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_CURRENT_BIT);
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_LIGHTING);
+    glDisable(GL_TEXTURE_2D);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    const GLsizei stride = sizeof(DebugVertex);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(3, GL_FLOAT, stride, &packet.debugLines[0].x);
+    glColorPointer(4, GL_UNSIGNED_BYTE, stride, &packet.debugLines[0].r);
+    glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(packet.debugLines.size()));
+
+    glPopClientAttrib();
+    glPopAttrib();
+}
+
+void DebugDraw::addLabels(const RenderPacket& packet, const Matrix4& view, Overlay& overlay) {
+    if (packet.debugTexts.empty()) return;
+
+    Matrix4 projection;
+    glGetFloatv(GL_PROJECTION_MATRIX, projection.m);
+    const Matrix4 viewProjection = projection * view;
+
+    for (const DebugText& label : packet.debugTexts) {
+        const Vector4f clip = viewProjection.transform({label.position.x, label.position.y, label.position.z, 1.0f});
+        if (clip.w <= 0.0f) continue; // atrás da câmera
+
+        const float x = (clip.x / clip.w * 0.5f + 0.5f) * Config::SCREEN_WIDTH;
+        const float y = (clip.y / clip.w * 0.5f + 0.5f) * Config::SCREEN_HEIGHT;
+        overlay.addCenteredText(label.text, x, y, label.color);
+    }
+}
@@ -24,6 +24,8 @@ Door::Door(const Vector3f& position, int targetRoomIndex, const Vector3f& spawnP
       _requiredPuzzleId("")
 {
     _collisionRadius = 1.5f;
+    _isPortal = false;
+    _isOpen = false;
 }
 
 /**
@@ -42,6 +44,8 @@ Door::Door(const Vector3f& position, int targetRoomIndex, const Vector3f& spawnP
       _requiredPuzzleId("")
 {
     _collisionRadius = 1.5f;
+    _isPortal = false;
+    _isOpen = false;
 }
 
 /**
@@ -60,10 +64,17 @@ Door::Door(const Vector3f& position, int targetRoomIndex, const Vector3f& spawnP
       _requiredPuzzleId("")
 {
     _collisionRadius = 1.5f;
+    _isPortal = false;
+    _isOpen = false;
 }
 
 /**
  * @brief Construtor da classe Door para portas que requerem um puzzle resolvido.
+ *
+ * O identificador tambm pode ser o de uma trava (ex.: PuzzleID::Porta_Sala3), que
+ * as regras em res/rules/puzzles.txt abrem com a ao "unlock". Assim os requisitos
+ * da porta podem mudar sem recompilar o jogo.
+ *
  * @param position A posio da porta no espao 3D.
  * @param targetRoomIndex O ndice da sala para a qual a porta leva.
  * @param spawnPosition A posio do jogador ao entrar na sala de destino.
@@ -77,6 +88,8 @@ Door::Door(const Vector3f& position, int targetRoomIndex, const Vector3f& spawnP
       _requiredPuzzleId(requiredPuzzleId)
 {
     _collisionRadius = 1.5f;
+    _isPortal = false;
+    _isOpen = false;
 }
 
 /**
@@ -114,18 +127,34 @@ bool Door::canBeOpenedBy(const GameStateManager& gameStateManager) const {
 /**
  * @brief Atualiza o estado da porta.
  *
- * Este mtodo  chamado a cada quadro, mas a implementao atual
- * no realiza nenhuma ao.
+ * Portas que so portais verificam se j podem ser abertas; as demais no
+ * fazem nada.
  *
  * @param deltaTime O tempo decorrido desde o ltimo quadro.
  * @param gameStateManager A classe para gerenciar o estado do jogo.
  */
-void Door::update(float deltaTime, GameStateManager& gameStateManager) {}
+void Door::update(float deltaTime, GameStateManager& gameStateManager) {
+    refreshPortal(gameStateManager);
+}
 
 /**
- * @brief Renderiza a porta no ambiente 3D.
+ * @brief Reavalia se o portal est aberto.
+ * @param gameStateManager O gerenciador de estado do jogo, usado para verificar os requisitos.
  */
-void Door::render() { _visual.render(); }
+void Door::refreshPortal(const GameStateManager& gameStateManager) {
+    _isOpen = _isPortal && canBeOpenedBy(gameStateManager);
+}
+
+/**
+ * @brief Registra o visual da porta no pacote do quadro.
+ *
+ * Um portal aberto no tem visual: a sala de destino aparece no lugar da porta.
+ *
+ * @param packet O pacote do quadro sendo montado pela simulao.
+ */
+void Door::collectDrawItems(RenderPacket& packet) {
+    if (!_isOpen) _visual.collectDrawItems(packet);
+}
 
 /**
  * @brief Manipula o evento de clique na porta.
@@ -170,3 +199,40 @@ const std::string& Door::getRequiredPuzzle() const { return _requiredPuzzleId; }
  * @return Um objeto BoundingBox. Atualmente retorna um BoundingBox vazio.
  */
 BoundingBox Door::getBoundingBox() const { return {{0,0,0}, {0,0,0}}; }
+
+/**
+ * @brief Define se a porta funciona como portal.
+ * @param isPortal true para desenhar a sala de destino atravs da porta destrancada.
+ */
+void Door::setPortal(bool isPortal) { _isPortal = isPortal; }
+
+bool Door::isPortalOpen() const { return _isOpen; }
+
+/**
+ * @brief Obtm o quadriltero da abertura da porta.
+ *
+ * A abertura  a face larga do visual da porta; a normal segue o eixo mais fino,
+ * no sentido do centro da sala (as portas ficam encostadas nas paredes).
+ *
+ * @param corners Recebe os cantos, em ordem ao redor do quadriltero.
+ * @param normal Recebe a normal, apontando para dentro da sala.
+ */
+void Door::getPortalQuad(Vector3f corners[4], Vector3f& normal) const {
+    const Vector3f& center = _visual.getTransform().getPosition();
+    const Vector3f& scale = _visual.getTransform().getScale();
+    const Vector3f half = {scale.x * 0.5f, scale.y * 0.5f, scale.z * 0.5f};
+
+    if (scale.z <= scale.x) {
+        normal = {0.0f, 0.0f, (center.z > 0.0f) ? -1.0f : 1.0f};
+        corners[0] = {center.x - half.x, center.y - half.y, center.z};
+        corners[1] = {center.x + half.x, center.y - half.y, center.z};
+        corners[2] = {center.x + half.x, center.y + half.y, center.z};
+        corners[3] = {center.x - half.x, center.y + half.y, center.z};
+    } else {
+        normal = {(center.x > 0.0f) ? -1.0f : 1.0f, 0.0f, 0.0f};
+        corners[0] = {center.x, center.y - half.y, center.z - half.z};
+        corners[1] = {center.x, center.y - half.y, center.z + half.z};
+        corners[2] = {center.x, center.y + half.y, center.z + half.z};
+        corners[3] = {center.x, center.y + half.y, center.z - half.z};
+    }
+}
@@ -0,0 +1,57 @@
+/**
+ * @file DynamicResolution.cpp
+ * @brief Implementação do controlador de resolução dinâmica.
+ */
+
+#include "../include/DynamicResolution.h"
+#include "../include/Config.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+/** @brief Maior mudança da escala num único ajuste. */
+static const float MAX_STEP = 0.15f;
+/** @brief A escala é arredondada para múltiplos deste passo. */
+static const float QUANTUM = 0.05f;
+
+/**
+ * @brief Construtor: começa na resolução cheia, sem quadros medidos.
+ */
+DynamicResolution::DynamicResolution() : _scale(1.0f), _accumulatedMs(0.0f), _frames(0) {}
+
+/**
+ * @brief Registra o tempo de desenho de um quadro e, ao fim de cada intervalo,
+ * reavalia a escala.
+ * @param renderMs O tempo, em ms, da cena até o fim do HUD.
+ * @return true se a escala mudou neste quadro (a cena precisa ser redimensionada);
+ * false no meio do intervalo, dentro da folga ou se o ajuste arredondado for nulo.
+ */
+bool DynamicResolution::addFrame(float renderMs) {
+    _accumulatedMs += renderMs;
+    if (++_frames < Config::DYNAMIC_RESOLUTION_INTERVAL) return false;
+
+    const float average = _accumulatedMs / _frames;
+    _accumulatedMs = 0.0f;
+    _frames = 0;
+
+    const float budget = Config::FRAME_BUDGET_MS;
+    if (average <= 0.0f || std::fabs(average - budget) <= budget * Config::DYNAMIC_RESOLUTION_DEADBAND) return false;
+
+    float target = _scale * std::sqrt(budget / average);
+    target = std::min(std::max(target, _scale - MAX_STEP), _scale + MAX_STEP);
+    target = std::round(target / QUANTUM) * QUANTUM;
+    target = std::min(std::max(target, Config::RENDER_SCALE_MIN), 1.0f);
+    if (std::fabs(target - _scale) < QUANTUM * 0.5f) return false;
+
+    std::cout << "[Resolução] " << average << " ms por quadro: escala " << _scale << " -> " << target << "\n";
+    _scale = target;
+    return true;
+}
+
+/**
+ * @brief Obtém a escala atual da cena.
+ * @return A escala em cada eixo, entre Config::RENDER_SCALE_MIN e 1.
+ */
+float DynamicResolution::getScale() const {
+    return _scale;
+}
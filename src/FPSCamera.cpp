@@ -7,6 +7,7 @@
 #include <GL/freeglut.h>
 #include <cmath> // Para sin, cos
 #include "../include/Config.h"
+#include "../include/VectorMath.h"
 
 // --- Constantes ---
 /**
@@ -69,6 +70,14 @@ const Vector3f& FPSCamera::getRightVector() const {
     return _right;
 }
 
+/**
+ * @brief Obtm o vetor "para cima" da cmera.
+ * @return Uma referncia constante para o vetor "cima".
+ */
+const Vector3f& FPSCamera::getUpVector() const {
+    return _up;
+}
+
 /**
  * @brief Aplica as transformaes de visualizao do OpenGL.
  *
@@ -131,18 +140,11 @@ void FPSCamera::updateCameraVectors() {
     front.z = sin(_yaw * toRadians) * cos(_pitch * toRadians);
 
     // Normaliza o vetor 'front' para garantir que seu comprimento seja 1.
-    float length = sqrt(front.x * front.x + front.y * front.y + front.z * front.z);
-    _front = {front.x / length, front.y / length, front.z / length};
+    _front = normalize(front);
 
     // Recalcula o vetor 'right' usando o Produto Vetorial (Cross Product).
-    _right.x = _front.y * _worldUp.z - _front.z * _worldUp.y;
-    _right.y = _front.z * _worldUp.x - _front.x * _worldUp.z;
-    _right.z = _front.x * _worldUp.y - _front.y * _worldUp.x;
-    length = sqrt(_right.x * _right.x + _right.y * _right.y + _right.z * _right.z);
-    _right = {_right.x / length, _right.y / length, _right.z / length};
+    _right = normalize(cross(_front, _worldUp));
 
     // Recalcula o vetor 'up' da cmera usando o produto vetorial entre 'right' e 'front'.
-    _up.x = _right.y * _front.z - _right.z * _front.y;
-    _up.y = _right.z * _front.x - _right.x * _front.z;
-    _up.z = _right.x * _front.y - _right.y * _front.x;
+    _up = cross(_right, _front);
 }
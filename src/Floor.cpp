@@ -4,16 +4,48 @@
  */
 
 #include "../include/Floor.h"
+#include "../include/MeshManager.h"
+#include "../include/Config.h"
+#include "../include/VectorMath.h"
 #include <GL/freeglut.h>
+#include <algorithm>
+#include <cmath>
+
+/** @brief Refletncia do cho (cinza claro), igual no lightmap e no material. */
+static const float FLOOR_ALBEDO = 0.8f;
 
 /**
  * @brief Construtor da classe Floor.
+ *
+ * O cho  dividido em blocos de at Config::FLOOR_CHUNK_SIZE de lado, para que
+ * cada bloco escolha o seu nvel de detalhe pela distncia at a cmera.
+ *
  * @param position A posio do centro do cho no espao 3D.
  * @param size O tamanho do cho (largura e profundidade) no plano XZ.
  */
-Floor::Floor(const Vector3f& position, const Vector2f& size) {
+Floor::Floor(const Vector3f& position, const Vector2f& size)
+    : _root(position), _lightmap(nullptr), _firstSurface(0) {
     _position = position;
     _size = size;
+
+    int countX = std::max(1, static_cast<int>(std::ceil(size.x / Config::FLOOR_CHUNK_SIZE)));
+    int countZ = std::max(1, static_cast<int>(std::ceil(size.y / Config::FLOOR_CHUNK_SIZE)));
+    _chunkSize = {size.x / countX, size.y / countZ};
+
+    // Reservado antes de ligar os filhos: os blocos no podem mudar de endereo.
+    _chunks.reserve(countX * countZ);
+    for (int i = 0; i < countX; ++i) {
+        for (int j = 0; j < countZ; ++j) {
+            Vector3f center = {
+                -size.x / 2.0f + (i + 0.5f) * _chunkSize.x,
+                0.0f,
+                -size.y / 2.0f + (j + 0.5f) * _chunkSize.y
+            };
+            _chunks.push_back(Transform(center));
+            _chunks.back().setParent(&_root);
+        }
+    }
+    _chunkLods.assign(_chunks.size(), 0);
 }
 
 /**
@@ -29,56 +61,66 @@ void Floor::update(float deltaTime, GameStateManager& gameStateManager) {
 }
 
 /**
- * @brief Renderiza o cho e sua grade visual no ambiente 3D.
- *
- * O processo de renderizao  dividido em duas etapas:
- * 1. Desenho do cho slido com iluminao.
- * 2. Desenho de uma grade visual na superfcie do cho.
+ * @brief Registra cada bloco do cho, com o seu nvel de detalhe, e a grade visual.
+ * @param packet O pacote do quadro sendo montado pela simulao.
  */
-void Floor::render() {
-    // --- ETAPA 1: DESENHAR O CHO SLIDO COM ILUMINAO SUAVE ---
-    glEnable(GL_LIGHTING);
+void Floor::collectDrawItems(RenderPacket& packet) {
+    const float chunkRadius = 0.5f * std::sqrt(_chunkSize.x * _chunkSize.x + _chunkSize.y * _chunkSize.y);
+
+    for (size_t i = 0; i < _chunks.size(); ++i) {
+        _chunkLods[i] = MeshManager::selectLod(packet.camera.position, _chunks[i].getWorldPosition(),
+                                               chunkRadius, _chunkLods[i]);
+        DrawItem item(this, _chunks[i], static_cast<int>(i));
+        item.lod = _chunkLods[i];
+        packet.items.push_back(item);
+    }
+    packet.items.push_back(DrawItem(this, _root, GRID));
+}
 
-    GLfloat floor_diffuse[] = { 0.8f, 0.8f, 0.8f, 1.0f };
-    GLfloat floor_specular[] = { 0.9f, 0.9f, 0.9f, 1.0f };
-    glMaterialfv(GL_FRONT, GL_AMBIENT_AND_DIFFUSE, floor_diffuse);
-    glMaterialfv(GL_FRONT, GL_SPECULAR, floor_specular);
-    glMaterialf(GL_FRONT, GL_SHININESS, 128.0f);
-
-    glNormal3f(0.0f, 1.0f, 0.0f);
-
-    // Mantemos a alta densidade de polgonos para a suavidade da iluminao.
-    int divisions = 70;
-
-    float halfWidth = _size.x / 2.0f;
-    float halfDepth = _size.y / 2.0f;
-    float startX = _position.x - halfWidth;
-    float startZ = _position.z - halfDepth;
-    float segmentWidth = _size.x / divisions;
-    float segmentDepth = _size.y / divisions;
-
-    glBegin(GL_QUADS);
-    for (int i = 0; i < divisions; ++i) {
-        for (int j = 0; j < divisions; ++j) {
-            float currentX = startX + i * segmentWidth;
-            float currentZ = startZ + j * segmentDepth;
-            glVertex3f(currentX, _position.y, currentZ);
-            glVertex3f(currentX, _position.y, currentZ + segmentDepth);
-            glVertex3f(currentX + segmentWidth, _position.y, currentZ + segmentDepth);
-            glVertex3f(currentX + segmentWidth, _position.y, currentZ);
+/**
+ * @brief Desenha um bloco do cho ou a grade visual.
+ *
+ * Os blocos so desenhados com iluminao e subdivididos conforme o nvel de
+ * detalhe (de perto, a alta densidade de polgonos deixa a lanterna suave). Com
+ * lightmap, a luz ambiente e a das luzes fixas vm dele e a cor do material fica
+ * em glColor (o material  s o da lanterna). A grade
+ *  desenhada sem iluminao, um pouco acima da superfcie.
+ *
+ * @param item O item com a pea, a matriz e o nvel de detalhe.
+ */
+void Floor::draw(const DrawItem& item) {
+    if (item.part != GRID) {
+        glEnable(GL_LIGHTING);
+
+        GLfloat floor_diffuse[] = { FLOOR_ALBEDO, FLOOR_ALBEDO, FLOOR_ALBEDO, 1.0f };
+        GLfloat floor_specular[] = { 0.9f, 0.9f, 0.9f, 1.0f };
+        glMaterialfv(GL_FRONT, GL_AMBIENT_AND_DIFFUSE, floor_diffuse);
+        glMaterialfv(GL_FRONT, GL_SPECULAR, floor_specular);
+        glMaterialf(GL_FRONT, GL_SHININESS, 128.0f);
+
+        if (_lightmap && _lightmap->bind()) {
+            // O albedo j est no lightmap; a unidade 1 fica sem textura e s repassa a soma.
+            Lightmap::setPlanarMapping(_lightmap->getRect(_firstSurface + item.part), _chunkSize.x, _chunkSize.y);
+            glColor3f(FLOOR_ALBEDO, FLOOR_ALBEDO, FLOOR_ALBEDO);
+            MeshManager::drawPlane(_chunkSize.x, _chunkSize.y, item.lod);
+            Lightmap::unbind();
+            return;
         }
+
+        MeshManager::drawPlane(_chunkSize.x, _chunkSize.y, item.lod);
+        return;
     }
-    glEnd();
 
-    // --- ETAPA 2: DESENHAR O GRID VISUAL (COM QUADRADOS MAIORES) ---
     glDisable(GL_LIGHTING);
     glColor3f(0.1f, 0.1f, 0.1f);
 
     // Define o tamanho de cada quadrado do grid visual.
     const float gridSquareSize = 1.0f;
+    const float halfWidth = _size.x / 2.0f;
+    const float halfDepth = _size.y / 2.0f;
 
     glBegin(GL_LINES);
-    float grid_y = _position.y + 0.01f;
+    float grid_y = 0.01f;
 
     // Desenha as linhas verticais (ao longo do eixo Z)
     for (float x = -halfWidth; x <= halfWidth; x += gridSquareSize) {
@@ -103,3 +145,27 @@ void Floor::render() {
 BoundingBox Floor::getBoundingBox() const {
     return {{0,0,0}, {0,0,0}};
 }
+
+
+/**
+ * @brief Um retngulo por bloco, da mesma forma que o bloco  desenhado.
+ * @param out Recebe as superfcies.
+ */
+void Floor::collectBakeSurfaces(std::vector<BakeSurface>& out) {
+    _firstSurface = static_cast<int>(out.size());
+    for (const Transform& chunk : _chunks) {
+        const Vector3f center = chunk.getWorldPosition();
+        const Vector3f origin = center - Vector3f{_chunkSize.x * 0.5f, 0.0f, _chunkSize.y * 0.5f};
+        out.push_back({origin, {_chunkSize.x, 0.0f, 0.0f}, {0.0f, 0.0f, _chunkSize.y}, {0.0f, 1.0f, 0.0f},
+                       {FLOOR_ALBEDO, FLOOR_ALBEDO, FLOOR_ALBEDO}, false});
+    }
+}
+
+BoundingBox Floor::getOccluderBox() const {
+    return {{_position.x - _size.x / 2.0f, _position.y - 0.1f, _position.z - _size.y / 2.0f},
+            {_position.x + _size.x / 2.0f, _position.y, _position.z + _size.y / 2.0f}};
+}
+
+void Floor::setLightmap(Lightmap* lightmap) {
+    _lightmap = lightmap;
+}
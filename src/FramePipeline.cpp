@@ -0,0 +1,111 @@
+/**
+ * @file FramePipeline.cpp
+ * @brief Implementação da fila limitada de RenderPackets entre simulação e renderização.
+ */
+
+#include "../include/FramePipeline.h"
+
+/**
+ * @brief Construtor do FramePipeline.
+ *
+ * Aloca profundidade + 2 pacotes: os que podem esperar na fila, um sendo
+ * escrito pela simulação e o último entregue à thread de GL.
+ *
+ * @param depth Número máximo de pacotes prontos aguardando consumo.
+ */
+FramePipeline::FramePipeline(int depth)
+    : _depth(depth < 1 ? 1 : depth), _writing(-1), _reading(-1), _closed(false) {
+    _packets.resize(_depth + 2);
+    for (int i = 0; i < (int)_packets.size(); ++i) {
+        _free.push_back(i);
+    }
+}
+
+/**
+ * @brief Obtém um pacote livre para a simulação preencher.
+ *
+ * No modo bloqueante, a simulação espera enquanto houver `depth` pacotes
+ * aguardando a thread de GL. No modo não bloqueante (usado quando simulação
+ * e renderização rodam na mesma thread), o pacote pronto mais antigo é descartado.
+ *
+ * @param block Se deve esperar por espaço na fila.
+ * @return O pacote a preencher, já limpo, ou nullptr se o pipeline foi fechado.
+ */
+RenderPacket* FramePipeline::beginWrite(bool block) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (block) {
+        _spaceAvailable.wait(lock, [this] { return _closed || (!_free.empty() && (int)_ready.size() < _depth); });
+    } else if (_free.empty() || (int)_ready.size() >= _depth) {
+        _free.push_back(_ready.front());
+        _ready.pop_front();
+    }
+    if (_closed) return nullptr;
+
+    _writing = _free.front();
+    _free.pop_front();
+    RenderPacket* packet = &_packets[_writing];
+    packet->clear();
+    return packet;
+}
+
+/**
+ * @brief Publica o pacote que estava sendo escrito.
+ */
+void FramePipeline::endWrite() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_writing < 0) return;
+    _ready.push_back(_writing);
+    _writing = -1;
+}
+
+/**
+ * @brief Devolve à lista de livres o pacote que estava sendo escrito.
+ */
+void FramePipeline::cancelWrite() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_writing < 0) return;
+    _free.push_front(_writing);
+    _writing = -1;
+}
+
+/**
+ * @brief Obtém o próximo pacote a desenhar, liberando o anterior se houver um novo.
+ * @return O pacote atual, ou nullptr se nenhum quadro foi publicado ainda.
+ */
+const RenderPacket* FramePipeline::acquireFrame() {
+    bool released = false;
+    const RenderPacket* packet = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_ready.empty()) {
+            if (_reading >= 0) {
+                _free.push_back(_reading);
+                released = true;
+            }
+            _reading = _ready.front();
+            _ready.pop_front();
+        }
+        if (_reading >= 0) packet = &_packets[_reading];
+    }
+    if (released) _spaceAvailable.notify_one();
+    return packet;
+}
+
+/**
+ * @brief Indica se há algum pacote pronto aguardando consumo.
+ */
+bool FramePipeline::hasReadyFrame() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return !_ready.empty();
+}
+
+/**
+ * @brief Fecha o pipeline, liberando a simulação caso ela esteja esperando por espaço.
+ */
+void FramePipeline::close() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _closed = true;
+    }
+    _spaceAvailable.notify_all();
+}
@@ -0,0 +1,78 @@
+/**
+ * @file FrameTimer.cpp
+ * @brief Implementação da medida assíncrona do tempo dos quadros.
+ */
+
+#include "../include/FrameTimer.h"
+#include "../include/GLExtensions.h"
+#include <cstdint>
+
+/**
+ * @brief Construtor. As queries só são criadas no primeiro begin, com o contexto
+ * de OpenGL já pronto.
+ */
+FrameTimer::FrameTimer()
+    : _queries(), _pending(), _write(0), _read(0), _initialized(false), _useQueries(false), _measuring(false) {}
+
+/**
+ * @brief Abre a query do quadro (ou marca o tempo de CPU).
+ *
+ * Se a próxima posição do anel ainda espera a GPU, o quadro não é medido: ler
+ * a query agora obrigaria a esperar, que é justamente o que se quer evitar.
+ */
+void FrameTimer::begin() {
+    if (!_initialized) {
+        _initialized = true;
+        _useQueries = GLExtensions::hasTimerQueries();
+        if (_useQueries) GLExtensions::genQueries(QUERY_COUNT, _queries);
+    }
+
+    if (!_useQueries) {
+        _cpuStart = std::chrono::steady_clock::now();
+        _measuring = true;
+        return;
+    }
+    _measuring = !_pending[_write];
+    if (_measuring) GLExtensions::beginQuery(GL_TIME_ELAPSED, _queries[_write]);
+}
+
+/**
+ * @brief Encerra a query do quadro e avança o anel.
+ */
+void FrameTimer::end() {
+    if (!_useQueries || !_measuring) return;
+    GLExtensions::endQuery(GL_TIME_ELAPSED);
+    _pending[_write] = true;
+    _write = (_write + 1) % QUERY_COUNT;
+    _measuring = false;
+}
+
+/**
+ * @brief Lê a query mais antiga, se o resultado já estiver disponível.
+ *
+ * Sem timer queries, devolve o tempo de CPU desde begin (uma vez por quadro).
+ *
+ * @param frameMs Recebe o tempo do quadro, em ms.
+ * @return true se havia uma medida nova.
+ */
+bool FrameTimer::poll(float& frameMs) {
+    if (!_useQueries) {
+        if (!_measuring) return false;
+        _measuring = false;
+        const std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - _cpuStart;
+        frameMs = elapsed.count();
+        return true;
+    }
+
+    if (!_pending[_read]) return false;
+    GLint available = 0;
+    GLExtensions::getQueryObjectiv(_queries[_read], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) return false;
+
+    uint64_t nanoseconds = 0;
+    GLExtensions::getQueryObjectui64v(_queries[_read], GL_QUERY_RESULT, &nanoseconds);
+    _pending[_read] = false;
+    _read = (_read + 1) % QUERY_COUNT;
+    frameMs = static_cast<float>(nanoseconds) * 1e-6f;
+    return true;
+}
@@ -0,0 +1,333 @@
+/**
+ * @file GLExtensions.cpp
+ * @brief Implementação do carregamento das funções opcionais do OpenGL.
+ */
+
+#include "../include/GLExtensions.h"
+#include <GL/freeglut.h>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+typedef void (APIENTRY *ActiveTextureProc)(GLenum unit);
+typedef void (APIENTRY *MultiTexCoord2fProc)(GLenum unit, GLfloat s, GLfloat t);
+
+typedef void (APIENTRY *GenObjectsProc)(GLsizei count, GLuint* ids);
+typedef void (APIENTRY *DeleteObjectsProc)(GLsizei count, const GLuint* ids);
+typedef void (APIENTRY *BindObjectProc)(GLenum target, GLuint id);
+typedef void (APIENTRY *FramebufferTexture2DProc)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+typedef GLenum (APIENTRY *CheckFramebufferStatusProc)(GLenum target);
+typedef void (APIENTRY *RenderbufferStorageProc)(GLenum target, GLenum format, GLsizei width, GLsizei height);
+typedef void (APIENTRY *FramebufferRenderbufferProc)(GLenum target, GLenum attachment, GLenum renderbufferTarget, GLuint renderbuffer);
+
+typedef GLuint (APIENTRY *CreateShaderProc)(GLenum type);
+typedef void (APIENTRY *ShaderSourceProc)(GLuint shader, GLsizei count, const char* const* sources, const GLint* lengths);
+typedef void (APIENTRY *ObjectProc)(GLuint id);
+typedef void (APIENTRY *GetObjectivProc)(GLuint id, GLenum name, GLint* value);
+typedef void (APIENTRY *GetInfoLogProc)(GLuint id, GLsizei size, GLsizei* length, char* log);
+typedef GLuint (APIENTRY *CreateProgramProc)();
+typedef void (APIENTRY *AttachShaderProc)(GLuint program, GLuint shader);
+typedef GLint (APIENTRY *GetUniformLocationProc)(GLuint program, const char* name);
+typedef void (APIENTRY *Uniform1iProc)(GLint location, GLint value);
+typedef void (APIENTRY *Uniform1fProc)(GLint location, GLfloat value);
+typedef void (APIENTRY *Uniform2fProc)(GLint location, GLfloat x, GLfloat y);
+
+typedef void (APIENTRY *EndQueryProc)(GLenum target);
+typedef void (APIENTRY *GetQueryObjectui64vProc)(GLuint id, GLenum name, uint64_t* value);
+
+static ActiveTextureProc activeTextureProc = nullptr;
+static MultiTexCoord2fProc multiTexCoord2fProc = nullptr;
+static bool multitexture = false;
+
+static GenObjectsProc genFramebuffersProc = nullptr;
+static DeleteObjectsProc deleteFramebuffersProc = nullptr;
+static BindObjectProc bindFramebufferProc = nullptr;
+static FramebufferTexture2DProc framebufferTexture2DProc = nullptr;
+static CheckFramebufferStatusProc checkFramebufferStatusProc = nullptr;
+static GenObjectsProc genRenderbuffersProc = nullptr;
+static DeleteObjectsProc deleteRenderbuffersProc = nullptr;
+static BindObjectProc bindRenderbufferProc = nullptr;
+static RenderbufferStorageProc renderbufferStorageProc = nullptr;
+static FramebufferRenderbufferProc framebufferRenderbufferProc = nullptr;
+static bool framebuffers = false;
+
+static CreateShaderProc createShaderProc = nullptr;
+static ShaderSourceProc shaderSourceProc = nullptr;
+static ObjectProc compileShaderProc = nullptr;
+static ObjectProc deleteShaderProc = nullptr;
+static GetObjectivProc getShaderivProc = nullptr;
+static GetInfoLogProc getShaderInfoLogProc = nullptr;
+static CreateProgramProc createProgramProc = nullptr;
+static AttachShaderProc attachShaderProc = nullptr;
+static ObjectProc linkProgramProc = nullptr;
+static ObjectProc deleteProgramProc = nullptr;
+static ObjectProc useProgramProc = nullptr;
+static GetObjectivProc getProgramivProc = nullptr;
+static GetInfoLogProc getProgramInfoLogProc = nullptr;
+static GetUniformLocationProc getUniformLocationProc = nullptr;
+static Uniform1iProc uniform1iProc = nullptr;
+static Uniform1fProc uniform1fProc = nullptr;
+static Uniform2fProc uniform2fProc = nullptr;
+static bool shaders = false;
+
+static GenObjectsProc genQueriesProc = nullptr;
+static DeleteObjectsProc deleteQueriesProc = nullptr;
+static BindObjectProc beginQueryProc = nullptr;
+static EndQueryProc endQueryProc = nullptr;
+static GetObjectivProc getQueryObjectivProc = nullptr;
+static GetQueryObjectui64vProc getQueryObjectui64vProc = nullptr;
+static bool timerQueries = false;
+
+/**
+ * @brief Busca uma função pelo nome do núcleo e, se não existir, pelo da extensão.
+ */
+static void* lookup(const char* core, const char* extension) {
+    void* proc = reinterpret_cast<void*>(glutGetProcAddress(core));
+    if (!proc && extension) proc = reinterpret_cast<void*>(glutGetProcAddress(extension));
+    return proc;
+}
+
+/** @brief lookup já convertido para o tipo do ponteiro. */
+template <typename Proc>
+static void load(Proc& proc, const char* core, const char* extension = nullptr) {
+    proc = reinterpret_cast<Proc>(lookup(core, extension));
+}
+
+void GLExtensions::init() {
+    activeTextureProc = reinterpret_cast<ActiveTextureProc>(lookup("glActiveTexture", "glActiveTextureARB"));
+    multiTexCoord2fProc = reinterpret_cast<MultiTexCoord2fProc>(lookup("glMultiTexCoord2f", "glMultiTexCoord2fARB"));
+
+    GLint units = 1;
+    if (activeTextureProc && multiTexCoord2fProc) {
+        glGetIntegerv(0x84E2 /* GL_MAX_TEXTURE_UNITS */, &units);
+    }
+    multitexture = activeTextureProc && multiTexCoord2fProc && units >= 2;
+    if (!multitexture) {
+        std::cerr << "[GL] Multitextura indisponível; a iluminação pré-calculada fica desligada.\n";
+    }
+
+    load(genFramebuffersProc, "glGenFramebuffers", "glGenFramebuffersEXT");
+    load(deleteFramebuffersProc, "glDeleteFramebuffers", "glDeleteFramebuffersEXT");
+    load(bindFramebufferProc, "glBindFramebuffer", "glBindFramebufferEXT");
+    load(framebufferTexture2DProc, "glFramebufferTexture2D", "glFramebufferTexture2DEXT");
+    load(checkFramebufferStatusProc, "glCheckFramebufferStatus", "glCheckFramebufferStatusEXT");
+    load(genRenderbuffersProc, "glGenRenderbuffers", "glGenRenderbuffersEXT");
+    load(deleteRenderbuffersProc, "glDeleteRenderbuffers", "glDeleteRenderbuffersEXT");
+    load(bindRenderbufferProc, "glBindRenderbuffer", "glBindRenderbufferEXT");
+    load(renderbufferStorageProc, "glRenderbufferStorage", "glRenderbufferStorageEXT");
+    load(framebufferRenderbufferProc, "glFramebufferRenderbuffer", "glFramebufferRenderbufferEXT");
+    framebuffers = genFramebuffersProc && deleteFramebuffersProc && bindFramebufferProc && framebufferTexture2DProc &&
+                   checkFramebufferStatusProc && genRenderbuffersProc && deleteRenderbuffersProc &&
+                   bindRenderbufferProc && renderbufferStorageProc && framebufferRenderbufferProc;
+
+    load(createShaderProc, "glCreateShader");
+    load(shaderSourceProc, "glShaderSource");
+    load(compileShaderProc, "glCompileShader");
+    load(deleteShaderProc, "glDeleteShader");
+    load(getShaderivProc, "glGetShaderiv");
+    load(getShaderInfoLogProc, "glGetShaderInfoLog");
+    load(createProgramProc, "glCreateProgram");
+    load(attachShaderProc, "glAttachShader");
+    load(linkProgramProc, "glLinkProgram");
+    load(deleteProgramProc, "glDeleteProgram");
+    load(useProgramProc, "glUseProgram");
+    load(getProgramivProc, "glGetProgramiv");
+    load(getProgramInfoLogProc, "glGetProgramInfoLog");
+    load(getUniformLocationProc, "glGetUniformLocation");
+    load(uniform1iProc, "glUniform1i");
+    load(uniform1fProc, "glUniform1f");
+    load(uniform2fProc, "glUniform2f");
+    shaders = createShaderProc && shaderSourceProc && compileShaderProc && deleteShaderProc && getShaderivProc &&
+              getShaderInfoLogProc && createProgramProc && attachShaderProc && linkProgramProc && deleteProgramProc &&
+              useProgramProc && getProgramivProc && getProgramInfoLogProc && getUniformLocationProc &&
+              uniform1iProc && uniform1fProc && uniform2fProc;
+
+    // GL_TIME_ELAPSED é do núcleo só a partir da 3.3; antes, vem de uma das extensões.
+    int major = 0, minor = 0;
+    const char* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+    if (version) std::sscanf(version, "%d.%d", &major, &minor);
+    const bool timerSupported = major > 3 || (major == 3 && minor >= 3) ||
+                                glutExtensionSupported("GL_ARB_timer_query") ||
+                                glutExtensionSupported("GL_EXT_timer_query");
+    load(genQueriesProc, "glGenQueries", "glGenQueriesARB");
+    load(deleteQueriesProc, "glDeleteQueries", "glDeleteQueriesARB");
+    load(beginQueryProc, "glBeginQuery", "glBeginQueryARB");
+    load(endQueryProc, "glEndQuery", "glEndQueryARB");
+    load(getQueryObjectivProc, "glGetQueryObjectiv", "glGetQueryObjectivARB");
+    load(getQueryObjectui64vProc, "glGetQueryObjectui64v", "glGetQueryObjectui64vEXT");
+    timerQueries = timerSupported && genQueriesProc && deleteQueriesProc && beginQueryProc && endQueryProc &&
+                   getQueryObjectivProc && getQueryObjectui64vProc;
+}
+
+bool GLExtensions::hasMultitexture() {
+    return multitexture;
+}
+
+bool GLExtensions::hasFramebuffers() {
+    return framebuffers;
+}
+
+bool GLExtensions::hasShaders() {
+    return shaders;
+}
+
+bool GLExtensions::hasTimerQueries() {
+    return timerQueries;
+}
+
+void GLExtensions::activeTexture(GLenum unit) {
+    if (activeTextureProc) activeTextureProc(unit);
+}
+
+void GLExtensions::multiTexCoord2f(GLenum unit, float s, float t) {
+    if (multiTexCoord2fProc) multiTexCoord2fProc(unit, s, t);
+}
+
+// --- FRAMEBUFFER OBJECTS ---
+
+void GLExtensions::genFramebuffers(GLsizei count, GLuint* ids) {
+    genFramebuffersProc(count, ids);
+}
+
+void GLExtensions::deleteFramebuffers(GLsizei count, const GLuint* ids) {
+    deleteFramebuffersProc(count, ids);
+}
+
+void GLExtensions::bindFramebuffer(GLenum target, GLuint framebuffer) {
+    bindFramebufferProc(target, framebuffer);
+}
+
+void GLExtensions::framebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    framebufferTexture2DProc(target, attachment, textarget, texture, level);
+}
+
+GLenum GLExtensions::checkFramebufferStatus(GLenum target) {
+    return checkFramebufferStatusProc(target);
+}
+
+void GLExtensions::genRenderbuffers(GLsizei count, GLuint* ids) {
+    genRenderbuffersProc(count, ids);
+}
+
+void GLExtensions::deleteRenderbuffers(GLsizei count, const GLuint* ids) {
+    deleteRenderbuffersProc(count, ids);
+}
+
+void GLExtensions::bindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    bindRenderbufferProc(target, renderbuffer);
+}
+
+void GLExtensions::renderbufferStorage(GLenum target, GLenum format, GLsizei width, GLsizei height) {
+    renderbufferStorageProc(target, format, width, height);
+}
+
+void GLExtensions::framebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbufferTarget, GLuint renderbuffer) {
+    framebufferRenderbufferProc(target, attachment, renderbufferTarget, renderbuffer);
+}
+
+// --- SHADERS ---
+
+/**
+ * @brief Compila um shader; em caso de erro, mostra o log e retorna 0.
+ */
+static GLuint compileShader(const char* name, GLenum type, const char* source) {
+    GLuint shader = createShaderProc(type);
+    shaderSourceProc(shader, 1, &source, nullptr);
+    compileShaderProc(shader);
+
+    GLint ok = GL_FALSE;
+    getShaderivProc(shader, GL_COMPILE_STATUS, &ok);
+    if (ok != GL_TRUE) {
+        std::vector<char> log(4096);
+        getShaderInfoLogProc(shader, static_cast<GLsizei>(log.size()), nullptr, log.data());
+        std::cerr << "[GL] Erro ao compilar o shader " << name << ":\n" << log.data() << "\n";
+        deleteShaderProc(shader);
+        return 0;
+    }
+    return shader;
+}
+
+GLuint GLExtensions::buildProgram(const char* name, const char* vertexSource, const char* fragmentSource) {
+    if (!shaders) return 0;
+
+    GLuint vertex = compileShader(name, GL_VERTEX_SHADER, vertexSource);
+    GLuint fragment = compileShader(name, GL_FRAGMENT_SHADER, fragmentSource);
+    if (!vertex || !fragment) {
+        if (vertex) deleteShaderProc(vertex);
+        if (fragment) deleteShaderProc(fragment);
+        return 0;
+    }
+
+    GLuint program = createProgramProc();
+    attachShaderProc(program, vertex);
+    attachShaderProc(program, fragment);
+    linkProgramProc(program);
+    // Os shaders ficam presos ao programa; só são liberados junto com ele.
+    deleteShaderProc(vertex);
+    deleteShaderProc(fragment);
+
+    GLint ok = GL_FALSE;
+    getProgramivProc(program, GL_LINK_STATUS, &ok);
+    if (ok != GL_TRUE) {
+        std::vector<char> log(4096);
+        getProgramInfoLogProc(program, static_cast<GLsizei>(log.size()), nullptr, log.data());
+        std::cerr << "[GL] Erro ao ligar o programa " << name << ":\n" << log.data() << "\n";
+        deleteProgramProc(program);
+        return 0;
+    }
+    return program;
+}
+
+void GLExtensions::deleteProgram(GLuint program) {
+    if (deleteProgramProc) deleteProgramProc(program);
+}
+
+void GLExtensions::useProgram(GLuint program) {
+    useProgramProc(program);
+}
+
+GLint GLExtensions::getUniformLocation(GLuint program, const char* name) {
+    return getUniformLocationProc(program, name);
+}
+
+void GLExtensions::uniform1i(GLint location, GLint value) {
+    uniform1iProc(location, value);
+}
+
+void GLExtensions::uniform1f(GLint location, GLfloat value) {
+    uniform1fProc(location, value);
+}
+
+void GLExtensions::uniform2f(GLint location, GLfloat x, GLfloat y) {
+    uniform2fProc(location, x, y);
+}
+
+// --- TIMER QUERIES ---
+
+void GLExtensions::genQueries(GLsizei count, GLuint* ids) {
+    genQueriesProc(count, ids);
+}
+
+void GLExtensions::deleteQueries(GLsizei count, const GLuint* ids) {
+    if (deleteQueriesProc) deleteQueriesProc(count, ids);
+}
+
+void GLExtensions::beginQuery(GLenum target, GLuint id) {
+    beginQueryProc(target, id);
+}
+
+void GLExtensions::endQuery(GLenum target) {
+    endQueryProc(target);
+}
+
+void GLExtensions::getQueryObjectiv(GLuint id, GLenum name, GLint* value) {
+    getQueryObjectivProc(id, name, value);
+}
+
+void GLExtensions::getQueryObjectui64v(GLuint id, GLenum name, uint64_t* value) {
+    getQueryObjectui64vProc(id, name, value);
+}
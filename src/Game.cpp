@@ -12,118 +12,86 @@
 #include "../include/PuzzleDoor.h" // Mantido da branch main
 #include "../include/SceneManager.h" // Mantido da branch main
 #include "../include/GameStateManager.h" // Mantido da branch main
+#include "../include/JobSystem.h"
+#include "../include/GLExtensions.h"
+#include "../include/DebugDraw.h"
+#include "../include/AnimationSystem.h"
+#include "../include/QualityGovernor.h"
+#include "../include/TextureManager.h"
+#include "../include/MeshManager.h"
+#include "../include/VectorMath.h"
 #include <GL/freeglut.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
 #include <iostream>
 #include <cmath>
+#include <cstdio>
 #include <limits>
 #include <vector>
 
 // --- FUNÇÕES AUXILIARES ESTÁTICAS ---
 /**
- * @brief Desenha texto centralizado na tela.
- * @param msg A string de caracteres a ser desenhada.
- * @param x A coordenada X do centro do texto.
- * @param y A coordenada Y do centro do texto.
+ * @brief O rótulo curto de um item, mostrado no seu espaço do inventário.
+ * @param item O item.
+ * @return O rótulo.
  */
-static void drawCenteredBitmapText(const char* msg, float x, float y) {
-    glRasterPos2f(x, y);
-    for (const char* p = msg; *p; ++p) {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, *p);
+static const char* inventoryLabel(ItemType item) {
+    switch (item) {
+        case ItemType::CHAVE_SALA_1:   return "K1";
+        case ItemType::CHAVE_SALA_2:   return "K2";
+        case ItemType::CHAVE_SALA_3:   return "K3";
+        case ItemType::CHAVE_SALA_4:   return "K4";
+        case ItemType::FORMA_ESFERA:   return "ESF";
+        case ItemType::FORMA_CUBO:     return "CUB";
+        case ItemType::FORMA_PIRAMIDE: return "PIR";
+        default:                       return "?";
     }
 }
 
-// --- FUNÇÕES AUXILIARES DE RAY CASTING ---
+// --- IMPLEMENTAÇÃO DA CLASSE GAME ---
+
 /**
- * @brief Calcula um raio a partir da posição da câmera na tela.
- *
- * Utiliza as matrizes de projeção e modelview do OpenGL para "des-projetar"
- * as coordenadas 2D do mouse para o espaço 3D, criando um vetor de direção para o raio.
+ * @brief Construtor da classe Game.
  *
- * @param mouseX A coordenada X do mouse na tela.
- * @param mouseY A coordenada Y do mouse na tela.
- * @param player A instância do jogador, para obter a posição da câmera.
- * @return Um objeto Ray contendo a origem e a direção.
+ * Inicializa o estado do jogo para PLAYING.
  */
-Ray calculateMouseRay(int mouseX, int mouseY, Player& player) {
-    GLdouble modelviewMatrix[16];
-    GLdouble projectionMatrix[16];
-    GLint viewport[4];
-    glGetDoublev(GL_MODELVIEW_MATRIX, modelviewMatrix);
-    glGetDoublev(GL_PROJECTION_MATRIX, projectionMatrix);
-    glGetIntegerv(GL_VIEWPORT, viewport);
-
-    mouseY = viewport[3] - mouseY;
-
-    GLdouble nearX, nearY, nearZ;
-    GLdouble farX, farY, farZ;
-
-    gluUnProject(mouseX, mouseY, 0.0, modelviewMatrix, projectionMatrix, viewport, &nearX, &nearY, &nearZ);
-    gluUnProject(mouseX, mouseY, 1.0, modelviewMatrix, projectionMatrix, viewport, &farX, &farY, &farZ);
-
-    Vector3f rayDirection = {
-        (float)(farX - nearX),
-        (float)(farY - nearY),
-        (float)(farZ - nearZ)
-    };
-
-    float length = sqrt(rayDirection.x * rayDirection.x + rayDirection.y * rayDirection.y + rayDirection.z * rayDirection.z);
-    if (length > 0) {
-        rayDirection.x /= length;
-        rayDirection.y /= length;
-        rayDirection.z /= length;
-    }
-
-    return {player.getCamera().getPosition(), rayDirection};
+Game::Game()
+    : _pipeline(Config::RENDER_PIPELINE_DEPTH), _running(false), _quitRequested(false), _frameIndex(0),
+      _idle(false), _sceneChanged(true), _publishedSignature(0), _timersFired(0), _idleSteps(0), _tickBacklog(0.0f) {
+    _currentState = PLAYING;
 }
 
 /**
- * @brief Calcula a interseção de um raio com uma esfera.
- *
- * Utiliza uma fórmula quadrática para determinar se e a que distância
- * o raio colide com a superfície da esfera.
- *
- * @param ray O raio a ser testado.
- * @param sphereCenter A posição central da esfera.
- * @param sphereRadius O raio da esfera.
- * @return A distância até o ponto de colisão mais próximo, ou -1.0f se não houver colisão.
+ * @brief Destrutor da classe Game.
  */
-float rayIntersectsSphere(const Ray& ray, const Vector3f& sphereCenter, float sphereRadius) {
-    Vector3f oc = {
-        ray.origin.x - sphereCenter.x,
-        ray.origin.y - sphereCenter.y,
-        ray.origin.z - sphereCenter.z
-    };
-    float a = ray.direction.x * ray.direction.x + ray.direction.y * ray.direction.y + ray.direction.z * ray.direction.z;
-    float b = 2.0f * (oc.x * ray.direction.x + oc.y * ray.direction.y + oc.z * ray.direction.z);
-    float c = (oc.x * oc.x + oc.y * oc.y + oc.z * oc.z) - sphereRadius * sphereRadius;
-    float discriminant = b * b - 4 * a * c;
-
-    if (discriminant < 0) {
-        return -1.0f;
-    } else {
-        return (-b - sqrt(discriminant)) / (2.0f * a);
-    }
+Game::~Game() {
+    stopSimulation();
 }
 
-// --- IMPLEMENTAÇÃO DA CLASSE GAME ---
-
 /**
- * @brief Construtor da classe Game.
- *
- * Inicializa o estado do jogo para PLAYING.
+ * @brief Encerra a simulação e o JobSystem, nessa ordem: a simulação pode estar
+ * dentro de um JobSystem::parallelFor.
  */
-Game::Game() {
-    _currentState = PLAYING;
+void Game::shutdown() {
+    stopSimulation();
+    JobSystem::shutdown();
 }
 
 /**
  * @brief Inicializa as configurações do OpenGL e os componentes do jogo.
  *
  * Configura o viewport, a projeção, a iluminação e as matrizes de cor.
- * Em seguida, inicializa o gerenciador de luzes e de cena.
+ * Em seguida, cria as threads do JobSystem, carrega as funções de OpenGL além da 1.1,
+ * inicializa o gerenciador de luzes e de cena (que calcula os lightmaps das salas),
+ * carrega as regras dos puzzles, publica o primeiro quadro e, se configurado,
+ * inicia a thread de simulação.
+ *
+ * @return false se as regras não puderam ser carregadas; o jogo não pode continuar.
  */
-void Game::init() {
+bool Game::init() {
     glClearColor(Config::SKYBOX_R, Config::SKYBOX_G, Config::SKYBOX_B, 1.0f);
+    glClearStencil(0);
     glEnable(GL_DEPTH_TEST);
     glShadeModel(GL_SMOOTH);
     glEnable(GL_NORMALIZE);
@@ -133,7 +101,7 @@ void Game::init() {
 
     glMatrixMode(GL_PROJECTION);
     glLoadIdentity();
-    gluPerspective(45.0, (float)Config::SCREEN_WIDTH / (float)Config::SCREEN_HEIGHT, Config::CAMERA_ZNEAR, Config::CAMERA_ZFAR);
+    gluPerspective(Config::CAMERA_FOV_Y, (float)Config::SCREEN_WIDTH / (float)Config::SCREEN_HEIGHT, Config::CAMERA_ZNEAR, Config::CAMERA_ZFAR);
 
     glEnable(GL_COLOR_MATERIAL);
     glColorMaterial(GL_FRONT, GL_AMBIENT_AND_DIFFUSE);
@@ -141,162 +109,607 @@ void Game::init() {
     glMatrixMode(GL_MODELVIEW);
     glLoadIdentity();
 
+    JobSystem::init(Config::JOB_WORKER_THREADS);
+    GLExtensions::init();
+    if (Config::POST_PROCESSING) _postProcess.init(Config::SCREEN_WIDTH, Config::SCREEN_HEIGHT);
+    if (Config::QUALITY_GOVERNOR) registerQualityKnobs();
+
     _lightManager.init();
     _sceneManager.init(_player);
+    _gameStateManager.setTimerWheel(&_timers);
+    _gameStateManager.setAnimationSystem(&_animations);
+    if (!_gameStateManager.loadRules(Config::RULES_FILE)) {
+        std::cerr << "[Game] As regras de " << Config::RULES_FILE << " não foram carregadas; o jogo não pode continuar.\n";
+        return false;
+    }
+
+    publishFrame(false);
+
+    if (Config::RENDER_PIPELINE_DEPTH > 0) {
+        _running = true;
+        _simulationThread = std::thread(&Game::simulationLoop, this);
+    }
+    return true;
 }
 
 /**
  * @brief Atualiza o estado do jogo a cada quadro.
  *
  * Se o jogo estiver em estado PLAYING, atualiza a lógica do jogador,
- * do gerenciador de cena e da luz da lanterna.
+ * as animações, os timers e o gerenciador de cena. Fora de PLAYING o relógio
+ * dos timers não anda, então eles ficam pausados. A cor da lanterna é aplicada na renderização,
+ * a partir do pacote do quadro.
+ *
+ * Animações ativas e timers disparados marcam a cena como alterada, o que força
+ * a publicação do próximo quadro (ver publishFrame).
  *
  * @param deltaTime O tempo decorrido desde o último quadro.
  */
 void Game::update(float deltaTime) {
     if (_currentState == PLAYING) {
-        _player.update(deltaTime, _sceneManager.getCurrentRoomObjects(), _gameStateManager);
+        if (_animations.getActiveCount() > 0) _sceneChanged = true;
+        _player.update(deltaTime, _sceneManager.getCurrentRoomColliders(), _gameStateManager);
+        _animations.update(deltaTime);
+        _timers.advance(deltaTime);
         _sceneManager.update(deltaTime, _gameStateManager);
-        // A chamada de processamento de pendências foi removida
-        Vector3f currentColor = _gameStateManager.getCurrentFlashlightColor();
-        _lightManager.setFlashlightColor(currentColor);
     }
-    glutPostRedisplay();
+    if (_timers.getFiredCount() != _timersFired) {
+        _timersFired = _timers.getFiredCount();
+        _sceneChanged = true;
+    }
 }
 
 /**
- * @brief Renderiza a cena do jogo.
+ * @brief Executa um passo do temporizador do GLUT.
+ *
+ * Sem a thread de simulação, o tempo decorrido é simulado em passos fixos; depois
+ * de uma espera ociosa, ele cobre vários passos.
  *
- * O processo de renderização inclui:
- * 1. Desenhar a cena 3D (jogadores, objetos, etc.).
- * 2. Opcionalmente, desenhar as hitboxes de debug.
- * 3. Desenhar a interface 2D, como a mira e as mensagens de status.
+ * @param deltaTime O tempo decorrido desde a última chamada.
  */
-void Game::render() {
-    // 1. Limpa a tela e desenha a cena 3D principal
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    glLoadIdentity();
-    _player.getCamera().updateView();
-    _lightManager.updateFlashlight(_player.getCamera().getPosition(), _player.getCamera().getFrontVector());
-    _sceneManager.render();
-
-    // 2. Desenha as hitboxes de debug, se a opção estiver ativa
-    if (Config::DEBUG_DRAW_HITBOXES) {
-        // Desabilita a iluminação para que a hitbox tenha uma cor sólida
-        glDisable(GL_LIGHTING);
-        // Habilita o "blending" para permitir a semi-transparência
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-        std::vector<InteractableObject*>& interactables = _sceneManager.getInteractableObjects();
-
-        // Define a cor da hitbox (Verde com 40% de opacidade)
-        glColor4f(0.0f, 1.0f, 0.0f, 0.4f); // R, G, B, Alpha
-
-        for (const auto* obj : interactables) {
-            Vector3f pos = obj->getPosition();
-            float radius = obj->getCollisionRadius();
-
-            glPushMatrix();
-            glTranslatef(pos.x, pos.y, pos.z);
-            glutWireSphere(radius, 16, 16);
-            glPopMatrix();
-        }
+void Game::tick(float deltaTime) {
+    if (_quitRequested) {
+        shutdown();
+        glutLeaveMainLoop();
+        return;
+    }
+
+    if (!_simulationThread.joinable()) {
+        drainInput();
+        const float step = static_cast<float>(Config::SIMULATION_STEP_MS);
+        _tickBacklog += deltaTime;
+        do {
+            update(step);
+            _tickBacklog -= step;
+        } while (_tickBacklog >= step);
+        _tickBacklog = std::max(_tickBacklog, 0.0f);
+        updateIdle(publishFrame(false));
+    }
 
-        // Reabilita a iluminação e desabilita o blending
-        glEnable(GL_LIGHTING);
-        glDisable(GL_BLEND);
+    if (_pipeline.hasReadyFrame()) {
+        glutPostRedisplay();
     }
+}
+
+/**
+ * @brief Obtém o intervalo até o próximo tick do temporizador do GLUT.
+ * @return Config::IDLE_POLL_MS enquanto o jogo estiver ocioso, senão
+ * Config::SIMULATION_STEP_MS.
+ */
+int Game::getTickInterval() const {
+    return _idle ? Config::IDLE_POLL_MS : Config::SIMULATION_STEP_MS;
+}
 
-    // 3. Prepara para desenhar os elementos 2D (interface) por cima de tudo
+/**
+ * @brief Define a função que antecipa o próximo tick quando uma entrada chega com o
+ * jogo ocioso. É chamada por pushInput, na thread do GLUT.
+ * @param onWake A função, ou nullptr para esperar o tick normal.
+ */
+void Game::setWakeCallback(std::function<void()> onWake) {
+    _onWake = onWake;
+}
 
-    // Bloco para desenhar a Crosshair
+/**
+ * @brief Conta os passos sem quadro novo e marca o jogo como ocioso depois de
+ * Config::IDLE_STEPS_BEFORE_SLEEP deles (se não houver entrada esperando).
+ * @param published Se o passo publicou um quadro.
+ */
+void Game::updateIdle(bool published) {
+    if (published) {
+        _idleSteps = 0;
+        _idle = false;
+        return;
+    }
+    if (_idleSteps < Config::IDLE_STEPS_BEFORE_SLEEP) {
+        ++_idleSteps;
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_inputMutex);
+    if (_pendingInput.empty()) _idle = true;
+}
+
+/**
+ * @brief Dorme até chegar uma entrada, o jogo ser encerrado ou o prazo vencer.
+ * @param deadline O prazo.
+ */
+void Game::waitForInput(std::chrono::steady_clock::time_point deadline) {
+    std::unique_lock<std::mutex> lock(_inputMutex);
+    _inputArrived.wait_until(lock, deadline, [this] { return !_pendingInput.empty() || !_running; });
+}
+
+/**
+ * @brief Laço da thread de simulação.
+ *
+ * Roda a simulação em passos fixos de Config::SIMULATION_STEP_MS. Se a thread
+ * atrasar muito (por exemplo, esperando a renderização), o relógio é
+ * reajustado em vez de tentar recuperar os passos perdidos de uma vez.
+ *
+ * Ociosa (ver updateIdle), a thread dorme até uma entrada ou até Config::IDLE_POLL_MS
+ * e então simula o tempo dormido em passos fixos, sem publicar, para que os timers
+ * disparem no mesmo passo em que disparariam sem o sono.
+ */
+void Game::simulationLoop() {
+    typedef std::chrono::steady_clock Clock;
+    const Clock::duration step = std::chrono::milliseconds(Config::SIMULATION_STEP_MS);
+    Clock::time_point next = Clock::now();
+
+    while (_running) {
+        drainInput();
+        update((float)Config::SIMULATION_STEP_MS);
+        updateIdle(publishFrame(true));
+
+        next += step;
+        Clock::time_point now = Clock::now();
+        if (now > next + step * 4) {
+            next = now;
+        }
+        if (_idle) {
+            waitForInput(now + std::chrono::milliseconds(Config::IDLE_POLL_MS));
+            now = Clock::now();
+            while (next + step <= now) {
+                update((float)Config::SIMULATION_STEP_MS);
+                next += step;
+            }
+            continue;
+        }
+        std::this_thread::sleep_until(next);
+    }
+}
+
+/**
+ * @brief Para a thread de simulação e aguarda o seu término.
+ */
+void Game::stopSimulation() {
     {
-        glMatrixMode(GL_PROJECTION);
-        glPushMatrix();
-        glLoadIdentity();
-        gluOrtho2D(0, Config::SCREEN_WIDTH, 0, Config::SCREEN_HEIGHT);
-        glMatrixMode(GL_MODELVIEW);
-        glPushMatrix();
-        glLoadIdentity();
-
-        glDisable(GL_DEPTH_TEST);
-        glDisable(GL_LIGHTING);
-
-        glColor3f(1.0f, 1.0f, 1.0f); // Cor: Branco
-        glLineWidth(2.0f);
-
-        float centerX = Config::SCREEN_WIDTH / 2.0f;
-        float centerY = Config::SCREEN_HEIGHT / 2.0f;
-        float tamanho = 10.0f;
-
-        glBegin(GL_LINES);
-        // Linha vertical
-        glVertex2f(centerX, centerY - tamanho);
-        glVertex2f(centerX, centerY + tamanho);
-        // Linha horizontal
-        glVertex2f(centerX - tamanho, centerY);
-        glVertex2f(centerX + tamanho, centerY);
-        glEnd();
-
-        glEnable(GL_DEPTH_TEST);
-        glEnable(GL_LIGHTING);
-
-        glMatrixMode(GL_PROJECTION);
-        glPopMatrix();
-        glMatrixMode(GL_MODELVIEW);
-        glPopMatrix();
-    }
-
-    // Bloco para desenhar o texto de Fim de Jogo ou Vitória
-    if (_currentState != PLAYING) {
-        glMatrixMode(GL_PROJECTION);
-        glPushMatrix();
-        glLoadIdentity();
-        gluOrtho2D(0, Config::SCREEN_WIDTH, 0, Config::SCREEN_HEIGHT);
-        glMatrixMode(GL_MODELVIEW);
-        glPushMatrix();
-        glLoadIdentity();
-
-        glDisable(GL_DEPTH_TEST);
-        glColor3f(1.0f, 1.0f, 1.0f);
-        const char* msg = (_currentState == GAME_OVER) ? "GAME OVER - Pressione ESC para sair" : "VOCE VENCEU! - Pressione ESC para sair";
-        drawCenteredBitmapText(msg, 200, 300);
-        glEnable(GL_DEPTH_TEST);
-
-        glPopMatrix();
-        glMatrixMode(GL_PROJECTION);
-        glPopMatrix();
-        glMatrixMode(GL_MODELVIEW);
+        std::lock_guard<std::mutex> lock(_inputMutex);
+        _running = false;
+    }
+    _inputArrived.notify_all();
+    _pipeline.close();
+    if (_simulationThread.joinable()) {
+        _simulationThread.join();
+    }
+}
+
+/**
+ * @brief Monta e publica o pacote de renderização do estado atual.
+ *
+ * Copia a câmera, a lanterna e o estado do jogo, pede à cena os itens
+ * de desenho da sala atual e recolhe o desenho de depuração do quadro.
+ *
+ * Com Config::RENDER_ON_DEMAND, o pacote é descartado se for igual ao último
+ * publicado (mesma RenderPacket::signature). Como os objetos desenham só a partir
+ * dos seus DrawItem, o resumo cobre tudo o que aparece na tela. Entrada, animações
+ * ativas e timers disparados (ver update) ainda forçam a publicação: é uma garantia
+ * barata de que um passo que mudou o jogo sempre chega à tela. Sem quadro novo, o
+ * GLUT não redesenha. Com o desenho de depuração ligado, todo passo publica.
+ *
+ * @param block Se deve esperar a renderização liberar espaço no pipeline.
+ * @return true se um quadro foi publicado.
+ */
+bool Game::publishFrame(bool block) {
+    RenderPacket* packet = _pipeline.beginWrite(block);
+    if (!packet) return false;
+
+    FPSCamera& camera = _player.getCamera();
+    packet->camera.position = camera.getPosition();
+    packet->camera.front = camera.getFrontVector();
+    packet->camera.up = camera.getUpVector();
+    packet->flashlight.position = camera.getPosition();
+    packet->flashlight.direction = camera.getFrontVector();
+    packet->flashlight.color = _gameStateManager.getCurrentFlashlightColor();
+    packet->gameState = _currentState;
+    packet->hud.keypadActive = _gameStateManager.isKeypadActive();
+    packet->hud.keypadInput = _gameStateManager.getKeypadInput();
+    packet->hud.inventory = _gameStateManager.getInventory();
+
+    _sceneManager.collectDrawItems(*packet);
+
+    if (DebugDraw::isEnabled()) {
+        queueDebugShapes();
+    }
+    DebugDraw::collect(*packet);
+
+    if (Config::RENDER_ON_DEMAND) {
+        const uint64_t signature = packet->signature();
+        if (!_sceneChanged && signature == _publishedSignature && !DebugDraw::isEnabled()) {
+            _pipeline.cancelWrite();
+            return false;
+        }
+        _publishedSignature = signature;
+        _sceneChanged = false;
+    }
+
+    packet->frameIndex = ++_frameIndex;
+    _pipeline.endWrite();
+    return true;
+}
+
+/**
+ * @brief Enfileira no DebugDraw o que a simulação sabe da sala atual: as esferas de
+ * interação (com a distância até o jogador), as caixas de colisão das paredes, a
+ * caixa do jogador e o raio de interação.
+ */
+void Game::queueDebugShapes() {
+    const FPSCamera& camera = _player.getCamera();
+    const Vector3f eye = camera.getPosition();
+
+    for (const auto* obj : _sceneManager.getInteractableObjects()) {
+        const Vector3f& center = obj->getPosition();
+        DebugDraw::sphere(center, obj->getCollisionRadius(), {0.0f, 1.0f, 0.0f}, 0.4f);
+
+        char label[32];
+        std::snprintf(label, sizeof(label), "%.1f m", length(center - eye));
+        DebugDraw::text({center.x, center.y + obj->getCollisionRadius(), center.z}, label, {0.6f, 1.0f, 0.6f});
+    }
+    for (const BoundingBox& box : _sceneManager.getCurrentRoomColliders()) {
+        DebugDraw::box(box, {1.0f, 0.8f, 0.1f}, 0.5f);
+    }
+    DebugDraw::box(_player.getBoundingBox(), {0.2f, 0.8f, 1.0f});
+
+    // O raio sai um pouco abaixo do olho, senão seria um ponto no centro da tela.
+    const Vector3f start = eye - camera.getUpVector() * 0.1f;
+    DebugDraw::line(start, eye + camera.getFrontVector() * Config::PLAYER_INTERACTION_DISTANCE, {1.0f, 0.2f, 0.2f});
+}
+
+/**
+ * @brief Renderiza a cena do jogo.
+ *
+ * Desenha apenas o que está no pacote publicado pela simulação, de forma que a
+ * simulação do próximo quadro pode rodar em paralelo. O processo inclui:
+ * 1. Desenhar a cena 3D (jogadores, objetos, etc.), já ordenada da frente para trás
+ *    e com a passada de profundidade se o pacote pedir, e aplicar o pós-processamento
+ *    (bloom e FXAA), se ativo. A cena pode estar em resolução reduzida (ver
+ *    DynamicResolution), ajustada pelo tempo de desenho dos quadros, medido pelo
+ *    FrameTimer sem esperar a GPU.
+ * 2. Desenhar as linhas de depuração enfileiradas no DebugDraw.
+ * 3. Desenhar a interface 2D, como a mira e as mensagens de status, na resolução da tela.
+ */
+void Game::render() {
+    const RenderPacket* packet = _pipeline.acquireFrame();
+    if (!packet) return;
+    const bool dynamicResolution = Config::DYNAMIC_RESOLUTION && _postProcess.isActive();
+    const bool timed = dynamicResolution || Config::QUALITY_GOVERNOR;
+    if (timed) _frameTimer.begin();
+
+    // 1. Limpa a tela (ou a textura da cena) e desenha a cena 3D principal
+    _postProcess.beginScene();
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+    const CameraSnapshot& camera = packet->camera;
+    const Matrix4 view = Matrix4::lookAt(camera.position, camera.position + camera.front, camera.up);
+    glLoadMatrixf(view.m);
+    _lightManager.setFlashlightColor(packet->flashlight.color);
+    _lightManager.updateFlashlight(packet->flashlight.position, packet->flashlight.direction);
+
+    if (packet->depthPrepass) {
+        drawDepthPrepass(*packet, view);
+        glDepthFunc(GL_LEQUAL);
+        drawItems(*packet, view, 0, packet->roomItemCount);
+        glDepthFunc(GL_LESS);
+    } else {
+        drawItems(*packet, view, 0, packet->roomItemCount);
     }
+    if (!packet->portals.empty()) {
+        drawPortals(*packet, view, -1, 0);
+        glDisable(GL_STENCIL_TEST);
+        glDisable(GL_SCISSOR_TEST);
+    }
+    _postProcess.endScene();
+    glLoadMatrixf(view.m);
+
+    // 2. Desenha as linhas de depuração do quadro (vazias se o DebugDraw estiver desligado)
+    DebugDraw::draw(*packet);
+
+    // 3. Desenha a interface 2D por cima de tudo, num único lote
+    drawHud(*packet);
+
+    if (timed) _frameTimer.end();
 
     // 4. Mostra tudo na tela
     glutSwapBuffers();
+
+    // A medida chega um ou dois quadros depois (ver FrameTimer): a CPU não espera a GPU.
+    float frameMs = 0.0f;
+    if (timed && _frameTimer.poll(frameMs)) {
+        if (dynamicResolution && _resolution.addFrame(frameMs)) {
+            _postProcess.setRenderScale(_resolution.getScale());
+        }
+        // A resolução reage primeiro; a qualidade só muda com a escala parada num extremo.
+        if (Config::QUALITY_GOVERNOR) {
+            const float scale = _postProcess.getRenderScale();
+            const bool allowDown = !dynamicResolution || scale <= Config::RENDER_SCALE_MIN;
+            const bool allowUp = !dynamicResolution || scale >= 1.0f;
+            QualityGovernor::addFrame(frameMs, allowDown, allowUp);
+        }
+    }
+}
+
+/**
+ * @brief Desenha um trecho dos itens do pacote.
+ *
+ * Cada item recebe a sua matriz de modelo-visão pronta, sem glPushMatrix/glTranslatef.
+ *
+ * @param packet O pacote do quadro.
+ * @param view A matriz de visão das coordenadas dos itens.
+ * @param first O primeiro item.
+ * @param count Quantos itens.
+ */
+void Game::drawItems(const RenderPacket& packet, const Matrix4& view, size_t first, size_t count) {
+    for (size_t i = first; i < first + count; ++i) {
+        const DrawItem& item = packet.items[i];
+        const Matrix4 modelView = view * item.transform;
+        glLoadMatrixf(modelView.m);
+        item.object->draw(item);
+    }
+}
+
+/**
+ * @brief Grava só a profundidade dos itens opacos da sala atual.
+ *
+ * Depois dela, a passada de cor (com GL_LEQUAL) sombreia cada pixel uma única vez,
+ * no objeto visível. Os itens Overlay (texto e brilho desenhados por cima de outras
+ * peças) ficam de fora; os portais também, já que são desenhados depois e atrás da sala.
+ *
+ * @param packet O pacote do quadro (itens da sala já ordenados por DrawLayer).
+ * @param view A matriz de visão.
+ */
+void Game::drawDepthPrepass(const RenderPacket& packet, const Matrix4& view) {
+    size_t count = 0;
+    while (count < packet.roomItemCount && packet.items[count].layer != DrawLayer::Overlay) ++count;
+
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    drawItems(packet, view, 0, count);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+}
+
+/**
+ * @brief Desenha a abertura de um portal, sem iluminação nem textura.
+ * @param portal O portal (nas coordenadas da sala atual, com a visão já carregada).
+ */
+static void drawPortalQuad(const PortalView& portal) {
+    glPushAttrib(GL_ENABLE_BIT);
+    glDisable(GL_LIGHTING);
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_CULL_FACE);
+    glBegin(GL_QUADS);
+    for (const Vector3f& corner : portal.corners) {
+        glVertex3f(corner.x, corner.y, corner.z);
+    }
+    glEnd();
+    glPopAttrib();
+}
+
+/**
+ * @brief Registra no QualityGovernor os ajustes de qualidade.
+ *
+ * No empate, o governador desce primeiro o registrado antes e sobe primeiro o
+ * registrado depois: a ordem abaixo é a ordem em que a qualidade cai. O
+ * pós-processamento (várias passadas em tela cheia) vem primeiro por ser o mais caro.
+ */
+void Game::registerQualityKnobs() {
+    if (_postProcess.isActive()) {
+        // 0: sem efeitos, 1: só FXAA, 2: FXAA e bloom.
+        QualityGovernor::registerKnob("pos", 3, [this](int tier) {
+            _postProcess.setFxaaEnabled(tier >= 1);
+            _postProcess.setBloomEnabled(tier >= 2);
+        });
+    }
+    QualityGovernor::registerKnob("texturas", TextureManager::FILTER_TIERS, &TextureManager::setFilterTier);
+    QualityGovernor::registerKnob("lod", 3, [](int tier) {
+        static const float BIAS[] = {2.0f, 1.4f, 1.0f};
+        MeshManager::setLodBias(BIAS[tier]);
+    });
+    QualityGovernor::registerKnob("tesselacao", 3, [](int tier) {
+        static const float DENSITY[] = {0.5f, 0.75f, 1.0f};
+        MeshManager::setTessellation(DENSITY[tier]);
+    });
+}
+
+/**
+ * @brief Aplica o retângulo de tesoura do portal (em pixels da tela) na resolução em
+ * que a cena está sendo desenhada.
+ * @param portal O portal.
+ */
+void Game::setPortalScissor(const PortalView& portal) {
+    const float scale = _postProcess.getRenderScale();
+    const int x0 = static_cast<int>(std::floor(portal.scissor[0] * scale));
+    const int y0 = static_cast<int>(std::floor(portal.scissor[1] * scale));
+    const int x1 = static_cast<int>(std::ceil((portal.scissor[0] + portal.scissor[2]) * scale));
+    const int y1 = static_cast<int>(std::ceil((portal.scissor[1] + portal.scissor[3]) * scale));
+    glScissor(x0, y0, x1 - x0, y1 - y0);
+}
+
+/**
+ * @brief Desenha as salas vistas através dos portais filhos de `parent`.
+ *
+ * Para cada portal:
+ * 1. Marca no stencil os pixels da abertura que a sala de fora não esconde.
+ * 2. Nesses pixels, pinta a cor do céu e volta a profundidade para o máximo.
+ * 3. Desenha a sala de destino só nesses pixels (stencil), sem o que estiver
+ *    antes da porta (plano de recorte) e dentro do retângulo da abertura (tesoura).
+ * 4. Desce para os portais vistos através deste.
+ * 5. Fecha a abertura: desfaz a marca e grava a profundidade da porta, para que
+ *    os próximos portais sejam escondidos por ela corretamente.
+ *
+ * @param packet O pacote do quadro.
+ * @param view A matriz de visão da sala atual.
+ * @param parent O portal pai (-1 para os portais da sala atual).
+ * @param stencil O valor de stencil dos pixels onde o pai é visível.
+ */
+void Game::drawPortals(const RenderPacket& packet, const Matrix4& view, int parent, int stencil) {
+    for (size_t i = 0; i < packet.portals.size(); ++i) {
+        const PortalView& portal = packet.portals[i];
+        if (portal.parent != parent || portal.scissor[2] == 0 || portal.scissor[3] == 0) continue;
+
+        glEnable(GL_STENCIL_TEST);
+        glEnable(GL_SCISSOR_TEST);
+        setPortalScissor(portal);
+        glLoadMatrixf(view.m);
+
+        // 1. Marca a abertura.
+        glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        glDepthMask(GL_FALSE);
+        glStencilFunc(GL_EQUAL, stencil, 0xFF);
+        glStencilOp(GL_KEEP, GL_KEEP, GL_INCR);
+        drawPortalQuad(portal);
+
+        // 2. Limpa a abertura.
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        glDepthMask(GL_TRUE);
+        glStencilFunc(GL_EQUAL, stencil + 1, 0xFF);
+        glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+        glDepthFunc(GL_ALWAYS);
+        glDepthRange(1.0, 1.0);
+        glColor3f(Config::SKYBOX_R, Config::SKYBOX_G, Config::SKYBOX_B);
+        drawPortalQuad(portal);
+        glDepthRange(0.0, 1.0);
+        glDepthFunc(GL_LESS);
+
+        // 3. A sala de destino.
+        const GLdouble plane[4] = {portal.clipPlane.x, portal.clipPlane.y, portal.clipPlane.z, portal.clipPlane.w};
+        glClipPlane(GL_CLIP_PLANE0, plane);
+        glEnable(GL_CLIP_PLANE0);
+        drawItems(packet, view * portal.offset, portal.firstItem, portal.itemCount);
+        glDisable(GL_CLIP_PLANE0);
+
+        // 4. Os portais vistos através deste.
+        drawPortals(packet, view, static_cast<int>(i), stencil + 1);
+
+        // 5. Fecha a abertura.
+        glEnable(GL_STENCIL_TEST);
+        glEnable(GL_SCISSOR_TEST);
+        setPortalScissor(portal);
+        glLoadMatrixf(view.m);
+        glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        glStencilFunc(GL_EQUAL, stencil + 1, 0xFF);
+        glStencilOp(GL_KEEP, GL_KEEP, GL_DECR);
+        glDepthFunc(GL_ALWAYS);
+        drawPortalQuad(portal);
+        glDepthFunc(GL_LESS);
+        glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    }
+}
+
+/**
+ * @brief Monta e desenha o HUD do quadro: mira, inventário, visor do teclado e
+ * a mensagem de fim de jogo.
+ *
+ * Tudo é acumulado no Overlay e desenhado com uma única chamada.
+ *
+ * @param packet O pacote do quadro.
+ */
+void Game::drawHud(const RenderPacket& packet) {
+    const Vector3f white = {1.0f, 1.0f, 1.0f};
+    const Vector3f panel = {0.05f, 0.05f, 0.07f};
+    const float centerX = Config::SCREEN_WIDTH / 2.0f;
+    const float centerY = Config::SCREEN_HEIGHT / 2.0f;
+
+    _overlay.begin();
+
+    // Textos de depuração, atrás do resto do HUD.
+    const CameraSnapshot& camera = packet.camera;
+    DebugDraw::addLabels(packet, Matrix4::lookAt(camera.position, camera.position + camera.front, camera.up), _overlay);
+
+    // Mira: duas barras de 2 px cruzadas no centro da tela.
+    const float tamanho = 10.0f;
+    _overlay.addRect(centerX - 1.0f, centerY - tamanho, 2.0f, 2.0f * tamanho, white);
+    _overlay.addRect(centerX - tamanho, centerY - 1.0f, 2.0f * tamanho, 2.0f, white);
+
+    // Inventário: um espaço por item, no canto inferior esquerdo.
+    const float slotSize = 48.0f;
+    const float slotGap = 8.0f;
+    for (size_t i = 0; i < packet.hud.inventory.size(); ++i) {
+        float x = 16.0f + i * (slotSize + slotGap);
+        _overlay.addRect(x, 16.0f, slotSize, slotSize, panel, 0.6f);
+        _overlay.addFrame(x, 16.0f, slotSize, slotSize, 2.0f, white, 0.8f);
+        _overlay.addCenteredText(inventoryLabel(packet.hud.inventory[i]), x + slotSize / 2.0f,
+                                 16.0f + slotSize / 2.0f - 6.0f, white);
+    }
+
+    // Visor do teclado numérico, enquanto ele estiver ativo.
+    if (packet.hud.keypadActive) {
+        const std::string display = "CODIGO: " + packet.hud.keypadInput + "_";
+        const float width = std::max(240.0f, _overlay.measureText(display) + 32.0f);
+        const float height = _overlay.getLineHeight() + 20.0f;
+        const float y = centerY - 120.0f;
+        _overlay.addRect(centerX - width / 2.0f, y, width, height, panel, 0.75f);
+        _overlay.addFrame(centerX - width / 2.0f, y, width, height, 2.0f, {0.2f, 0.9f, 0.3f});
+        _overlay.addCenteredText(display, centerX, y + 14.0f, {0.2f, 1.0f, 0.3f});
+    }
+
+    // Mensagem de Fim de Jogo ou Vitória
+    if (packet.gameState != PLAYING) {
+        const char* msg = (packet.gameState == GAME_OVER) ? "GAME OVER - Pressione ESC para sair" : "VOCE VENCEU! - Pressione ESC para sair";
+        _overlay.addCenteredText(msg, centerX, centerY + 40.0f, white);
+    }
+
+    _overlay.flush();
 }
 
 /**
  * @brief Processa a interação do jogador com o ambiente.
  *
- * Lança um raio a partir do centro da tela para detectar o objeto interativo mais
+ * Lança um raio a partir da câmera, na direção em que ela olha (o centro da tela), para detectar o objeto interativo mais
  * próximo dentro de um raio de alcance. Se um objeto for encontrado, seu método
  * `onClick` é chamado.
  */
 void Game::processInteraction() {
-    Ray ray = calculateMouseRay(Config::SCREEN_WIDTH / 2, Config::SCREEN_HEIGHT / 2, _player);
+    const FPSCamera& camera = _player.getCamera();
+    Ray ray = {camera.getPosition(), camera.getFrontVector()};
     InteractableObject* closestObject = nullptr;
     float closestHitDistance = std::numeric_limits<float>::max();
     std::vector<InteractableObject*>& interactables = _sceneManager.getInteractableObjects();
 
+    // Esferas de colisão em vetores separados por componente, para o teste em lote.
+    InteractionBatch& batch = _interaction;
+    batch.candidates.clear();
+    batch.centerX.clear();
+    batch.centerY.clear();
+    batch.centerZ.clear();
+    batch.radius.clear();
     for (auto* obj : interactables) {
         if (obj->isInteractable()) {
-            float hitDistance = rayIntersectsSphere(ray, obj->getPosition(), obj->getCollisionRadius());
+            const Vector3f& position = obj->getPosition();
+            batch.candidates.push_back(obj);
+            batch.centerX.push_back(position.x);
+            batch.centerY.push_back(position.y);
+            batch.centerZ.push_back(position.z);
+            batch.radius.push_back(obj->getCollisionRadius());
+        }
+    }
 
-            // MUDANÇA: Verificamos se a distância é diferente de -1 (o valor de "sem colisão"),
-            // em vez de > 0. Isso permite interações quando estamos dentro da esfera de colisão.
-            if (hitDistance != -1.0f && hitDistance < closestHitDistance) {
-                closestHitDistance = hitDistance;
-                closestObject = obj;
-            }
+    const size_t count = batch.candidates.size();
+    batch.hitDistances.resize(count);
+    VectorMath::raySphereBatch(ray, batch.centerX.data(), batch.centerY.data(), batch.centerZ.data(),
+                               batch.radius.data(), count, batch.hitDistances.data());
+
+    for (size_t i = 0; i < count; ++i) {
+        // MUDANÇA: Verificamos se a distância é diferente de -1 (o valor de "sem colisão"),
+        // em vez de > 0. Isso permite interações quando estamos dentro da esfera de colisão.
+        if (batch.hitDistances[i] != -1.0f && batch.hitDistances[i] < closestHitDistance) {
+            closestHitDistance = batch.hitDistances[i];
+            closestObject = batch.candidates[i];
         }
     }
 
@@ -321,6 +734,50 @@ void Game::processInteraction() {
     }
 }
 
+/**
+ * @brief Enfileira um evento de entrada para a simulação.
+ *
+ * Acorda a simulação, se estiver dormindo, e, se o jogo estava ocioso, chama o
+ * callback de setWakeCallback para o GLUT voltar ao intervalo normal.
+ *
+ * @param event O evento a ser enfileirado.
+ */
+void Game::pushInput(const InputEvent& event) {
+    bool wasIdle;
+    {
+        std::lock_guard<std::mutex> lock(_inputMutex);
+        _pendingInput.push_back(event);
+        wasIdle = _idle.exchange(false);
+    }
+    _inputArrived.notify_one();
+    if (wasIdle && _onWake) _onWake();
+}
+
+/**
+ * @brief Processa, na simulação, todos os eventos de entrada enfileirados.
+ */
+void Game::drainInput() {
+    {
+        std::lock_guard<std::mutex> lock(_inputMutex);
+        _inputBatch.swap(_pendingInput);
+    }
+    if (!_inputBatch.empty()) _sceneChanged = true;
+    for (const InputEvent& event : _inputBatch) {
+        switch (event.type) {
+            case InputEvent::KEY_DOWN:
+                handleKeyDown(event.key);
+                break;
+            case InputEvent::KEY_UP:
+                _player.handleKeyUp(tolower(event.key));
+                break;
+            case InputEvent::MOUSE_MOTION:
+                _player.handleMouseMotion(event.x, event.y);
+                break;
+        }
+    }
+    _inputBatch.clear();
+}
+
 /**
  * @brief Processa o evento de uma tecla ser pressionada.
  *
@@ -328,19 +785,12 @@ void Game::processInteraction() {
  * Caso contrário, processa comandos como `Esc` para sair ou `E` para interagir.
  *
  * @param key A tecla pressionada.
- * @param x A coordenada X do mouse.
- * @param y A coordenada Y do mouse.
  */
-void Game::processKeyDown(unsigned char key, int x, int y) {
+void Game::handleKeyDown(unsigned char key) {
     if (_gameStateManager.isKeypadActive()) {
         if (key >= '0' && key <= '9') {
+            // O tamanho e o código vêm das regras; o teclado se desativa ao completar.
             _gameStateManager.appendToKeypadInput(key);
-            if (_gameStateManager.getKeypadInput().length() == 3) {
-                if (_gameStateManager.checkKeypadCode("742")) {
-                    _gameStateManager.setPuzzleState(PuzzleID::Sala1_CodigoCaixa, true);
-                }
-                _gameStateManager.setActiveKeypad(false);
-            }
         } else if (key == 27 || key == 'e') {
             _gameStateManager.setActiveKeypad(false);
         }
@@ -348,8 +798,12 @@ void Game::processKeyDown(unsigned char key, int x, int y) {
     }
 
     key = tolower(key);
+    if (key == '\t') {
+        DebugDraw::toggle();
+    }
     if (key == 27) {
-        glutLeaveMainLoop();
+        // glutLeaveMainLoop só pode ser chamado na thread do GLUT (ver tick).
+        _quitRequested = true;
     }
     if (key == 'e') {
         processInteraction();
@@ -358,21 +812,30 @@ void Game::processKeyDown(unsigned char key, int x, int y) {
 }
 
 /**
- * @brief Processa o evento de uma tecla ser liberada.
+ * @brief Recebe o evento de uma tecla ser pressionada.
+ * @param key A tecla pressionada.
+ * @param x A coordenada X do mouse.
+ * @param y A coordenada Y do mouse.
+ */
+void Game::processKeyDown(unsigned char key, int x, int y) {
+    pushInput({InputEvent::KEY_DOWN, key, x, y});
+}
+
+/**
+ * @brief Recebe o evento de uma tecla ser liberada.
  * @param key A tecla liberada.
  * @param x A coordenada X do mouse.
  * @param y A coordenada Y do mouse.
  */
 void Game::processKeyUp(unsigned char key, int x, int y) {
-    key = tolower(key);
-    _player.handleKeyUp(key);
+    pushInput({InputEvent::KEY_UP, key, x, y});
 }
 
 /**
  * @brief Processa o movimento do mouse para rotacionar a câmera.
  *
- * O mouse é reposicionado no centro da tela após cada movimento para
- * permitir rotação contínua e ilimitada.
+ * O movimento é enfileirado para a simulação, e o mouse é reposicionado no
+ * centro da tela após cada movimento para permitir rotação contínua e ilimitada.
  *
  * @param x A coordenada X do mouse.
  * @param y A coordenada Y do mouse.
@@ -381,6 +844,6 @@ void Game::processMouseMotion(int x, int y) {
     if (x == Config::SCREEN_WIDTH / 2 && y == Config::SCREEN_HEIGHT / 2) {
         return;
     }
-    _player.handleMouseMotion(x, y);
+    pushInput({InputEvent::MOUSE_MOTION, 0, x, y});
     glutWarpPointer(Config::SCREEN_WIDTH / 2, Config::SCREEN_HEIGHT / 2);
 }
@@ -7,6 +7,7 @@
 #include <algorithm> // Necessrio para std::find e std::remove
 #include <iostream>  // Para mensagens de depurao no console
 #include "../include/SceneManager.h"
+#include "../include/Config.h"
 
 /**
  * @brief Construtor padro da classe GameStateManager.
@@ -24,18 +25,73 @@ GameStateManager::GameStateManager() {
     _keypadInput = "";
 
     _isKeypadActive = false; // Comea inativo
+    _timers = nullptr;
+    _animations = nullptr;
+}
+
+/**
+ * @brief Define o agendador usado para timers do estado do jogo (ex.: expirao de entradas).
+ * @param timers A roda de timers do Game, ou nullptr para desativar os timers.
+ */
+void GameStateManager::setTimerWheel(TimerWheel* timers) {
+    _timers = timers;
+}
+
+/**
+ * @brief Obtm o agendador de timers, para objetos que precisam agendar aes futuras.
+ * @return A roda de timers, ou nullptr se nenhuma foi definida.
+ */
+TimerWheel* GameStateManager::getTimerWheel() const {
+    return _timers;
+}
+
+/**
+ * @brief Define o sistema de animao usado pelos objetos da cena.
+ * @param animations O AnimationSystem do Game, ou nullptr para aplicar as mudanas na hora.
+ */
+void GameStateManager::setAnimationSystem(AnimationSystem* animations) {
+    _animations = animations;
+}
+
+/**
+ * @brief Obtm o sistema de animao, para objetos que animam o prprio estado.
+ * @return O sistema de animao, ou nullptr se nenhum foi definido.
+ */
+AnimationSystem* GameStateManager::getAnimationSystem() const {
+    return _animations;
+}
+
+/**
+ * @brief Carrega as regras dos puzzles e avalia as que o estado inicial j satisfaz.
+ *
+ * O arquivo  a nica fonte das regras: sem ele, nenhum puzzle teria soluo.
+ *
+ * @param path O caminho do arquivo de regras.
+ * @return false se o arquivo no pde ser aberto ou tiver erros; nesse caso
+ * nenhuma regra  avaliada.
+ */
+bool GameStateManager::loadRules(const std::string& path) {
+    if (!_rules.loadFromFile(path)) return false;
+    _rules.evaluateAll(*this);
+    return true;
 }
 
 // --- MTODOS DE PUZZLE ---
 
 /**
  * @brief Define o estado de um puzzle especfico.
+ *
+ * Se o valor mudar, as regras que dependem deste puzzle so reavaliadas.
  * @param puzzleId O identificador do puzzle.
  * @param isSolved O novo estado do puzzle (true para resolvido, false para no resolvido).
  */
 void GameStateManager::setPuzzleState(const std::string& puzzleId, bool isSolved) {
+    bool changed = isPuzzleSolved(puzzleId) != isSolved;
     _puzzleStates[puzzleId] = isSolved;
     std::cout << "Estado do puzzle '" << puzzleId << "' definido como: " << (isSolved ? "RESOLVIDO" : "NAO RESOLVIDO") << std::endl;
+    if (changed) {
+        _rules.onFlagChanged(puzzleId, *this);
+    }
 }
 
 /**
@@ -64,6 +120,7 @@ void GameStateManager::addItemToInventory(ItemType item) {
     if (std::find(_inventory.begin(), _inventory.end(), item) == _inventory.end()) {
         _inventory.push_back(item);
         std::cout << "Item adicionado ao inventario!" << std::endl;
+        _rules.onItemChanged(item, *this);
     }
 }
 
@@ -77,14 +134,26 @@ bool GameStateManager::playerHasItem(ItemType item) const {
     return std::find(_inventory.begin(), _inventory.end(), item) != _inventory.end();
 }
 
+/**
+ * @brief Obtm os itens do inventrio, na ordem em que foram coletados.
+ * @return O vetor de itens do inventrio.
+ */
+const std::vector<ItemType>& GameStateManager::getInventory() const {
+    return _inventory;
+}
+
 /**
  * @brief Remove um item do inventrio do jogador.
  * @param item O tipo de item a ser removido.
  */
 void GameStateManager::removeItemFromInventory(ItemType item) {
+    bool had = playerHasItem(item);
     // Usa o padro erase-remove para remover todos os elementos correspondentes do vetor
     _inventory.erase(std::remove(_inventory.begin(), _inventory.end(), item), _inventory.end());
     std::cout << "Item removido do inventario!" << std::endl;
+    if (had) {
+        _rules.onItemChanged(item, *this);
+    }
 }
 
 // --- MTODOS ESPECFICOS PARA A SALA 1 ---
@@ -114,12 +183,15 @@ Vector3f GameStateManager::getCurrentFlashlightColor() {
 
 /**
  * @brief Adiciona um dgito  entrada do teclado numrico.
+ *
+ * Quando a entrada atinge o tamanho declarado para o canal "keypad" nas regras,
+ * o cdigo  avaliado e o teclado  desativado.
+ *
  * @param digit O caractere do dgito a ser adicionado.
  */
 void GameStateManager::appendToKeypadInput(char digit) {
-    if (_keypadInput.length() < 3) { // Limita a 3 dgitos
-        _keypadInput += digit;
-        std::cout << "Codigo atual no keypad: " << _keypadInput << std::endl;
+    if (pushInputSymbol(InputChannel::Keypad, _keypadInput, digit)) {
+        setActiveKeypad(false);
     }
 }
 
@@ -157,6 +229,11 @@ void GameStateManager::setActiveKeypad(bool isActive) {
     _isKeypadActive = isActive;
     if (!isActive) { // Limpa o input se o keypad for desativado
         _keypadInput = "";
+        auto timeout = _inputTimeouts.find(InputChannel::Keypad);
+        if (_timers && timeout != _inputTimeouts.end()) {
+            _timers->cancel(timeout->second);
+            timeout->second = TimerWheel::INVALID_TIMER;
+        }
     }
 }
 
@@ -167,3 +244,73 @@ void GameStateManager::setActiveKeypad(bool isActive) {
 bool GameStateManager::isKeypadActive() const {
     return _isKeypadActive;
 }
+
+// --- CANAIS DE ENTRADA ---
+
+/**
+ * @brief Adiciona um smbolo a um canal de entrada (ex.: a sequncia de botes).
+ * @param channel O nome do canal, declarado no arquivo de regras.
+ * @param symbol O smbolo a ser adicionado.
+ */
+void GameStateManager::appendToInput(const std::string& channel, char symbol) {
+    pushInputSymbol(channel, _inputs[channel], symbol);
+}
+
+/**
+ * @brief Obtm os smbolos j digitados em um canal de entrada.
+ * @param channel O nome do canal.
+ * @return A entrada atual, vazia se o canal ainda no recebeu nada.
+ */
+std::string GameStateManager::getInput(const std::string& channel) const {
+    auto it = _inputs.find(channel);
+    return (it == _inputs.end()) ? std::string() : it->second;
+}
+
+/**
+ * @brief Acrescenta um smbolo ao buffer de um canal e, quando o canal fica completo,
+ * entrega a entrada s regras e limpa o buffer.
+ *
+ * Se nenhum smbolo chegar em Config::INPUT_TIMEOUT_MS, a entrada incompleta 
+ * descartada (e o teclado numrico, desativado).
+ *
+ * @param channel O nome do canal.
+ * @param buffer O buffer de entrada do canal.
+ * @param symbol O smbolo a ser adicionado.
+ * @return true se a entrada ficou completa e foi avaliada.
+ */
+bool GameStateManager::pushInputSymbol(const std::string& channel, std::string& buffer, char symbol) {
+    size_t length = static_cast<size_t>(_rules.getInputLength(channel));
+    if (length == 0) {
+        std::cout << "Nenhuma regra usa o canal '" << channel << "'." << std::endl;
+        return false;
+    }
+
+    buffer += symbol;
+    std::cout << "Entrada atual em '" << channel << "': " << buffer << std::endl;
+
+    // Cada smbolo reinicia a contagem para descartar uma entrada abandonada pela metade.
+    if (_timers) {
+        TimerWheel::TimerId& timeout = _inputTimeouts[channel];
+        _timers->cancel(timeout);
+        timeout = TimerWheel::INVALID_TIMER;
+        if (buffer.length() < length) {
+            timeout = _timers->schedule(Config::INPUT_TIMEOUT_MS, [this, channel]() {
+                std::cout << "Entrada em '" << channel << "' expirou." << std::endl;
+                _inputTimeouts[channel] = TimerWheel::INVALID_TIMER;
+                if (channel == InputChannel::Keypad) setActiveKeypad(false);
+                else _inputs[channel].clear();
+            });
+        }
+    }
+    if (buffer.length() < length) {
+        return false;
+    }
+
+    if (_rules.onInput(channel, buffer, *this)) {
+        std::cout << "Codigo CORRETO!" << std::endl;
+    } else {
+        std::cout << "Codigo INCORRETO! Input resetado." << std::endl;
+    }
+    buffer.clear();
+    return true;
+}
@@ -0,0 +1,189 @@
+/**
+ * @file Impostor.cpp
+ * @brief Implementação do Impostor: a foto do objeto e o quadrilátero que a mostra.
+ */
+
+#include "../include/Impostor.h"
+#include "../include/GLExtensions.h"
+#include "../include/PostProcess.h"
+#include "../include/Config.h"
+#include <GL/freeglut.h>
+#include <cmath>
+#include <iostream>
+
+/** @brief A menor potência de dois que cobre `extent` com a resolução configurada. */
+static int textureSize(float extent) {
+    const int wanted = static_cast<int>(std::ceil(extent * Config::IMPOSTOR_TEXELS_PER_UNIT));
+    int size = 16;
+    while (size < wanted && size < Config::IMPOSTOR_MAX_SIZE) size *= 2;
+    return size;
+}
+
+/**
+ * @brief Construtor. Nada é criado no OpenGL aqui: a textura só existe a partir da
+ * primeira foto, na thread de OpenGL.
+ * @param localBounds A caixa do objeto nas suas coordenadas locais (a frente é +Z).
+ */
+Impostor::Impostor(const BoundingBox& localBounds)
+    : _bounds(localBounds), _texture(0), _width(0), _height(0),
+      _captured(false), _failed(false), _selected(false) {}
+
+/**
+ * @brief Decide se o objeto é desenhado como impostor neste quadro.
+ *
+ * Para entrar, o objeto precisa estar além de IMPOSTOR_DISTANCE * (1 + histerese);
+ * para sair, aquém de IMPOSTOR_DISTANCE * (1 - histerese). Assim ele não alterna
+ * a cada quadro perto do limite.
+ *
+ * @param eye A posição da câmera.
+ * @param center O centro do objeto, nas mesmas coordenadas.
+ * @return true se o objeto deve ser desenhado como impostor.
+ */
+bool Impostor::select(const Vector3f& eye, const Vector3f& center) {
+    if (_failed || !GLExtensions::hasFramebuffers()) return false;
+
+    const float dx = center.x - eye.x, dy = center.y - eye.y, dz = center.z - eye.z;
+    const float band = _selected ? (1.0f - Config::IMPOSTOR_HYSTERESIS) : (1.0f + Config::IMPOSTOR_HYSTERESIS);
+    const float threshold = Config::IMPOSTOR_DISTANCE * band;
+    _selected = dx * dx + dy * dy + dz * dz > threshold * threshold;
+    return _selected;
+}
+
+/**
+ * @brief Desenha o quadrilátero com a foto, tirando-a na primeira chamada.
+ *
+ * Se a foto falhar, o impostor passa a desenhar sempre o objeto inteiro, com a
+ * matriz de modelo-visão atual.
+ *
+ * @param drawFull Desenha o objeto inteiro (usada na foto e no caso de falha).
+ */
+void Impostor::draw(const DrawFunction& drawFull) {
+    if (!_failed && !_captured) {
+        if (capture(drawFull)) {
+            _captured = true;
+        } else {
+            std::cerr << "[Impostor] Não foi possível tirar a foto; o objeto será desenhado inteiro.\n";
+            _failed = true;
+        }
+    }
+
+    if (_failed) {
+        Matrix4 modelView;
+        glGetFloatv(GL_MODELVIEW_MATRIX, modelView.m);
+        drawFull(modelView);
+        return;
+    }
+    drawQuad();
+}
+
+/**
+ * @brief Desenha o objeto na textura, de frente, com a caixa local ocupando a foto inteira.
+ *
+ * O framebuffer e a profundidade só existem durante a foto; fica apenas a textura.
+ * Todo o estado do OpenGL é salvo e restaurado: a foto pode ser pedida no meio da
+ * cena, dentro de um portal (tesoura, stencil, plano de corte) ou na passada de
+ * profundidade (cor desligada).
+ *
+ * @param drawFull Desenha o objeto inteiro, em coordenadas locais.
+ * @return false se o framebuffer não ficar completo.
+ */
+bool Impostor::capture(const DrawFunction& drawFull) {
+    if (_texture == 0) {
+        _width = textureSize(_bounds.max.x - _bounds.min.x);
+        _height = textureSize(_bounds.max.y - _bounds.min.y);
+
+        glGenTextures(1, &_texture);
+        glBindTexture(GL_TEXTURE_2D, _texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, _width, _height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    GLint previousFramebuffer = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+
+    GLuint depth = 0, framebuffer = 0;
+    GLExtensions::genRenderbuffers(1, &depth);
+    GLExtensions::bindRenderbuffer(GL_RENDERBUFFER, depth);
+    GLExtensions::renderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, _width, _height);
+    GLExtensions::bindRenderbuffer(GL_RENDERBUFFER, 0);
+    GLExtensions::genFramebuffers(1, &framebuffer);
+    GLExtensions::bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    GLExtensions::framebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _texture, 0);
+    GLExtensions::framebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth);
+
+    const bool complete = GLExtensions::checkFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    if (complete) {
+        glPushAttrib(GL_ALL_ATTRIB_BITS);
+        glDisable(GL_SCISSOR_TEST);
+        glDisable(GL_STENCIL_TEST);
+        glDisable(GL_CLIP_PLANE0);
+        glDisable(GL_BLEND);
+        glEnable(GL_DEPTH_TEST);
+        glDepthFunc(GL_LESS);
+        glDepthMask(GL_TRUE);
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        glViewport(0, 0, _width, _height);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        // Câmera em +Z olhando para -Z: a frente do objeto.
+        glMatrixMode(GL_PROJECTION);
+        glPushMatrix();
+        glLoadIdentity();
+        glOrtho(_bounds.min.x, _bounds.max.x, _bounds.min.y, _bounds.max.y, -_bounds.max.z, -_bounds.min.z);
+        glMatrixMode(GL_MODELVIEW);
+        glPushMatrix();
+
+        // A foto não passa pelo pós-processamento: o brilho vai para ela com o efeito próprio do objeto.
+        const bool bloom = PostProcess::setBloomActive(false);
+        drawFull(Matrix4::identity());
+        PostProcess::setBloomActive(bloom);
+
+        glPopMatrix();
+        glMatrixMode(GL_PROJECTION);
+        glPopMatrix();
+        glMatrixMode(GL_MODELVIEW);
+        glPopAttrib();
+    }
+
+    GLExtensions::bindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previousFramebuffer));
+    GLExtensions::deleteFramebuffers(1, &framebuffer);
+    GLExtensions::deleteRenderbuffers(1, &depth);
+    return complete;
+}
+
+/**
+ * @brief Desenha a foto no plano da frente da caixa, sem iluminação, recortada pelo alfa.
+ *
+ * Com bloom, o alfa da cena é o canal emissivo (ver PostProcess), então o
+ * quadrilátero não o escreve e o ponto continua com o alfa do que havia atrás.
+ */
+void Impostor::drawQuad() const {
+    glPushAttrib(GL_ENABLE_BIT | GL_CURRENT_BIT | GL_COLOR_BUFFER_BIT | GL_TEXTURE_BIT);
+    glDisable(GL_LIGHTING);
+    glDisable(GL_CULL_FACE);
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, _texture);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
+    glEnable(GL_ALPHA_TEST);
+    glAlphaFunc(GL_GREATER, 0.5f);
+    if (PostProcess::isBloomActive()) {
+        GLboolean mask[4];
+        glGetBooleanv(GL_COLOR_WRITEMASK, mask);
+        glColorMask(mask[0], mask[1], mask[2], GL_FALSE);
+    }
+
+    const BoundingBox& b = _bounds;
+    glBegin(GL_QUADS);
+    glTexCoord2f(0.0f, 0.0f); glVertex3f(b.min.x, b.min.y, b.max.z);
+    glTexCoord2f(1.0f, 0.0f); glVertex3f(b.max.x, b.min.y, b.max.z);
+    glTexCoord2f(1.0f, 1.0f); glVertex3f(b.max.x, b.max.y, b.max.z);
+    glTexCoord2f(0.0f, 1.0f); glVertex3f(b.min.x, b.max.y, b.max.z);
+    glEnd();
+
+    glPopAttrib();
+}
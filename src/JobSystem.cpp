@@ -0,0 +1,359 @@
+/**
+ * @file JobSystem.cpp
+ * @brief Implementação do pool de threads com roubo de tarefas e do grafo de tarefas.
+ */
+
+#include "../include/JobSystem.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// --- ESTADO INTERNO DO POOL ---
+
+/**
+ * @brief Uma tarefa enfileirada e o contador que ela deve decrementar ao terminar.
+ */
+struct QueuedJob {
+    JobSystem::Job job;
+    JobCounter* counter;
+};
+
+/**
+ * @brief Fila de uma thread trabalhadora.
+ *
+ * A dona da fila trabalha no fim (LIFO, melhor localidade de cache);
+ * as outras threads roubam do início (FIFO, pegam as tarefas mais antigas).
+ */
+struct WorkQueue {
+    std::mutex mutex;
+    std::deque<QueuedJob> jobs;
+};
+
+static std::vector<std::thread> s_workers;
+static std::vector<WorkQueue*> s_queues;
+static std::atomic<int> s_queuedJobs(0);
+static std::atomic<unsigned int> s_nextQueue(0);
+static std::atomic<bool> s_stopping(false);
+static std::mutex s_sleepMutex;
+static std::condition_variable s_sleepCondition;
+
+/** @brief Índice da fila da thread atual, ou -1 se ela não for uma trabalhadora. */
+static thread_local int t_queueIndex = -1;
+
+/**
+ * @brief Retira uma tarefa do fim da fila indicada (uso pela dona da fila).
+ */
+static bool popLocal(int index, QueuedJob& out) {
+    WorkQueue* queue = s_queues[index];
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    if (queue->jobs.empty()) return false;
+    out = std::move(queue->jobs.back());
+    queue->jobs.pop_back();
+    return true;
+}
+
+/**
+ * @brief Rouba uma tarefa do início da fila de outra thread.
+ * @param thiefIndex A fila de quem está roubando (ignorada na busca), ou -1.
+ */
+static bool steal(int thiefIndex, QueuedJob& out) {
+    const int count = (int)s_queues.size();
+    const int start = (thiefIndex < 0) ? 0 : thiefIndex + 1;
+    for (int i = 0; i < count; ++i) {
+        int victim = (start + i) % count;
+        if (victim == thiefIndex) continue;
+        WorkQueue* queue = s_queues[victim];
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        if (!queue->jobs.empty()) {
+            out = std::move(queue->jobs.front());
+            queue->jobs.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Tenta obter uma tarefa: primeiro da própria fila, depois roubando.
+ */
+static bool findJob(QueuedJob& out) {
+    if (s_queues.empty()) return false;
+    if (t_queueIndex >= 0 && popLocal(t_queueIndex, out)) return true;
+    return steal(t_queueIndex, out);
+}
+
+/**
+ * @brief Executa uma tarefa e sinaliza o seu contador.
+ */
+static void execute(QueuedJob& queued) {
+    s_queuedJobs.fetch_sub(1);
+    queued.job();
+    if (queued.counter) {
+        queued.counter->pending.fetch_sub(1);
+    }
+}
+
+/**
+ * @brief Laço principal de cada thread trabalhadora.
+ */
+static void workerLoop(int index) {
+    t_queueIndex = index;
+    while (true) {
+        QueuedJob queued;
+        if (findJob(queued)) {
+            execute(queued);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(s_sleepMutex);
+        s_sleepCondition.wait(lock, [] { return s_stopping.load() || s_queuedJobs.load() > 0; });
+        if (s_stopping.load()) break;
+    }
+    t_queueIndex = -1;
+}
+
+// --- IMPLEMENTAÇÃO DO JOBSYSTEM ---
+
+/**
+ * @brief Cria as threads trabalhadoras e suas filas.
+ *
+ * Chamadas repetidas são ignoradas enquanto o pool estiver ativo.
+ *
+ * @param workerCount Número de trabalhadoras. 0 usa (núcleos - 1), deixando
+ * um núcleo para a thread que chama o sistema.
+ */
+void JobSystem::init(unsigned int workerCount) {
+    if (!s_workers.empty()) return;
+
+    if (workerCount == 0) {
+        unsigned int cores = std::thread::hardware_concurrency();
+        workerCount = (cores > 1) ? cores - 1 : 0;
+    }
+
+    s_stopping = false;
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        s_queues.push_back(new WorkQueue());
+    }
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        s_workers.push_back(std::thread(workerLoop, (int)i));
+    }
+}
+
+/**
+ * @brief Acorda todas as trabalhadoras, aguarda seu término e libera as filas.
+ *
+ * Tarefas que ainda estiverem nas filas são descartadas.
+ */
+void JobSystem::shutdown() {
+    if (s_workers.empty()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(s_sleepMutex);
+        s_stopping = true;
+    }
+    s_sleepCondition.notify_all();
+    for (std::thread& worker : s_workers) {
+        worker.join();
+    }
+    s_workers.clear();
+
+    for (WorkQueue* queue : s_queues) {
+        delete queue;
+    }
+    s_queues.clear();
+    s_queuedJobs = 0;
+}
+
+/**
+ * @brief Obtém o número de threads trabalhadoras ativas.
+ * @return O número de trabalhadoras (0 quando o sistema roda em modo serial).
+ */
+unsigned int JobSystem::getWorkerCount() {
+    return (unsigned int)s_workers.size();
+}
+
+/**
+ * @brief Enfileira uma tarefa.
+ *
+ * Tarefas criadas por uma trabalhadora vão para a fila dela; as demais são
+ * distribuídas em rodízio entre as filas. Sem trabalhadoras, a tarefa é
+ * executada imediatamente.
+ *
+ * @param job A função a ser executada.
+ * @param counter Contador a ser sinalizado quando a tarefa terminar (pode ser nulo).
+ */
+void JobSystem::submit(const Job& job, JobCounter* counter) {
+    if (counter) counter->pending.fetch_add(1);
+
+    if (s_queues.empty()) {
+        job();
+        if (counter) counter->pending.fetch_sub(1);
+        return;
+    }
+
+    int index = t_queueIndex;
+    if (index < 0) {
+        index = (int)(s_nextQueue.fetch_add(1) % s_queues.size());
+    }
+    {
+        std::lock_guard<std::mutex> lock(s_queues[index]->mutex);
+        s_queues[index]->jobs.push_back(QueuedJob{job, counter});
+    }
+    {
+        // Incrementa sob o mutex de espera para não perder o aviso de uma trabalhadora
+        // que acabou de testar o predicado e está prestes a dormir.
+        std::lock_guard<std::mutex> lock(s_sleepMutex);
+        s_queuedJobs.fetch_add(1);
+    }
+    s_sleepCondition.notify_one();
+}
+
+/**
+ * @brief Espera o contador zerar, executando tarefas pendentes enquanto isso.
+ * @param counter O contador do grupo de tarefas.
+ */
+void JobSystem::wait(JobCounter& counter) {
+    while (counter.pending.load() > 0) {
+        QueuedJob queued;
+        if (findJob(queued)) {
+            execute(queued);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/**
+ * @brief Executa `body` sobre [0, count) dividido em blocos paralelos.
+ *
+ * O primeiro bloco é executado pela própria thread chamadora, que depois
+ * ajuda com os blocos restantes até todos terminarem.
+ *
+ * @param count Número total de elementos.
+ * @param minBatch Tamanho mínimo de cada bloco.
+ * @param body Função chamada com o intervalo [begin, end) de cada bloco.
+ */
+void JobSystem::parallelFor(size_t count, size_t minBatch, const RangeJob& body) {
+    if (count == 0) return;
+    if (minBatch == 0) minBatch = 1;
+
+    const size_t threads = s_workers.size() + 1;
+    if (threads == 1 || count <= minBatch) {
+        body(0, count);
+        return;
+    }
+
+    // Alguns blocos a mais que threads ajudam a equilibrar a carga via roubo.
+    size_t batches = std::min((count + minBatch - 1) / minBatch, threads * 4);
+    size_t batchSize = (count + batches - 1) / batches;
+
+    JobCounter counter;
+    for (size_t begin = batchSize; begin < count; begin += batchSize) {
+        size_t end = std::min(count, begin + batchSize);
+        submit([&body, begin, end]() { body(begin, end); }, &counter);
+    }
+    body(0, std::min(count, batchSize));
+    wait(counter);
+}
+
+// --- IMPLEMENTAÇÃO DO TASKGRAPH ---
+
+/**
+ * @brief Adiciona uma tarefa ao grafo.
+ * @param job A função da tarefa.
+ * @return O identificador da nova tarefa.
+ */
+TaskGraph::TaskId TaskGraph::addTask(const JobSystem::Job& job) {
+    Node node;
+    node.job = job;
+    node.predecessorCount = 0;
+    _nodes.push_back(node);
+    return (TaskId)_nodes.size() - 1;
+}
+
+/**
+ * @brief Declara que a tarefa `after` depende da tarefa `before`.
+ *
+ * Como nenhuma aresta que feche um ciclo é aceita, o grafo é sempre acíclico e
+ * run sempre executa todas as tarefas.
+ *
+ * @param before A tarefa que precisa terminar primeiro.
+ * @param after A tarefa que espera.
+ * @return false se algum identificador for inválido ou se `before` já depender
+ * (direta ou indiretamente) de `after`, inclusive before == after.
+ */
+bool TaskGraph::addDependency(TaskId before, TaskId after) {
+    if (before < 0 || after < 0 || before >= (TaskId)_nodes.size() || after >= (TaskId)_nodes.size()) return false;
+    if (reaches(after, before)) return false;
+    _nodes[before].successors.push_back(after);
+    _nodes[after].predecessorCount++;
+    return true;
+}
+
+/**
+ * @brief Testa se `to` depende, direta ou indiretamente, de `from` (busca em profundidade).
+ * @return true também se from == to.
+ */
+bool TaskGraph::reaches(TaskId from, TaskId to) const {
+    std::vector<char> visited(_nodes.size(), 0);
+    std::vector<TaskId> stack(1, from);
+    visited[from] = 1;
+    while (!stack.empty()) {
+        TaskId id = stack.back();
+        stack.pop_back();
+        if (id == to) return true;
+        for (TaskId next : _nodes[id].successors) {
+            if (!visited[next]) {
+                visited[next] = 1;
+                stack.push_back(next);
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Enfileira uma tarefa; ao terminar, ela libera os sucessores cujas dependências zeraram.
+ */
+void TaskGraph::launch(TaskId id, JobCounter& counter) {
+    JobSystem::submit([this, id, &counter]() {
+        _nodes[id].job();
+        for (TaskId next : _nodes[id].successors) {
+            if (_remaining[next].fetch_sub(1) == 1) {
+                launch(next, counter);
+            }
+        }
+    }, &counter);
+}
+
+/**
+ * @brief Executa o grafo inteiro e bloqueia até todas as tarefas terminarem.
+ *
+ * Tarefas sem dependências são enfileiradas de imediato; as demais são
+ * enfileiradas pela última dependência a terminar.
+ */
+void TaskGraph::run() {
+    if (_nodes.empty()) return;
+
+    _remaining.reset(new std::atomic<int>[_nodes.size()]);
+    for (size_t i = 0; i < _nodes.size(); ++i) {
+        _remaining[i] = _nodes[i].predecessorCount;
+    }
+
+    JobCounter counter;
+    for (size_t i = 0; i < _nodes.size(); ++i) {
+        if (_nodes[i].predecessorCount == 0) {
+            launch((TaskId)i, counter);
+        }
+    }
+    JobSystem::wait(counter);
+}
+
+/**
+ * @brief Remove todas as tarefas e dependências do grafo.
+ */
+void TaskGraph::clear() {
+    _nodes.clear();
+    _remaining.reset();
+}
@@ -74,13 +74,12 @@ void Key::update(float deltaTime, GameStateManager& gameStateManager) {
 }
 
 /**
- * @brief Renderiza a chave na tela.
- *
- * A chave s  renderizada se estiver visvel e ainda no tiver sido coletada.
+ * @brief Registra a chave no pacote do quadro apenas se ela estiver visvel e no coletada.
+ * @param packet O pacote do quadro sendo montado pela simulao.
  */
-void Key::render() {
+void Key::collectDrawItems(RenderPacket& packet) {
     if (_isVisible && !_isCollected) {
-        _visual.render();
+        _visual.collectDrawItems(packet);
     }
 }
 
@@ -8,19 +8,17 @@
 #include <GL/freeglut.h>
 #include <iostream>
 
-/**
- * @brief Objeto visual esttico para representar o keypad.
- *
- * O objeto  um 'PrimitiveObject' do tipo 'TEAPOT' (bule) com
- * posies, cores e brilho predefinidos.
- */
-static PrimitiveObject visualKeypad(PrimitiveShape::TEAPOT, {0,0,0}, {0.3f, 0.3f, 0.3f}, {0.5f, 0.5f, 0.5f});
-
 /**
  * @brief Construtor da classe Keypad.
+ *
+ * O visual  um 'PrimitiveObject' do tipo 'TEAPOT' (bule) com
+ * cor e escala predefinidas, j posicionado no lugar do teclado.
+ *
  * @param position A posio do teclado numrico no espao 3D.
  */
-Keypad::Keypad(const Vector3f& position) : InteractableObject(position) {}
+Keypad::Keypad(const Vector3f& position)
+    : InteractableObject(position),
+      _visual(PrimitiveShape::TEAPOT, position, {0.3f, 0.3f, 0.3f}, {0.5f, 0.5f, 0.5f}) {}
 
 /**
  * @brief Atualiza o estado do teclado numrico.
@@ -36,16 +34,11 @@ void Keypad::update(float deltaTime, GameStateManager& gameStateManager) {
 }
 
 /**
- * @brief Renderiza o teclado numrico no ambiente 3D.
- *
- * Utiliza glPushMatrix e glPopMatrix para isolar as transformaes
- * de renderizao.
+ * @brief Registra o visual do teclado no pacote do quadro.
+ * @param packet O pacote do quadro sendo montado pela simulao.
  */
-void Keypad::render() {
-    glPushMatrix();
-    glTranslatef(_position.x, _position.y, _position.z);
-    visualKeypad.render();
-    glPopMatrix();
+void Keypad::collectDrawItems(RenderPacket& packet) {
+    _visual.collectDrawItems(packet);
 }
 
 /**
@@ -62,7 +55,7 @@ void Keypad::onClick(GameStateManager& gameStateManager) {
         std::cout << "Keypad desativado." << std::endl;
     } else {
         gameStateManager.setActiveKeypad(true);
-        std::cout << "Keypad ativado! Digite o codigo de 3 digitos." << std::endl;
+        std::cout << "Keypad ativado! Digite o codigo." << std::endl;
     }
 }
 
@@ -0,0 +1,334 @@
+/**
+ * @file LightBaker.cpp
+ * @brief Implementação do cálculo, do empacotamento e do cache dos lightmaps.
+ */
+
+#include "../include/LightBaker.h"
+#include "../include/VectorMath.h"
+#include "../include/JobSystem.h"
+#include "../include/Hash.h"
+#include "../include/Config.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+/** @brief Identifica o formato do arquivo de cache. */
+static const char LIGHTMAP_MAGIC[4] = {'L', 'M', 'P', '1'};
+/** @brief Afastamento da origem dos raios em relação à superfície. */
+static const float RAY_OFFSET = 0.01f;
+/** @brief Maior lado, em texels, de uma única superfície. */
+static const int MAX_SURFACE_TEXELS = 256;
+
+/**
+ * @brief O tamanho (em texels, sem a borda) da área de uma superfície.
+ */
+static void texelSize(const BakeSurface& surface, int& width, int& height) {
+    width = static_cast<int>(std::ceil(length(surface.axisU) * Config::LIGHTMAP_TEXELS_PER_UNIT));
+    height = static_cast<int>(std::ceil(length(surface.axisV) * Config::LIGHTMAP_TEXELS_PER_UNIT));
+    width = std::max(1, std::min(width, MAX_SURFACE_TEXELS));
+    height = std::max(1, std::min(height, MAX_SURFACE_TEXELS));
+}
+
+/**
+ * @brief Se o raio o + t·d, com t em [0, maxT], encosta na caixa (teste das placas).
+ * Um raio que começa dentro da caixa conta como bloqueado.
+ */
+static bool rayHitsBox(const Vector3f& origin, const Vector3f& direction, float maxT, const BoundingBox& box) {
+    const float o[3] = {origin.x, origin.y, origin.z};
+    const float d[3] = {direction.x, direction.y, direction.z};
+    const float lo[3] = {box.min.x, box.min.y, box.min.z};
+    const float hi[3] = {box.max.x, box.max.y, box.max.z};
+
+    float tMin = 0.0f, tMax = maxT;
+    for (int axis = 0; axis < 3; ++axis) {
+        if (std::fabs(d[axis]) < 1e-8f) {
+            if (o[axis] < lo[axis] || o[axis] > hi[axis]) return false;
+            continue;
+        }
+        float t1 = (lo[axis] - o[axis]) / d[axis];
+        float t2 = (hi[axis] - o[axis]) / d[axis];
+        if (t1 > t2) std::swap(t1, t2);
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+        if (tMin > tMax) return false;
+    }
+    return true;
+}
+
+static bool occluded(const Vector3f& origin, const Vector3f& direction, float maxT,
+                     const std::vector<BoundingBox>& occluders) {
+    for (const BoundingBox& box : occluders) {
+        if (rayHitsBox(origin, direction, maxT, box)) return true;
+    }
+    return false;
+}
+
+/** @brief Um número em [0, 1) a partir de um inteiro (o mesmo resultado em qualquer execução). */
+static float hashToUnit(uint32_t value) {
+    value ^= value >> 16;
+    value *= 0x7feb352du;
+    value ^= value >> 15;
+    value *= 0x846ca68bu;
+    value ^= value >> 16;
+    return (value >> 8) * (1.0f / 16777216.0f);
+}
+
+// --- CÁLCULO ---
+
+/**
+ * @brief Calcula (ou lê do cache) o lightmap das superfícies.
+ */
+void LightBaker::bake(const std::vector<BakeSurface>& surfaces, const std::vector<BoundingBox>& occluders,
+                      const std::vector<BakedLight>& lights, const std::string& cacheFile, Lightmap& out) {
+    std::vector<int> placement;
+    if (!layout(surfaces, out, placement)) {
+        std::cerr << "[Lightmap] As superfícies não cabem em " << Config::LIGHTMAP_MAX_SIZE << "x"
+                  << Config::LIGHTMAP_MAX_SIZE << " texels; a sala fica sem iluminação pré-calculada.\n";
+        out._pixels.clear();
+        return;
+    }
+
+    const uint64_t key = cacheKey(surfaces, occluders, lights);
+    if (load(cacheFile, key, out)) {
+        std::cout << "[Lightmap] Lido de " << cacheFile << "\n";
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    out._pixels.assign(static_cast<size_t>(out._width) * out._height * 3, 0);
+    JobSystem::parallelFor(surfaces.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (surfaces[i].hidden) continue;
+            int width, height;
+            texelSize(surfaces[i], width, height);
+            bakeSurface(surfaces[i], occluders, lights, placement[2 * i], placement[2 * i + 1], width, height, out);
+        }
+    });
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    std::cout << "[Lightmap] " << cacheFile << ": " << out._width << "x" << out._height << " texels calculados em "
+              << elapsed.count() << " ms\n";
+
+    save(cacheFile, key, out);
+}
+
+/**
+ * @brief Empacota as áreas das superfícies em prateleiras, na menor textura
+ * quadrada (potência de dois) em que couberem.
+ *
+ * Cada área ganha uma borda de um texel, preenchida com a cor da beirada, para que
+ * a filtragem linear não misture superfícies vizinhas.
+ *
+ * @param placement Recebe o canto (x, y) da área, com borda, de cada superfície.
+ * @return false se não couber em Config::LIGHTMAP_MAX_SIZE.
+ */
+bool LightBaker::layout(const std::vector<BakeSurface>& surfaces, Lightmap& out, std::vector<int>& placement) {
+    const int count = static_cast<int>(surfaces.size());
+    std::vector<int> sizes(2 * (count + 1), 0);
+    std::vector<int> order;
+    long area = 0;
+    for (int i = 0; i < count; ++i) {
+        if (surfaces[i].hidden) continue;
+        texelSize(surfaces[i], sizes[2 * i], sizes[2 * i + 1]);
+        sizes[2 * i] += 2;
+        sizes[2 * i + 1] += 2;
+        area += static_cast<long>(sizes[2 * i]) * sizes[2 * i + 1];
+        order.push_back(i);
+    }
+    // A área escura: um texel preto com a sua borda.
+    sizes[2 * count] = sizes[2 * count + 1] = 3;
+    order.push_back(count);
+    area += 9;
+
+    std::stable_sort(order.begin(), order.end(), [&sizes](int a, int b) { return sizes[2 * a + 1] > sizes[2 * b + 1]; });
+
+    int side = 16;
+    while (static_cast<long>(side) * side < area && side < Config::LIGHTMAP_MAX_SIZE) side <<= 1;
+
+    placement.assign(2 * (count + 1), -1);
+    for (; side <= Config::LIGHTMAP_MAX_SIZE; side <<= 1) {
+        int x = 0, y = 0, shelfHeight = 0;
+        bool fits = true;
+        for (int index : order) {
+            const int width = sizes[2 * index], height = sizes[2 * index + 1];
+            if (width > side) { fits = false; break; }
+            if (x + width > side) {
+                x = 0;
+                y += shelfHeight;
+                shelfHeight = 0;
+            }
+            if (y + height > side) { fits = false; break; }
+            placement[2 * index] = x;
+            placement[2 * index + 1] = y;
+            x += width;
+            shelfHeight = std::max(shelfHeight, height);
+        }
+        if (fits) break;
+    }
+    if (side > Config::LIGHTMAP_MAX_SIZE) return false;
+
+    out._width = out._height = side;
+    const float size = static_cast<float>(side);
+    const int darkX = placement[2 * count], darkY = placement[2 * count + 1];
+    out._darkRect = {(darkX + 1.5f) / size, (darkY + 1.5f) / size, (darkX + 1.5f) / size, (darkY + 1.5f) / size};
+    out._rects.assign(count, out._darkRect);
+    for (int i = 0; i < count; ++i) {
+        if (surfaces[i].hidden) continue;
+        const int x = placement[2 * i] + 1, y = placement[2 * i + 1] + 1;
+        const int width = sizes[2 * i] - 2, height = sizes[2 * i + 1] - 2;
+        out._rects[i] = {x / size, y / size, (x + width) / size, (y + height) / size};
+    }
+    return true;
+}
+
+/**
+ * @brief Calcula os texels de uma superfície.
+ *
+ * Ambiente: Config::AMBIENT_LIGHT_INTENSITY vezes a fração dos raios (distribuídos
+ * por cosseno, estratificados) que não encontram nenhum oclusor até
+ * Config::LIGHTMAP_AO_DISTANCE. Luzes: Lambert com queda quadrática até o raio da
+ * luz, e um raio de sombra até ela.
+ */
+void LightBaker::bakeSurface(const BakeSurface& surface, const std::vector<BoundingBox>& occluders,
+                             const std::vector<BakedLight>& lights, int x, int y, int width, int height, Lightmap& out) {
+    const Vector3f normal = normalize(surface.normal);
+    const Vector3f helper = (std::fabs(normal.y) < 0.9f) ? Vector3f{0.0f, 1.0f, 0.0f} : Vector3f{1.0f, 0.0f, 0.0f};
+    const Vector3f tangent = normalize(cross(helper, normal));
+    const Vector3f bitangent = cross(normal, tangent);
+    const int strata = std::max(1, static_cast<int>(std::lround(std::sqrt(static_cast<float>(Config::LIGHTMAP_AO_SAMPLES)))));
+    const float twoPi = 6.28318531f;
+
+    auto texel = [&out](int px, int py) { return &out._pixels[(static_cast<size_t>(py) * out._width + px) * 3]; };
+
+    for (int j = 0; j < height; ++j) {
+        for (int i = 0; i < width; ++i) {
+            const float s = (i + 0.5f) / width;
+            const float t = (j + 0.5f) / height;
+            const Vector3f point = surface.origin + surface.axisU * s + surface.axisV * t;
+            const Vector3f origin = point + normal * RAY_OFFSET;
+
+            int open = 0;
+            const uint32_t seed = static_cast<uint32_t>((x + i) * 73856093u) ^ static_cast<uint32_t>((y + j) * 19349663u);
+            for (int a = 0; a < strata; ++a) {
+                for (int b = 0; b < strata; ++b) {
+                    const uint32_t sample = seed + static_cast<uint32_t>(a * strata + b) * 83492791u;
+                    const float u = (a + hashToUnit(sample)) / strata;
+                    const float v = (b + hashToUnit(sample ^ 0x9e3779b9u)) / strata;
+                    const float radius = std::sqrt(u);
+                    const float angle = twoPi * v;
+                    const Vector3f direction = tangent * (radius * std::cos(angle)) + bitangent * (radius * std::sin(angle)) +
+                                               normal * std::sqrt(std::max(0.0f, 1.0f - u));
+                    if (!occluded(origin, direction, Config::LIGHTMAP_AO_DISTANCE, occluders)) ++open;
+                }
+            }
+            const float ambient = Config::AMBIENT_LIGHT_INTENSITY * open / (strata * strata);
+            Vector3f light = {ambient, ambient, ambient};
+
+            for (const BakedLight& source : lights) {
+                const Vector3f toLight = source.position - point;
+                const float distance = length(toLight);
+                if (distance >= source.radius || distance < 1e-4f) continue;
+                const Vector3f direction = toLight / distance;
+                const float lambert = dot(normal, direction);
+                if (lambert <= 0.0f || occluded(origin, direction, distance - RAY_OFFSET, occluders)) continue;
+                const float falloff = (1.0f - distance / source.radius) * (1.0f - distance / source.radius);
+                light += source.color * (lambert * falloff);
+            }
+
+            uint8_t* pixel = texel(x + 1 + i, y + 1 + j);
+            pixel[0] = static_cast<uint8_t>(std::min(1.0f, light.x * surface.albedo.x) * 255.0f + 0.5f);
+            pixel[1] = static_cast<uint8_t>(std::min(1.0f, light.y * surface.albedo.y) * 255.0f + 0.5f);
+            pixel[2] = static_cast<uint8_t>(std::min(1.0f, light.z * surface.albedo.z) * 255.0f + 0.5f);
+        }
+    }
+
+    // Borda: cópia do texel interno mais próximo.
+    for (int j = 0; j < height + 2; ++j) {
+        for (int i = 0; i < width + 2; ++i) {
+            if (i > 0 && j > 0 && i <= width && j <= height) continue;
+            const int si = std::max(1, std::min(i, width));
+            const int sj = std::max(1, std::min(j, height));
+            std::memcpy(texel(x + i, y + j), texel(x + si, y + sj), 3);
+        }
+    }
+}
+
+// --- CACHE ---
+
+/**
+ * @brief FNV-1a de 64 bits de tudo o que muda o resultado: superfícies, oclusores,
+ * luzes e parâmetros do cálculo.
+ */
+uint64_t LightBaker::cacheKey(const std::vector<BakeSurface>& surfaces, const std::vector<BoundingBox>& occluders,
+                              const std::vector<BakedLight>& lights) {
+    uint64_t hash = FNV1A_OFFSET;
+    auto mix = [&hash](const void* data, size_t size) { hash = fnv1a(data, size, hash); };
+    auto mixVector = [&mix](const Vector3f& v) { mix(&v.x, sizeof(float)); mix(&v.y, sizeof(float)); mix(&v.z, sizeof(float)); };
+
+    mix(LIGHTMAP_MAGIC, sizeof(LIGHTMAP_MAGIC));
+    const float parameters[4] = {Config::LIGHTMAP_TEXELS_PER_UNIT, Config::LIGHTMAP_AO_DISTANCE,
+                                 Config::AMBIENT_LIGHT_INTENSITY, static_cast<float>(Config::LIGHTMAP_AO_SAMPLES)};
+    mix(parameters, sizeof(parameters));
+    for (const BakeSurface& surface : surfaces) {
+        mixVector(surface.origin);
+        mixVector(surface.axisU);
+        mixVector(surface.axisV);
+        mixVector(surface.normal);
+        mixVector(surface.albedo);
+        const unsigned char hidden = surface.hidden ? 1 : 0;
+        mix(&hidden, 1);
+    }
+    for (const BoundingBox& box : occluders) {
+        mixVector(box.min);
+        mixVector(box.max);
+    }
+    for (const BakedLight& light : lights) {
+        mixVector(light.position);
+        mixVector(light.color);
+        mix(&light.radius, sizeof(float));
+    }
+    return hash;
+}
+
+/**
+ * @brief Lê os texels do cache: cabeçalho (formato, chave, dimensões) e os texels RGB.
+ * As áreas vêm do empacotamento, que é refeito igual para as mesmas superfícies.
+ */
+bool LightBaker::load(const std::string& path, uint64_t key, Lightmap& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    char magic[4];
+    uint64_t fileKey = 0;
+    int32_t width = 0, height = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&fileKey), sizeof(fileKey));
+    file.read(reinterpret_cast<char*>(&width), sizeof(width));
+    file.read(reinterpret_cast<char*>(&height), sizeof(height));
+    if (!file || std::memcmp(magic, LIGHTMAP_MAGIC, sizeof(magic)) != 0 || fileKey != key ||
+        width != out._width || height != out._height) {
+        return false;
+    }
+
+    std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 3);
+    file.read(reinterpret_cast<char*>(pixels.data()), pixels.size());
+    if (!file) return false;
+    out._pixels.swap(pixels);
+    return true;
+}
+
+void LightBaker::save(const std::string& path, uint64_t key, const Lightmap& lightmap) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "[Lightmap] Não foi possível gravar o cache " << path << "\n";
+        return;
+    }
+    const int32_t width = lightmap._width, height = lightmap._height;
+    file.write(LIGHTMAP_MAGIC, sizeof(LIGHTMAP_MAGIC));
+    file.write(reinterpret_cast<const char*>(&key), sizeof(key));
+    file.write(reinterpret_cast<const char*>(&width), sizeof(width));
+    file.write(reinterpret_cast<const char*>(&height), sizeof(height));
+    file.write(reinterpret_cast<const char*>(lightmap._pixels.data()), lightmap._pixels.size());
+}
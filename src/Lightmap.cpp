@@ -0,0 +1,98 @@
+/**
+ * @file Lightmap.cpp
+ * @brief Implementação do Lightmap: envio da textura e estado de desenho.
+ */
+
+#include "../include/Lightmap.h"
+#include "../include/GLExtensions.h"
+#include "../include/Config.h"
+#include <GL/freeglut.h>
+
+Lightmap::Lightmap() : _width(0), _height(0), _darkRect{0.0f, 0.0f, 0.0f, 0.0f}, _texture(0) {}
+
+bool Lightmap::isEmpty() const {
+    return _pixels.empty();
+}
+
+int Lightmap::getWidth() const {
+    return _width;
+}
+
+int Lightmap::getHeight() const {
+    return _height;
+}
+
+const LightmapRect& Lightmap::getRect(int surface) const {
+    return _rects[surface];
+}
+
+const LightmapRect& Lightmap::getDarkRect() const {
+    return _darkRect;
+}
+
+/**
+ * @brief Liga o lightmap na unidade 0 (enviando a textura na primeira vez).
+ *
+ * GL_ADD soma o texel à cor iluminada; a unidade 1 (GL_MODULATE, o padrão)
+ * multiplica a soma pelo material.
+ */
+bool Lightmap::bind() {
+    if (_pixels.empty() || !GLExtensions::hasMultitexture()) return false;
+
+    GLExtensions::activeTexture(GL_TEXTURE0);
+    if (_texture == 0) {
+        glGenTextures(1, &_texture);
+        glBindTexture(GL_TEXTURE_2D, _texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, _width, _height, 0, GL_RGB, GL_UNSIGNED_BYTE, _pixels.data());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, _texture);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_ADD);
+
+    const GLfloat noAmbient[] = {0.0f, 0.0f, 0.0f, 1.0f};
+    glLightModelfv(GL_LIGHT_MODEL_AMBIENT, noAmbient);
+
+    GLExtensions::activeTexture(GL_TEXTURE1);
+    return true;
+}
+
+/**
+ * @brief s e t lineares em x e z (GL_OBJECT_LINEAR), levando o retângulo
+ * [-width/2, width/2] x [-depth/2, depth/2] para a área da superfície.
+ */
+void Lightmap::setPlanarMapping(const LightmapRect& rect, float width, float depth) {
+    const float du = rect.u1 - rect.u0;
+    const float dv = rect.v1 - rect.v0;
+    const GLfloat planeS[] = {du / width, 0.0f, 0.0f, rect.u0 + du * 0.5f};
+    const GLfloat planeT[] = {0.0f, 0.0f, dv / depth, rect.v0 + dv * 0.5f};
+
+    GLExtensions::activeTexture(GL_TEXTURE0);
+    glTexGeni(GL_S, GL_TEXTURE_GEN_MODE, GL_OBJECT_LINEAR);
+    glTexGeni(GL_T, GL_TEXTURE_GEN_MODE, GL_OBJECT_LINEAR);
+    glTexGenfv(GL_S, GL_OBJECT_PLANE, planeS);
+    glTexGenfv(GL_T, GL_OBJECT_PLANE, planeT);
+    glEnable(GL_TEXTURE_GEN_S);
+    glEnable(GL_TEXTURE_GEN_T);
+    GLExtensions::activeTexture(GL_TEXTURE1);
+}
+
+void Lightmap::unbind() {
+    GLExtensions::activeTexture(GL_TEXTURE1);
+    glDisable(GL_TEXTURE_2D);
+
+    GLExtensions::activeTexture(GL_TEXTURE0);
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_TEXTURE_GEN_S);
+    glDisable(GL_TEXTURE_GEN_T);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+
+    const GLfloat ambient[] = {Config::AMBIENT_LIGHT_INTENSITY, Config::AMBIENT_LIGHT_INTENSITY,
+                               Config::AMBIENT_LIGHT_INTENSITY, 1.0f};
+    glLightModelfv(GL_LIGHT_MODEL_AMBIENT, ambient);
+}
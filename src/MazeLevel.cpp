@@ -0,0 +1,337 @@
+/**
+ * @file MazeLevel.cpp
+ * @brief Implementação do MazeLevel: leitura do nível, geometria por célula e
+ * desenho guiado pelo PVS.
+ */
+
+#include "../include/MazeLevel.h"
+#include "../include/TextureManager.h"
+#include "../include/JobSystem.h"
+#include "../include/Config.h"
+#include <GL/freeglut.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+/** @brief Unidades de mundo por repetição da textura (a mesma escala das paredes comuns). */
+static const float TEXTURE_SCALE = 4.0f;
+/** @brief Subdivisões do chão de cada célula por eixo, para a luz da lanterna. */
+static const int FLOOR_SUBDIVISIONS = 4;
+
+/**
+ * @brief Lê o nível, monta a geometria e as colisões e carrega (ou calcula) o PVS.
+ */
+MazeLevel::MazeLevel(const std::string& levelFile, const std::string& textureFile)
+    : _width(0), _height(0), _origin{0.0f, 0.0f, 0.0f}, _startCell(-1), _exitCell(-1),
+      _material(TextureManager::getMaterial(textureFile)), _lists(0), _atlasVersion(0) {
+    std::string text;
+    if (!readLevel(levelFile, text)) return;
+
+    buildGeometry();
+    buildColliders();
+    loadVisibility(levelFile, text);
+}
+
+// --- NÍVEL ---
+
+/**
+ * @brief Lê a grade do arquivo. Linhas mais curtas são completadas com paredes.
+ * @param text Recebe o conteúdo do arquivo (usado na chave do cache do PVS).
+ */
+bool MazeLevel::readLevel(const std::string& levelFile, std::string& text) {
+    std::ifstream file(levelFile);
+    if (!file.is_open()) {
+        std::cerr << "[Maze] Arquivo não encontrado: " << levelFile << "\n";
+        return false;
+    }
+
+    std::vector<std::string> rows;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        text += line;
+        text += '\n';
+        if (line.empty()) continue;
+        rows.push_back(line);
+        _width = std::max(_width, static_cast<int>(line.size()));
+    }
+    _height = static_cast<int>(rows.size());
+    if (_width == 0 || _height == 0) {
+        std::cerr << "[Maze] Nível vazio: " << levelFile << "\n";
+        _width = _height = 0;
+        return false;
+    }
+
+    _solid.assign(static_cast<size_t>(_width) * _height, 1);
+    for (int row = 0; row < _height; ++row) {
+        for (int column = 0; column < static_cast<int>(rows[row].size()); ++column) {
+            const char c = rows[row][column];
+            const int cell = row * _width + column;
+            _solid[cell] = (c == '1' || c == '#') ? 1 : 0;
+            if (c == 'S') _startCell = cell;
+            if (c == 'E') _exitCell = cell;
+        }
+    }
+
+    // A grade fica centrada na origem; as fileiras do arquivo avançam para -z.
+    _origin = {-_width * Config::TILE_SIZE / 2.0f, 0.0f, _height * Config::TILE_SIZE / 2.0f};
+    return true;
+}
+
+/**
+ * @brief Lê o PVS do cache ao lado do arquivo do nível, ou o calcula e grava.
+ */
+void MazeLevel::loadVisibility(const std::string& levelFile, const std::string& text) {
+    const size_t dot = levelFile.find_last_of('.');
+    const size_t slash = levelFile.find_last_of("/\\");
+    const bool hasExtension = dot != std::string::npos && (slash == std::string::npos || dot > slash);
+    const std::string cacheFile = (hasExtension ? levelFile.substr(0, dot) : levelFile) + ".pvs";
+    const uint64_t key = MazeVisibility::cacheKey(text);
+
+    if (_visibility.load(cacheFile, key) && _visibility.getWidth() == _width && _visibility.getHeight() == _height) {
+        std::cout << "[Maze] PVS lido de " << cacheFile << "\n";
+    } else {
+        auto start = std::chrono::steady_clock::now();
+        _visibility.build(_width, _height, _solid);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << "[Maze] PVS calculado em " << elapsed.count() << " ms ("
+                  << JobSystem::getWorkerCount() << " threads trabalhadoras)\n";
+        if (!_visibility.save(cacheFile, key)) {
+            std::cerr << "[Maze] Não foi possível gravar o cache " << cacheFile << "\n";
+        }
+    }
+
+    size_t openCells = std::count(_solid.begin(), _solid.end(), 0);
+    if (openCells > 0) {
+        std::cout << "[Maze] " << _width * _height << " células; em média "
+                  << _visibility.getVisiblePairCount() / openCells << " visíveis de cada célula livre\n";
+    }
+}
+
+bool MazeLevel::isLoaded() const {
+    return _width > 0;
+}
+
+/** @brief Fora da grade conta como parede. */
+bool MazeLevel::isSolid(int column, int row) const {
+    if (column < 0 || row < 0 || column >= _width || row >= _height) return true;
+    return _solid[row * _width + column] != 0;
+}
+
+Vector3f MazeLevel::getCellCenter(int cell) const {
+    const int column = cell % _width;
+    const int row = cell / _width;
+    return {_origin.x + (column + 0.5f) * Config::TILE_SIZE, 0.0f, _origin.z - (row + 0.5f) * Config::TILE_SIZE};
+}
+
+Vector3f MazeLevel::getStartPosition() const {
+    return (_startCell >= 0) ? getCellCenter(_startCell) : Vector3f{0.0f, 0.0f, 0.0f};
+}
+
+Vector3f MazeLevel::getExitPosition() const {
+    return (_exitCell >= 0) ? getCellCenter(_exitCell) : Vector3f{0.0f, 0.0f, 0.0f};
+}
+
+int MazeLevel::getCellAt(const Vector3f& position) const {
+    if (!isLoaded()) return -1;
+    const int column = static_cast<int>(std::floor((position.x - _origin.x) / Config::TILE_SIZE));
+    const int row = static_cast<int>(std::floor((_origin.z - position.z) / Config::TILE_SIZE));
+    if (isSolid(column, row)) return -1;
+    return row * _width + column;
+}
+
+// --- GEOMETRIA ---
+
+/**
+ * @brief Gera as faces de parede de cada célula.
+ *
+ * Uma célula de parede só tem as faces voltadas para células livres (as faces
+ * entre duas paredes nunca aparecem). Células livres na borda da grade recebem
+ * uma face no lado de fora, para fechar o labirinto.
+ */
+void MazeLevel::buildGeometry() {
+    static const int DX[4] = {1, -1, 0, 0};
+    static const int DY[4] = {0, 0, 1, -1};
+
+    const float half = Config::TILE_SIZE / 2.0f;
+    const float sMax = Config::TILE_SIZE / TEXTURE_SCALE;
+    const float tMax = Config::WALL_HEIGHT / TEXTURE_SCALE;
+    const Vector3f up = {0.0f, Config::WALL_HEIGHT, 0.0f};
+
+    _cellWalls.assign(_solid.size(), std::vector<StaticVertex>());
+    for (int cell = 0; cell < static_cast<int>(_solid.size()); ++cell) {
+        const int column = cell % _width;
+        const int row = cell / _width;
+        const Vector3f center = getCellCenter(cell);
+
+        for (int side = 0; side < 4; ++side) {
+            const bool neighbourSolid = isSolid(column + DX[side], row + DY[side]);
+            // Direção da vizinha no mundo: a coluna cresce em +x e a fileira em -z.
+            const Vector3f outward = {static_cast<float>(DX[side]), 0.0f, static_cast<float>(-DY[side])};
+
+            Vector3f normal;
+            if (_solid[cell] && !neighbourSolid) {
+                normal = outward; // Parede vista da vizinha livre.
+            } else if (!_solid[cell] && neighbourSolid && (column + DX[side] < 0 || column + DX[side] >= _width ||
+                                                           row + DY[side] < 0 || row + DY[side] >= _height)) {
+                normal = -outward; // Borda do labirinto, vista de dentro.
+            } else {
+                continue;
+            }
+
+            // Cantos em ordem anti-horária para quem olha de frente para a face.
+            const Vector3f right = cross(-normal, Vector3f{0.0f, 1.0f, 0.0f}) * Config::TILE_SIZE;
+            const Vector3f corner = center + outward * half - right * 0.5f;
+            std::vector<StaticVertex>& out = _cellWalls[cell];
+            out.push_back({corner, normal, 0.0f, 0.0f});
+            out.push_back({corner + right, normal, sMax, 0.0f});
+            out.push_back({corner + right + up, normal, sMax, tMax});
+            out.push_back({corner + up, normal, 0.0f, tMax});
+        }
+    }
+}
+
+/**
+ * @brief Junta os blocos de parede de cada fileira em caixas de colisão, e fecha
+ * as células livres da borda com uma caixa do lado de fora.
+ */
+void MazeLevel::buildColliders() {
+    const float tile = Config::TILE_SIZE;
+    _colliders.clear();
+    for (int row = 0; row < _height; ++row) {
+        const float zMax = _origin.z - row * tile;
+        for (int column = 0; column < _width;) {
+            if (!isSolid(column, row)) {
+                ++column;
+                continue;
+            }
+            int end = column;
+            while (end < _width && isSolid(end, row)) ++end;
+            _colliders.push_back({{_origin.x + column * tile, 0.0f, zMax - tile},
+                                  {_origin.x + end * tile, Config::WALL_HEIGHT, zMax}});
+            column = end;
+        }
+    }
+
+    for (int cell = 0; cell < static_cast<int>(_solid.size()); ++cell) {
+        if (_solid[cell]) continue;
+        const int column = cell % _width;
+        const int row = cell / _width;
+        const float xMin = _origin.x + column * tile;
+        const float zMax = _origin.z - row * tile;
+        if (column == 0)           _colliders.push_back({{xMin - tile, 0.0f, zMax - tile}, {xMin, Config::WALL_HEIGHT, zMax}});
+        if (column == _width - 1)  _colliders.push_back({{xMin + tile, 0.0f, zMax - tile}, {xMin + 2 * tile, Config::WALL_HEIGHT, zMax}});
+        if (row == 0)              _colliders.push_back({{xMin, 0.0f, zMax}, {xMin + tile, Config::WALL_HEIGHT, zMax + tile}});
+        if (row == _height - 1)    _colliders.push_back({{xMin, 0.0f, zMax - 2 * tile}, {xMin + tile, Config::WALL_HEIGHT, zMax - tile}});
+    }
+}
+
+const std::vector<BoundingBox>& MazeLevel::getColliders() const {
+    return _colliders;
+}
+
+BoundingBox MazeLevel::getBoundingBox() const {
+    return {{_origin.x, 0.0f, _origin.z - _height * Config::TILE_SIZE},
+            {_origin.x + _width * Config::TILE_SIZE, Config::WALL_HEIGHT, _origin.z}};
+}
+
+// --- DESENHO ---
+
+/**
+ * @brief Registra um item por célula visível da célula da câmera.
+ *
+ * Com a câmera fora do labirinto (ou vista através de um portal, de fora dele),
+ * não há PVS a consultar e todas as células são registradas.
+ *
+ * @param packet O pacote sendo montado pela simulação.
+ */
+void MazeLevel::collectDrawItems(RenderPacket& packet) {
+    if (!isLoaded()) return;
+
+    const int cell = getCellAt(packet.camera.position);
+    if (cell >= 0 && !_visibility.isEmpty()) {
+        for (int visible : _visibility.getVisibleCells(cell)) {
+            pushCell(packet, visible);
+        }
+    } else {
+        for (int i = 0; i < static_cast<int>(_solid.size()); ++i) {
+            pushCell(packet, i);
+        }
+    }
+}
+
+/** @brief Um item para a célula, se ela tiver algo a desenhar (paredes cercadas por paredes não têm). */
+void MazeLevel::pushCell(RenderPacket& packet, int cell) {
+    if (_solid[cell] && _cellWalls[cell].empty()) return;
+    DrawItem item(this);
+    item.part = cell;
+    item.transform = Matrix4::translation(getCellCenter(cell)); // para a ordenação da frente para trás
+    packet.items.push_back(item);
+}
+
+/**
+ * @brief Compila uma display list por célula: as faces de parede (com o atlas) e,
+ * nas células livres, o chão.
+ */
+void MazeLevel::buildLists() {
+    const GLsizei count = static_cast<GLsizei>(_solid.size());
+    if (_lists == 0) _lists = glGenLists(count);
+
+    const GLuint atlas = TextureManager::getAtlasTexture();
+    const MaterialRegion region = TextureManager::getMaterialRegion(_material);
+    const float step = Config::TILE_SIZE / FLOOR_SUBDIVISIONS;
+
+    for (GLsizei cell = 0; cell < count; ++cell) {
+        glNewList(_lists + cell, GL_COMPILE);
+        if (!_cellWalls[cell].empty()) {
+            glColor3f(1.0f, 1.0f, 1.0f);
+            glEnable(GL_TEXTURE_2D);
+            glBindTexture(GL_TEXTURE_2D, atlas);
+            glBegin(GL_QUADS);
+            StaticBatch::emitVertices(_cellWalls[cell], region, nullptr);
+            glEnd();
+            glDisable(GL_TEXTURE_2D);
+        }
+        if (!_solid[cell]) {
+            const Vector3f center = getCellCenter(cell);
+            const float x0 = center.x - Config::TILE_SIZE / 2.0f;
+            const float z0 = center.z + Config::TILE_SIZE / 2.0f;
+            glColor3f(0.8f, 0.8f, 0.8f);
+            glNormal3f(0.0f, 1.0f, 0.0f);
+            glBegin(GL_QUADS);
+            for (int i = 0; i < FLOOR_SUBDIVISIONS; ++i) {
+                for (int j = 0; j < FLOOR_SUBDIVISIONS; ++j) {
+                    const float x = x0 + i * step;
+                    const float z = z0 - j * step;
+                    glVertex3f(x, 0.0f, z);
+                    glVertex3f(x + step, 0.0f, z);
+                    glVertex3f(x + step, 0.0f, z - step);
+                    glVertex3f(x, 0.0f, z - step);
+                }
+            }
+            glEnd();
+        }
+        glEndList();
+    }
+
+    _atlasVersion = TextureManager::getAtlasVersion();
+}
+
+/**
+ * @brief Desenha uma célula (item.part). As listas são recompiladas se o atlas
+ * tiver sido remontado.
+ *
+ * As listas estão em coordenadas de mundo e a matriz do item leva ao centro da
+ * célula, então a translação é desfeita antes.
+ */
+void MazeLevel::draw(const DrawItem& item) {
+    TextureManager::getAtlasTexture();
+    if (_lists == 0 || _atlasVersion != TextureManager::getAtlasVersion()) {
+        buildLists();
+    }
+    const Vector3f center = getCellCenter(item.part);
+    glTranslatef(-center.x, -center.y, -center.z);
+    glCallList(_lists + item.part);
+}
@@ -0,0 +1,279 @@
+/**
+ * @file MazeVisibility.cpp
+ * @brief Implementação do cálculo, da consulta e do cache do PVS de um labirinto.
+ */
+
+#include "../include/MazeVisibility.h"
+#include "../include/JobSystem.h"
+#include "../include/Hash.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+/** @brief Identifica o formato do arquivo de cache. */
+static const char PVS_MAGIC[4] = {'P', 'V', 'S', '2'};
+/** @brief Folga dos testes de reta, para que erros de arredondamento só aumentem o PVS. */
+static const float LINE_EPSILON = 1e-4f;
+
+/**
+ * @brief Uma reta v = m·u + c, vista como um ponto (m, c). Os conjuntos de retas
+ * que atravessam uma sequência de aberturas são polígonos convexos nesse espaço.
+ */
+struct LinePoint {
+    float m, c;
+};
+
+typedef std::vector<LinePoint> LineRegion;
+
+/**
+ * @brief Recorta um polígono de retas pelo semiplano a·m + b·c <= limit (Sutherland-Hodgman).
+ * @param in O polígono, convexo e em ordem.
+ * @param out Recebe o polígono recortado (vazio se nenhuma reta sobrar).
+ */
+static void clipRegion(const LineRegion& in, float a, float b, float limit, LineRegion& out) {
+    out.clear();
+    limit += LINE_EPSILON;
+    const size_t count = in.size();
+    for (size_t i = 0; i < count; ++i) {
+        const LinePoint& p = in[i];
+        const LinePoint& q = in[(i + 1) % count];
+        const float dp = a * p.m + b * p.c - limit;
+        const float dq = a * q.m + b * q.c - limit;
+        if (dp <= 0.0f) out.push_back(p);
+        if ((dp < 0.0f && dq > 0.0f) || (dp > 0.0f && dq < 0.0f)) {
+            const float t = dp / (dp - dq);
+            out.push_back({p.m + (q.m - p.m) * t, p.c + (q.c - p.c) * t});
+        }
+    }
+}
+
+/**
+ * @brief Junta `extra` a `region`, guardando o fecho convexo dos dois (cadeia monótona).
+ *
+ * O fecho pode conter retas que não estão em nenhum dos dois, mas todas ainda
+ * atravessam a célula, então o resultado só fica maior (conservador).
+ */
+static void mergeRegion(LineRegion& region, const LineRegion& extra) {
+    if (extra.empty()) return;
+    LineRegion points = region;
+    points.insert(points.end(), extra.begin(), extra.end());
+    std::sort(points.begin(), points.end(), [](const LinePoint& p, const LinePoint& q) {
+        return p.m < q.m || (p.m == q.m && p.c < q.c);
+    });
+    auto turn = [](const LinePoint& o, const LinePoint& p, const LinePoint& q) {
+        return (p.m - o.m) * (q.c - o.c) - (p.c - o.c) * (q.m - o.m);
+    };
+
+    region.assign(points.size() * 2, LinePoint());
+    size_t k = 0;
+    for (size_t i = 0; i < points.size(); ++i) {
+        while (k >= 2 && turn(region[k - 2], region[k - 1], points[i]) <= 0.0f) --k;
+        region[k++] = points[i];
+    }
+    for (size_t i = points.size() - 1, lower = k + 1; i-- > 0;) {
+        while (k >= lower && turn(region[k - 2], region[k - 1], points[i]) <= 0.0f) --k;
+        region[k++] = points[i];
+    }
+    region.resize(k > 1 ? k - 1 : k);
+}
+
+MazeVisibility::MazeVisibility() : _width(0), _height(0), _wordsPerRow(0) {}
+
+// --- CÁLCULO ---
+
+/**
+ * @brief Calcula a visibilidade de todas as células livres, em paralelo.
+ *
+ * Cada linha de bits só é escrita pela tarefa da sua célula de origem, então as
+ * tarefas não compartilham nada além da grade (somente leitura).
+ */
+void MazeVisibility::build(int width, int height, const std::vector<uint8_t>& solid) {
+    _width = width;
+    _height = height;
+    const size_t cellCount = static_cast<size_t>(width) * height;
+    _wordsPerRow = (cellCount + 63) / 64;
+    _bits.assign(cellCount * _wordsPerRow, 0);
+
+    JobSystem::parallelFor(cellCount, 4, [&](size_t begin, size_t end) {
+        for (size_t from = begin; from < end; ++from) {
+            buildRow(static_cast<int>(from), solid);
+        }
+    });
+    buildLists();
+}
+
+/**
+ * @brief Calcula as células visíveis de uma célula livre: as oito direções
+ * (octantes) são percorridas uma a uma.
+ */
+void MazeVisibility::buildRow(int from, const std::vector<uint8_t>& solid) {
+    if (solid[from]) return;
+
+    uint64_t* row = &_bits[static_cast<size_t>(from) * _wordsPerRow];
+    row[from >> 6] |= uint64_t(1) << (from & 63);
+    for (int octant = 0; octant < 8; ++octant) {
+        traceOctant(from, octant, solid, row);
+    }
+}
+
+/**
+ * @brief Propaga, célula a célula, o conjunto de retas que sai da origem num octante.
+ *
+ * O octante é levado para um sistema (u, v) em que a origem é a célula (0, 0) e as
+ * retas são v = m·u + c com 0 <= m <= 1, de modo que uma reta sai de cada célula
+ * pela aresta +u ou pela +v. Cada aresta é uma abertura que recorta o conjunto de
+ * retas (um polígono em (m, c)); o que sobra passa para a vizinha, que junta o que
+ * chega das duas arestas de entrada. Toda célula com conjunto não vazio é marcada;
+ * paredes são marcadas mas não deixam passar nada.
+ *
+ * O teste é exato a menos do fecho convexo de mergeRegion e da folga LINE_EPSILON,
+ * que só acrescentam células: nenhuma célula visível fica de fora.
+ *
+ * @param octant Bit 0: u decresce; bit 1: v decresce; bit 2: u é o eixo Y da grade.
+ */
+void MazeVisibility::traceOctant(int from, int octant, const std::vector<uint8_t>& solid, uint64_t* row) const {
+    const bool swap = (octant & 4) != 0;
+    const int stepU = (octant & 1) ? -1 : 1;
+    const int stepV = (octant & 2) ? -1 : 1;
+    const int fromU = swap ? from / _width : from % _width;
+    const int fromV = swap ? from % _width : from / _width;
+    const int sizeU = swap ? _height : _width;
+    const int sizeV = swap ? _width : _height;
+    const int extentU = (stepU > 0) ? sizeU - 1 - fromU : fromU;
+    const int extentV = (stepV > 0) ? sizeV - 1 - fromV : fromV;
+
+    // Retas com 0 <= m <= 1 que atravessam a célula de origem [0,1] x [0,1].
+    std::vector<LineRegion> regions(static_cast<size_t>(extentU + 1) * (extentV + 1));
+    regions[0] = {{0.0f, 0.0f}, {1.0f, -1.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+    LineRegion clipped, passed;
+
+    for (int a = 0; a <= extentU; ++a) {
+        for (int b = 0; b <= extentV; ++b) {
+            const LineRegion& region = regions[static_cast<size_t>(a) * (extentV + 1) + b];
+            if (region.empty()) continue;
+
+            const int u = fromU + stepU * a;
+            const int v = fromV + stepV * b;
+            const int cell = swap ? u * _width + v : v * _width + u;
+            row[cell >> 6] |= uint64_t(1) << (cell & 63);
+            if (cell != from && solid[cell]) continue;
+
+            // Aresta +u (u = a + 1, v entre b e b + 1).
+            if (a < extentU) {
+                clipRegion(region, -(a + 1.0f), -1.0f, -static_cast<float>(b), clipped);
+                clipRegion(clipped, a + 1.0f, 1.0f, b + 1.0f, passed);
+                mergeRegion(regions[static_cast<size_t>(a + 1) * (extentV + 1) + b], passed);
+            }
+            // Aresta +v (v = b + 1, u entre a e a + 1).
+            if (b < extentV) {
+                clipRegion(region, static_cast<float>(a), 1.0f, b + 1.0f, clipped);
+                clipRegion(clipped, -(a + 1.0f), -1.0f, -(b + 1.0f), passed);
+                mergeRegion(regions[static_cast<size_t>(a) * (extentV + 1) + b + 1], passed);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Converte as linhas de bits em listas de células, usadas na hora de desenhar.
+ */
+void MazeVisibility::buildLists() {
+    const int cellCount = _width * _height;
+    _lists.assign(cellCount, std::vector<int>());
+    for (int from = 0; from < cellCount; ++from) {
+        for (int to = 0; to < cellCount; ++to) {
+            if (isVisible(from, to)) _lists[from].push_back(to);
+        }
+    }
+}
+
+// --- CONSULTA ---
+
+bool MazeVisibility::isEmpty() const {
+    return _bits.empty();
+}
+
+int MazeVisibility::getWidth() const {
+    return _width;
+}
+
+int MazeVisibility::getHeight() const {
+    return _height;
+}
+
+bool MazeVisibility::isVisible(int from, int to) const {
+    const uint64_t* row = &_bits[static_cast<size_t>(from) * _wordsPerRow];
+    return (row[to >> 6] >> (to & 63)) & 1u;
+}
+
+const std::vector<int>& MazeVisibility::getVisibleCells(int from) const {
+    return _lists[from];
+}
+
+size_t MazeVisibility::getVisiblePairCount() const {
+    size_t total = 0;
+    for (const std::vector<int>& list : _lists) total += list.size();
+    return total;
+}
+
+// --- CACHE ---
+
+/**
+ * @brief FNV-1a de 64 bits do texto do nível e do formato.
+ */
+uint64_t MazeVisibility::cacheKey(const std::string& levelText) {
+    uint64_t hash = FNV1A_OFFSET;
+    auto mix = [&hash](const void* data, size_t size) { hash = fnv1a(data, size, hash); };
+    mix(PVS_MAGIC, sizeof(PVS_MAGIC));
+    mix(levelText.data(), levelText.size());
+    return hash;
+}
+
+/**
+ * @brief Lê o cache: cabeçalho (formato, chave, dimensões) seguido das linhas de bits.
+ */
+bool MazeVisibility::load(const std::string& path, uint64_t key) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    char magic[4];
+    uint64_t fileKey = 0;
+    int32_t width = 0, height = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&fileKey), sizeof(fileKey));
+    file.read(reinterpret_cast<char*>(&width), sizeof(width));
+    file.read(reinterpret_cast<char*>(&height), sizeof(height));
+    if (!file || std::memcmp(magic, PVS_MAGIC, sizeof(magic)) != 0 || fileKey != key ||
+        width <= 0 || height <= 0 || width > 4096 || height > 4096) {
+        return false;
+    }
+
+    const size_t cellCount = static_cast<size_t>(width) * height;
+    const size_t wordsPerRow = (cellCount + 63) / 64;
+    std::vector<uint64_t> bits(cellCount * wordsPerRow);
+    file.read(reinterpret_cast<char*>(bits.data()), bits.size() * sizeof(uint64_t));
+    if (!file) return false;
+
+    _width = width;
+    _height = height;
+    _wordsPerRow = wordsPerRow;
+    _bits.swap(bits);
+    buildLists();
+    return true;
+}
+
+/**
+ * @brief Grava o cache (ver load).
+ */
+bool MazeVisibility::save(const std::string& path, uint64_t key) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+
+    const int32_t width = _width, height = _height;
+    file.write(PVS_MAGIC, sizeof(PVS_MAGIC));
+    file.write(reinterpret_cast<const char*>(&key), sizeof(key));
+    file.write(reinterpret_cast<const char*>(&width), sizeof(width));
+    file.write(reinterpret_cast<const char*>(&height), sizeof(height));
+    file.write(reinterpret_cast<const char*>(_bits.data()), _bits.size() * sizeof(uint64_t));
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,171 @@
+/**
+ * @file MeshManager.cpp
+ * @brief Implementação do MeshManager: escolha do nível de detalhe e cache de
+ * display lists das malhas procedurais.
+ */
+
+#include "../include/MeshManager.h"
+#include "../include/Config.h"
+#include "../include/VectorMath.h"
+#include <GL/freeglut.h>
+#include <algorithm>
+#include <cmath>
+
+std::map<MeshManager::MeshKey, GLuint> MeshManager::_lists;
+std::atomic<float> MeshManager::_lodBias(1.0f);
+float MeshManager::_tessellation = 1.0f;
+
+static_assert(sizeof(Config::LOD_SCREEN_RADIUS) / sizeof(Config::LOD_SCREEN_RADIUS[0]) == MeshManager::LOD_COUNT - 1,
+              "Config::LOD_SCREEN_RADIUS precisa de um limiar entre cada par de níveis");
+
+// --- Tabelas de detalhe por nível ---
+static const int SPHERE_SLICES[]   = { 32, 16, 10, 6 };
+static const int SPHERE_STACKS[]   = { 32, 16,  8, 4 };
+static const int CONE_SLICES[]     = { 32, 16, 10, 6 };
+static const int CONE_STACKS[]     = { 32,  8,  2, 1 };
+static const int CYLINDER_SLICES[] = { 24, 16, 10, 6 };
+static const int TORUS_SIDES[]     = { 32, 16,  8, 4 };
+static const int TORUS_RINGS[]     = { 32, 16, 12, 8 };
+static const float PLANE_DENSITY[] = { 6.0f, 3.0f, 1.5f, 0.5f }; // quadrados por unidade de comprimento
+
+/**
+ * @brief Escolhe o nível de detalhe pelo raio projetado na tela.
+ *
+ * Para cruzar um limiar em direção ao nível mais detalhado, o raio precisa passar
+ * do limiar mais a histerese; para voltar, precisa cair abaixo do limiar menos a
+ * histerese.
+ *
+ * @param eye A posição da câmera.
+ * @param center O centro do objeto no mundo.
+ * @param radius O raio de uma esfera que envolve o objeto.
+ * @param previousLod O nível usado no quadro anterior.
+ * @return O nível de detalhe.
+ */
+int MeshManager::selectLod(const Vector3f& eye, const Vector3f& center, float radius, int previousLod) {
+    const float distance = length(center - eye);
+    if (distance <= radius) return 0;
+
+    static const float pixelsPerUnit =
+        (Config::SCREEN_HEIGHT * 0.5f) / std::tan(Config::CAMERA_FOV_Y * 0.5f * 3.1415926535f / 180.0f);
+    const float projected = radius / distance * pixelsPerUnit;
+
+    const float bias = _lodBias;
+    int lod = 0;
+    for (int i = 0; i < LOD_COUNT - 1; ++i) {
+        float band = (previousLod <= i) ? (1.0f - Config::LOD_HYSTERESIS) : (1.0f + Config::LOD_HYSTERESIS);
+        if (projected >= Config::LOD_SCREEN_RADIUS[i] * band * bias) break;
+        lod = i + 1;
+    }
+    return lod;
+}
+
+// --- DESENHO ---
+
+void MeshManager::drawSphere(float radius, int lod) {
+    glCallList(getList(SPHERE, radius, 0.0f, lod));
+}
+
+void MeshManager::drawCone(float base, float height, int lod) {
+    glCallList(getList(CONE, base, height, lod));
+}
+
+void MeshManager::drawCylinder(float radius, float height, int lod) {
+    glCallList(getList(CYLINDER, radius, height, lod));
+}
+
+void MeshManager::drawTorus(float innerRadius, float outerRadius, int lod) {
+    glCallList(getList(TORUS, innerRadius, outerRadius, lod));
+}
+
+void MeshManager::drawPlane(float width, float depth, int lod) {
+    glCallList(getList(PLANE, width, depth, lod));
+}
+
+/**
+ * @brief Obtém a display list de uma malha, compilando-a na primeira vez.
+ * @return O identificador da display list.
+ */
+GLuint MeshManager::getList(MeshType type, float a, float b, int lod) {
+    lod = std::max(0, std::min(lod, LOD_COUNT - 1));
+    MeshKey key(type, a, b, lod);
+    auto it = _lists.find(key);
+    if (it != _lists.end()) {
+        return it->second;
+    }
+
+    GLuint list = glGenLists(1);
+    glNewList(list, GL_COMPILE);
+    build(type, a, b, lod);
+    glEndList();
+    _lists[key] = list;
+    return list;
+}
+
+/**
+ * @brief Emite a geometria de uma malha (dentro de glNewList).
+ */
+void MeshManager::build(MeshType type, float a, float b, int lod) {
+    // Segmentos da tabela reduzidos por _tessellation, sem ficar abaixo de `minimum`.
+    auto scaled = [](int count, int minimum) {
+        return std::max(minimum, static_cast<int>(std::lround(count * _tessellation)));
+    };
+    switch (type) {
+        case SPHERE:
+            glutSolidSphere(a, scaled(SPHERE_SLICES[lod], 4), scaled(SPHERE_STACKS[lod], 3));
+            break;
+        case CONE:
+            glutSolidCone(a, b, scaled(CONE_SLICES[lod], 4), scaled(CONE_STACKS[lod], 1));
+            break;
+        case CYLINDER:
+            glutSolidCylinder(a, b, scaled(CYLINDER_SLICES[lod], 4), 1);
+            break;
+        case TORUS:
+            glutSolidTorus(a, b, scaled(TORUS_SIDES[lod], 3), scaled(TORUS_RINGS[lod], 4));
+            break;
+        case PLANE: {
+            // Subdividido para que a lanterna (iluminação por vértice) fique suave de perto.
+            const float density = PLANE_DENSITY[lod] * _tessellation;
+            int divisionsX = std::max(1, static_cast<int>(std::ceil(a * density)));
+            int divisionsZ = std::max(1, static_cast<int>(std::ceil(b * density)));
+            float stepX = a / divisionsX;
+            float stepZ = b / divisionsZ;
+            float startX = -a / 2.0f;
+            float startZ = -b / 2.0f;
+
+            glNormal3f(0.0f, 1.0f, 0.0f);
+            glBegin(GL_QUADS);
+            for (int i = 0; i < divisionsX; ++i) {
+                for (int j = 0; j < divisionsZ; ++j) {
+                    float x = startX + i * stepX;
+                    float z = startZ + j * stepZ;
+                    glVertex3f(x, 0.0f, z);
+                    glVertex3f(x, 0.0f, z + stepZ);
+                    glVertex3f(x + stepX, 0.0f, z + stepZ);
+                    glVertex3f(x + stepX, 0.0f, z);
+                }
+            }
+            glEnd();
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Libera todas as display lists.
+ */
+void MeshManager::clear() {
+    for (auto& entry : _lists) {
+        glDeleteLists(entry.second, 1);
+    }
+    _lists.clear();
+}
+
+void MeshManager::setLodBias(float bias) {
+    _lodBias = bias;
+}
+
+void MeshManager::setTessellation(float density) {
+    if (density == _tessellation) return;
+    _tessellation = density;
+    clear();
+}
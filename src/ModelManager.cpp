@@ -0,0 +1,566 @@
+/**
+ * @file ModelManager.cpp
+ * @brief Implementação do ModelManager: thread de carregamento, leitura de .obj,
+ * otimização para a cache de vértices e cache binário.
+ */
+
+#include "../include/ModelManager.h"
+#include "../include/VectorMath.h"
+#include "../include/Hash.h"
+#include "../include/Config.h"
+#include <GL/freeglut.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <thread>
+
+std::unordered_map<std::string, int> ModelManager::_ids;
+std::vector<ModelManager::Model*> ModelManager::_models;
+
+/** @brief Identifica o formato do cache binário. */
+static const char MESH_MAGIC[4] = {'M', 'S', 'H', '1'};
+
+// --- Pesos do algoritmo de Forsyth ---
+static const float CACHE_DECAY_POWER = 1.5f;
+static const float LAST_TRIANGLE_SCORE = 0.75f;
+static const float VALENCE_BOOST_SCALE = 2.0f;
+static const float VALENCE_BOOST_POWER = 0.5f;
+
+// --- THREAD DE CARREGAMENTO ---
+// s_mutex protege _ids, _models e a fila. Os modelos em si só são escritos pela
+// thread de carregamento até `state` virar READY ou FAILED.
+
+static std::mutex s_mutex;
+static std::condition_variable s_wake;
+static std::deque<int> s_queue;
+static std::thread s_loader;
+static bool s_stopping = false;
+
+/** @brief Para a thread de carregamento (pedidos na fila são descartados). */
+static void stopLoader() {
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_stopping = true;
+        s_queue.clear();
+    }
+    s_wake.notify_all();
+    if (s_loader.joinable()) s_loader.join();
+    s_stopping = false;
+}
+
+/**
+ * @brief Garante que a thread de carregamento termine antes do fim do programa.
+ */
+struct ModelLoaderShutdownGuard {
+    ~ModelLoaderShutdownGuard() { stopLoader(); }
+};
+static ModelLoaderShutdownGuard s_shutdownGuard;
+
+/**
+ * @brief Registra o pedido e o entrega à thread de carregamento (criada no primeiro pedido).
+ */
+int ModelManager::load(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    auto it = _ids.find(filename);
+    if (it != _ids.end()) return it->second;
+
+    Model* model = new Model();
+    model->filename = filename;
+    model->state = QUEUED;
+    model->bounds = {{0, 0, 0}, {0, 0, 0}};
+    model->list = 0;
+
+    const int id = static_cast<int>(_models.size());
+    _models.push_back(model);
+    _ids[filename] = id;
+
+    s_queue.push_back(id);
+    if (!s_loader.joinable()) s_loader = std::thread(&ModelManager::loaderLoop);
+    s_wake.notify_one();
+    return id;
+}
+
+void ModelManager::loaderLoop() {
+    for (;;) {
+        Model* model;
+        {
+            std::unique_lock<std::mutex> lock(s_mutex);
+            s_wake.wait(lock, [] { return s_stopping || !s_queue.empty(); });
+            if (s_stopping) return;
+            model = _models[s_queue.front()];
+            s_queue.pop_front();
+        }
+        loadModel(model);
+    }
+}
+
+/**
+ * @brief Lê o modelo: do cache, se ele foi gerado a partir deste mesmo .obj; senão,
+ * interpreta o .obj, otimiza a malha e grava o cache.
+ */
+void ModelManager::loadModel(Model* model) {
+    std::ifstream file(model->filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "[Modelo] Arquivo não encontrado: " << model->filename << "\n";
+        model->state = FAILED;
+        return;
+    }
+    const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    const auto start = std::chrono::steady_clock::now();
+    const uint64_t key = cacheKey(text);
+    const std::string cacheFile = cachePath(model->filename);
+    ModelMesh mesh;
+    if (loadCache(cacheFile, key, mesh)) {
+        std::cout << "[Modelo] " << model->filename << " lido de " << cacheFile << "\n";
+    } else {
+        if (!parseObj(text, mesh)) {
+            std::cerr << "[Modelo] Arquivo inválido: " << model->filename << "\n";
+            model->state = FAILED;
+            return;
+        }
+        const float before = averageCacheMissRatio(mesh, Config::MODEL_VERTEX_CACHE_SIZE);
+        optimize(mesh);
+        const float after = averageCacheMissRatio(mesh, Config::MODEL_VERTEX_CACHE_SIZE);
+        saveCache(cacheFile, key, mesh);
+
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "[Modelo] " << model->filename << ": " << mesh.indices.size() / 3 << " triângulos, "
+                  << mesh.vertices.size() << " vértices, ACMR " << before << " -> " << after
+                  << " (" << elapsed.count() << " ms)\n";
+    }
+
+    model->bounds = mesh.bounds;
+    model->mesh.vertices.swap(mesh.vertices);
+    model->mesh.indices.swap(mesh.indices);
+    model->mesh.bounds = mesh.bounds;
+    model->state = READY;
+}
+
+bool ModelManager::isReady(int model) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return model >= 0 && model < static_cast<int>(_models.size()) && _models[model]->state == READY;
+}
+
+bool ModelManager::getBounds(int model, BoundingBox& out) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (model < 0 || model >= static_cast<int>(_models.size()) || _models[model]->state != READY) return false;
+    out = _models[model]->bounds;
+    return true;
+}
+
+// --- DESENHO ---
+
+/**
+ * @brief Compila a malha numa display list (com vertex arrays, que o OpenGL 1.1 já
+ * tem) e descarta a cópia na memória.
+ */
+void ModelManager::upload(Model* model) {
+    const ModelMesh& mesh = model->mesh;
+    model->list = glGenLists(1);
+
+    glNewList(model->list, GL_COMPILE);
+    if (!mesh.indices.empty()) {
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glEnableClientState(GL_NORMAL_ARRAY);
+        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+        glVertexPointer(3, GL_FLOAT, sizeof(ModelVertex), &mesh.vertices[0].position);
+        glNormalPointer(GL_FLOAT, sizeof(ModelVertex), &mesh.vertices[0].normal);
+        glTexCoordPointer(2, GL_FLOAT, sizeof(ModelVertex), &mesh.vertices[0].s);
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(mesh.indices.size()), GL_UNSIGNED_INT, mesh.indices.data());
+        glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+        glDisableClientState(GL_NORMAL_ARRAY);
+        glDisableClientState(GL_VERTEX_ARRAY);
+    }
+    glEndList();
+
+    std::vector<ModelVertex>().swap(model->mesh.vertices);
+    std::vector<uint32_t>().swap(model->mesh.indices);
+}
+
+bool ModelManager::draw(int model) {
+    Model* entry;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (model < 0 || model >= static_cast<int>(_models.size())) return false;
+        entry = _models[model];
+    }
+    if (entry->state != READY) return false;
+
+    if (entry->list == 0) upload(entry);
+    glCallList(entry->list);
+    return true;
+}
+
+void ModelManager::clear() {
+    stopLoader();
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    for (Model* model : _models) {
+        if (model->list != 0) glDeleteLists(model->list, 1);
+        delete model;
+    }
+    _models.clear();
+    _ids.clear();
+}
+
+// --- LEITURA DO .OBJ ---
+
+namespace {
+
+/** @brief Os índices de posição, coordenada de textura e normal de um canto de face (-1 se ausente). */
+struct Corner {
+    int position, texcoord, normal;
+    bool operator==(const Corner& other) const {
+        return position == other.position && texcoord == other.texcoord && normal == other.normal;
+    }
+};
+
+struct CornerHash {
+    size_t operator()(const Corner& c) const {
+        return (static_cast<size_t>(c.position) * 73856093u) ^ (static_cast<size_t>(c.texcoord) * 19349663u) ^
+               (static_cast<size_t>(c.normal) * 83492791u);
+    }
+};
+
+/** @brief Converte um índice do .obj (começa em 1; negativo conta do fim) para começar em 0. */
+int resolveIndex(long index, size_t count) {
+    if (index > 0) return (static_cast<size_t>(index) <= count) ? static_cast<int>(index - 1) : -2;
+    if (index < 0) return (static_cast<size_t>(-index) <= count) ? static_cast<int>(count + index) : -2;
+    return -2;
+}
+
+const char* skipSpaces(const char* p) {
+    while (*p == ' ' || *p == '\t') ++p;
+    return p;
+}
+
+} // namespace
+
+bool ModelManager::parseObj(const std::string& text, ModelMesh& out) {
+    std::vector<Vector3f> positions;
+    std::vector<Vector3f> normals;
+    std::vector<Vector2f> texcoords;
+    std::unordered_map<Corner, uint32_t, CornerHash> vertexIds;
+    std::vector<bool> missingNormal;
+    std::vector<uint32_t> face;
+
+    out.vertices.clear();
+    out.indices.clear();
+
+    size_t lineStart = 0;
+    while (lineStart < text.size()) {
+        size_t lineEnd = text.find('\n', lineStart);
+        if (lineEnd == std::string::npos) lineEnd = text.size();
+        const std::string line = text.substr(lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
+
+        const char* p = skipSpaces(line.c_str());
+        char* end;
+        if (p[0] == 'v' && (p[1] == ' ' || p[1] == '\t')) {
+            Vector3f v;
+            v.x = std::strtof(p + 2, &end);
+            v.y = std::strtof(end, &end);
+            v.z = std::strtof(end, &end);
+            positions.push_back(v);
+        } else if (p[0] == 'v' && p[1] == 'n') {
+            Vector3f n;
+            n.x = std::strtof(p + 2, &end);
+            n.y = std::strtof(end, &end);
+            n.z = std::strtof(end, &end);
+            normals.push_back(n);
+        } else if (p[0] == 'v' && p[1] == 't') {
+            Vector2f t;
+            t.x = std::strtof(p + 2, &end);
+            t.y = std::strtof(end, &end);
+            texcoords.push_back(t);
+        } else if (p[0] == 'f' && (p[1] == ' ' || p[1] == '\t')) {
+            face.clear();
+            p = skipSpaces(p + 1);
+            while (*p != '\0' && *p != '\r') {
+                Corner corner = {resolveIndex(std::strtol(p, &end, 10), positions.size()), -1, -1};
+                if (end == p) return false;
+                p = end;
+                if (*p == '/') {
+                    ++p;
+                    if (*p != '/') {
+                        corner.texcoord = resolveIndex(std::strtol(p, &end, 10), texcoords.size());
+                        p = end;
+                    }
+                    if (*p == '/') {
+                        corner.normal = resolveIndex(std::strtol(p + 1, &end, 10), normals.size());
+                        p = end;
+                    }
+                }
+                if (corner.position < 0 || corner.texcoord < -1 || corner.normal < -1) return false;
+
+                auto found = vertexIds.find(corner);
+                if (found == vertexIds.end()) {
+                    ModelVertex vertex;
+                    vertex.position = positions[corner.position];
+                    vertex.normal = (corner.normal >= 0) ? normals[corner.normal] : Vector3f{0.0f, 0.0f, 0.0f};
+                    vertex.s = (corner.texcoord >= 0) ? texcoords[corner.texcoord].x : 0.0f;
+                    vertex.t = (corner.texcoord >= 0) ? texcoords[corner.texcoord].y : 0.0f;
+                    found = vertexIds.emplace(corner, static_cast<uint32_t>(out.vertices.size())).first;
+                    out.vertices.push_back(vertex);
+                    missingNormal.push_back(corner.normal < 0);
+                }
+                face.push_back(found->second);
+                p = skipSpaces(p);
+            }
+            // Polígonos viram um leque de triângulos.
+            for (size_t k = 2; k < face.size(); ++k) {
+                out.indices.push_back(face[0]);
+                out.indices.push_back(face[k - 1]);
+                out.indices.push_back(face[k]);
+            }
+        }
+    }
+    if (out.indices.empty()) return false;
+
+    // Normais ausentes: soma das normais das faces (ponderadas pela área).
+    for (size_t k = 0; k < out.indices.size(); k += 3) {
+        ModelVertex& a = out.vertices[out.indices[k]];
+        ModelVertex& b = out.vertices[out.indices[k + 1]];
+        ModelVertex& c = out.vertices[out.indices[k + 2]];
+        const Vector3f normal = cross(b.position - a.position, c.position - a.position);
+        if (missingNormal[out.indices[k]]) a.normal += normal;
+        if (missingNormal[out.indices[k + 1]]) b.normal += normal;
+        if (missingNormal[out.indices[k + 2]]) c.normal += normal;
+    }
+    out.bounds = {out.vertices[0].position, out.vertices[0].position};
+    for (size_t i = 0; i < out.vertices.size(); ++i) {
+        ModelVertex& vertex = out.vertices[i];
+        if (missingNormal[i] && lengthSquared(vertex.normal) > 0.0f) vertex.normal = normalize(vertex.normal);
+        out.bounds.min = {std::min(out.bounds.min.x, vertex.position.x), std::min(out.bounds.min.y, vertex.position.y),
+                          std::min(out.bounds.min.z, vertex.position.z)};
+        out.bounds.max = {std::max(out.bounds.max.x, vertex.position.x), std::max(out.bounds.max.y, vertex.position.y),
+                          std::max(out.bounds.max.z, vertex.position.z)};
+    }
+    return true;
+}
+
+// --- OTIMIZAÇÃO PARA A CACHE DE VÉRTICES ---
+
+/**
+ * @brief Pontuação de um vértice: alta se ele acabou de ser usado (está no começo da
+ * cache) e se restam poucos triângulos que o usam (para não deixá-lo para trás).
+ */
+static float vertexScore(int cachePosition, int remainingTriangles, int cacheSize) {
+    if (remainingTriangles == 0) return -1.0f;
+
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            // Os vértices do último triângulo: um pouco menos, para não favorecer tiras finas.
+            score = LAST_TRIANGLE_SCORE;
+        } else {
+            score = std::pow(1.0f - static_cast<float>(cachePosition - 3) / (cacheSize - 3), CACHE_DECAY_POWER);
+        }
+    }
+    return score + VALENCE_BOOST_SCALE * std::pow(static_cast<float>(remainingTriangles), -VALENCE_BOOST_POWER);
+}
+
+/**
+ * @brief A cada passo, emite o triângulo de maior pontuação (a soma das pontuações dos
+ * seus vértices) entre os que usam vértices da cache simulada; só quando nenhum
+ * resta, procura em todos os triângulos.
+ */
+void ModelManager::optimize(ModelMesh& mesh) {
+    const int cacheSize = Config::MODEL_VERTEX_CACHE_SIZE;
+    const size_t vertexCount = mesh.vertices.size();
+    const size_t triangleCount = mesh.indices.size() / 3;
+    if (triangleCount == 0) return;
+
+    // Triângulos de cada vértice: os ainda não emitidos ficam no início do trecho.
+    std::vector<int> remaining(vertexCount, 0);
+    for (uint32_t index : mesh.indices) ++remaining[index];
+    std::vector<size_t> firstTriangle(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; ++v) firstTriangle[v + 1] = firstTriangle[v] + remaining[v];
+    std::vector<int> triangles(mesh.indices.size());
+    {
+        std::vector<size_t> cursor(firstTriangle.begin(), firstTriangle.end() - 1);
+        for (size_t k = 0; k < mesh.indices.size(); ++k) triangles[cursor[mesh.indices[k]]++] = static_cast<int>(k / 3);
+    }
+
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> score(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) score[v] = vertexScore(-1, remaining[v], cacheSize);
+
+    std::vector<float> triangleScore(triangleCount);
+    std::vector<char> emitted(triangleCount, 0);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        triangleScore[t] = score[mesh.indices[3 * t]] + score[mesh.indices[3 * t + 1]] + score[mesh.indices[3 * t + 2]];
+    }
+
+    std::vector<uint32_t> ordered;
+    ordered.reserve(mesh.indices.size());
+    std::vector<int> cache, nextCache;
+    cache.reserve(cacheSize + 3);
+    nextCache.reserve(cacheSize + 3);
+
+    int best = static_cast<int>(std::max_element(triangleScore.begin(), triangleScore.end()) - triangleScore.begin());
+    while (best >= 0) {
+        emitted[best] = 1;
+        const uint32_t* corners = &mesh.indices[3 * best];
+        ordered.insert(ordered.end(), corners, corners + 3);
+
+        // Tira o triângulo das listas dos seus vértices.
+        for (int c = 0; c < 3; ++c) {
+            const uint32_t v = corners[c];
+            int* list = &triangles[firstTriangle[v]];
+            int* last = list + remaining[v] - 1;
+            std::iter_swap(std::find(list, last + 1, best), last);
+            --remaining[v];
+        }
+
+        // Os três vértices vão para o começo da cache; os que passarem do tamanho saem.
+        nextCache.assign(corners, corners + 3);
+        for (int v : cache) {
+            if (v != static_cast<int>(corners[0]) && v != static_cast<int>(corners[1]) && v != static_cast<int>(corners[2])) {
+                nextCache.push_back(v);
+            }
+        }
+        for (size_t i = 0; i < nextCache.size(); ++i) {
+            const int v = nextCache[i];
+            cachePosition[v] = (i < static_cast<size_t>(cacheSize)) ? static_cast<int>(i) : -1;
+            score[v] = vertexScore(cachePosition[v], remaining[v], cacheSize);
+        }
+        if (nextCache.size() > static_cast<size_t>(cacheSize)) nextCache.resize(cacheSize);
+        cache.swap(nextCache);
+
+        // Repontua os triângulos restantes dos vértices da cache e escolhe o melhor.
+        best = -1;
+        float bestScore = -1.0f;
+        for (int v : cache) {
+            for (int k = 0; k < remaining[v]; ++k) {
+                const int t = triangles[firstTriangle[v] + k];
+                triangleScore[t] = score[mesh.indices[3 * t]] + score[mesh.indices[3 * t + 1]] + score[mesh.indices[3 * t + 2]];
+                if (triangleScore[t] > bestScore) {
+                    bestScore = triangleScore[t];
+                    best = t;
+                }
+            }
+        }
+        if (best < 0 && ordered.size() < mesh.indices.size()) {
+            for (size_t t = 0; t < triangleCount; ++t) {
+                if (!emitted[t] && triangleScore[t] > bestScore) {
+                    bestScore = triangleScore[t];
+                    best = static_cast<int>(t);
+                }
+            }
+        }
+    }
+
+    // Vértices na ordem do primeiro uso, para ler a memória em sequência.
+    std::vector<int> remap(vertexCount, -1);
+    std::vector<ModelVertex> vertices;
+    vertices.reserve(vertexCount);
+    for (uint32_t& index : ordered) {
+        if (remap[index] < 0) {
+            remap[index] = static_cast<int>(vertices.size());
+            vertices.push_back(mesh.vertices[index]);
+        }
+        index = static_cast<uint32_t>(remap[index]);
+    }
+    mesh.vertices.swap(vertices);
+    mesh.indices.swap(ordered);
+}
+
+float ModelManager::averageCacheMissRatio(const ModelMesh& mesh, int cacheSize) {
+    if (mesh.indices.empty()) return 0.0f;
+
+    // Um vértice está na cache FIFO se entrou há menos de cacheSize faltas.
+    std::vector<long> insertedAt(mesh.vertices.size(), -1);
+    long misses = 0;
+    for (uint32_t index : mesh.indices) {
+        if (insertedAt[index] < 0 || misses - insertedAt[index] >= cacheSize) {
+            insertedAt[index] = misses++;
+        }
+    }
+    return static_cast<float>(misses) / (mesh.indices.size() / 3);
+}
+
+// --- CACHE BINÁRIO ---
+
+/**
+ * @brief FNV-1a de 64 bits do .obj, do tamanho da cache simulada e do formato.
+ */
+uint64_t ModelManager::cacheKey(const std::string& text) {
+    uint64_t hash = FNV1A_OFFSET;
+    auto mix = [&hash](const void* data, size_t size) { hash = fnv1a(data, size, hash); };
+    const int32_t cacheSize = Config::MODEL_VERTEX_CACHE_SIZE;
+    mix(MESH_MAGIC, sizeof(MESH_MAGIC));
+    mix(&cacheSize, sizeof(cacheSize));
+    mix(text.data(), text.size());
+    return hash;
+}
+
+/** @brief O arquivo do cache: o mesmo nome, com a extensão .mesh. */
+std::string ModelManager::cachePath(const std::string& filename) {
+    const size_t slash = filename.find_last_of("/\\");
+    const size_t dot = filename.find_last_of('.');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) return filename + ".mesh";
+    return filename.substr(0, dot) + ".mesh";
+}
+
+/**
+ * @brief Lê o cache: cabeçalho (formato, chave, contagens, caixa) seguido dos vértices e índices.
+ */
+bool ModelManager::loadCache(const std::string& path, uint64_t key, ModelMesh& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    char magic[4];
+    uint64_t fileKey = 0;
+    uint32_t vertexCount = 0, indexCount = 0;
+    BoundingBox bounds;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&fileKey), sizeof(fileKey));
+    file.read(reinterpret_cast<char*>(&vertexCount), sizeof(vertexCount));
+    file.read(reinterpret_cast<char*>(&indexCount), sizeof(indexCount));
+    file.read(reinterpret_cast<char*>(&bounds), sizeof(bounds));
+    if (!file || std::memcmp(magic, MESH_MAGIC, sizeof(magic)) != 0 || fileKey != key ||
+        vertexCount == 0 || indexCount == 0 || indexCount % 3 != 0) {
+        return false;
+    }
+
+    std::vector<ModelVertex> vertices(vertexCount);
+    std::vector<uint32_t> indices(indexCount);
+    file.read(reinterpret_cast<char*>(vertices.data()), vertices.size() * sizeof(ModelVertex));
+    file.read(reinterpret_cast<char*>(indices.data()), indices.size() * sizeof(uint32_t));
+    if (!file) return false;
+    for (uint32_t index : indices) {
+        if (index >= vertexCount) return false;
+    }
+
+    out.vertices.swap(vertices);
+    out.indices.swap(indices);
+    out.bounds = bounds;
+    return true;
+}
+
+void ModelManager::saveCache(const std::string& path, uint64_t key, const ModelMesh& mesh) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "[Modelo] Não foi possível gravar o cache " << path << "\n";
+        return;
+    }
+    const uint32_t vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+    const uint32_t indexCount = static_cast<uint32_t>(mesh.indices.size());
+    file.write(MESH_MAGIC, sizeof(MESH_MAGIC));
+    file.write(reinterpret_cast<const char*>(&key), sizeof(key));
+    file.write(reinterpret_cast<const char*>(&vertexCount), sizeof(vertexCount));
+    file.write(reinterpret_cast<const char*>(&indexCount), sizeof(indexCount));
+    file.write(reinterpret_cast<const char*>(&mesh.bounds), sizeof(mesh.bounds));
+    file.write(reinterpret_cast<const char*>(mesh.vertices.data()), mesh.vertices.size() * sizeof(ModelVertex));
+    file.write(reinterpret_cast<const char*>(mesh.indices.data()), mesh.indices.size() * sizeof(uint32_t));
+}
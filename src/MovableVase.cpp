@@ -0,0 +1,75 @@
+/**
+ * @file MovableVase.cpp
+ * @brief Implementação da classe MovableVase, um vaso empurrável com corpo rígido.
+ */
+
+#include "../include/MovableVase.h"
+#include "../include/MeshManager.h"
+#include <algorithm>
+#include <GL/freeglut.h>
+
+/**
+ * @brief Construtor da classe MovableVase.
+ *
+ * O corpo rígido é uma caixa com a largura e a altura do vaso, apoiada no chão
+ * abaixo da posição informada.
+ *
+ * @param position A posição do vaso (x e z; a altura vem do chão).
+ * @param color A cor do vaso.
+ * @param height A altura do vaso.
+ * @param radius O raio do vaso.
+ */
+MovableVase::MovableVase(const Vector3f& position, const Vector3f& color, float height, float radius)
+    : _color(color), _height(height), _radius(radius), _lod(0) {
+    _body = RigidBody::makeBox({position.x, height / 2.0f, position.z}, {radius, height / 2.0f, radius}, 4.0f);
+    _body.friction = 0.8f;
+    _body.restitution = 0.1f;
+}
+
+/**
+ * @brief O vaso não tem lógica própria; seu movimento é feito pela física da sala.
+ * @param deltaTime O tempo decorrido desde o último quadro.
+ * @param gameStateManager O gerenciador de estado do jogo.
+ */
+void MovableVase::update(float deltaTime, GameStateManager& gameStateManager) {
+}
+
+/**
+ * @brief Copia para o pacote do quadro a posição atual do corpo.
+ * @param packet O pacote do quadro sendo montado pela simulação.
+ */
+void MovableVase::collectDrawItems(RenderPacket& packet) {
+    _transform.setPosition(_body.position);
+    DrawItem item(this, _transform);
+    item.color = _color;
+    _lod = MeshManager::selectLod(packet.camera.position, _body.position, std::max(_height * 0.5f, _radius), _lod);
+    item.lod = _lod;
+    packet.items.push_back(item);
+}
+
+/**
+ * @brief Desenha o vaso: um bojo cilíndrico, um gargalo mais estreito e a borda.
+ * @param item O item com a posição capturada na simulação.
+ */
+void MovableVase::draw(const DrawItem& item) {
+    const float bodyHeight = _height * 0.75f;
+    const float neckHeight = _height - bodyHeight;
+
+    glColor3f(item.color.x, item.color.y, item.color.z);
+    glTranslatef(0.0f, -_height / 2.0f, 0.0f);
+    glRotatef(-90.0f, 1.0f, 0.0f, 0.0f); // Os cilindros do GLUT crescem em +Z
+
+    MeshManager::drawCylinder(_radius, bodyHeight, item.lod);
+    glTranslatef(0.0f, 0.0f, bodyHeight);
+    MeshManager::drawCylinder(_radius * 0.55f, neckHeight, item.lod);
+    glTranslatef(0.0f, 0.0f, neckHeight);
+    MeshManager::drawTorus(_radius * 0.1f, _radius * 0.6f, item.lod);
+}
+
+/**
+ * @brief Obtém a caixa delimitadora do vaso, na posição atual do corpo.
+ * @return A caixa delimitadora do corpo rígido.
+ */
+BoundingBox MovableVase::getBoundingBox() const {
+    return _body.getBounds();
+}
@@ -0,0 +1,243 @@
+/**
+ * @file Overlay.cpp
+ * @brief Implementação do Overlay: atlas da fonte e desenho em lote do HUD.
+ */
+
+#include "../include/Overlay.h"
+#include "../include/Config.h"
+#include <GL/freeglut.h>
+#include <algorithm>
+#include <cmath>
+
+/** @brief A fonte rasterizada no atlas (a mesma usada antes pelo HUD). */
+static void* const HUD_FONT = GLUT_BITMAP_HELVETICA_18;
+
+static int nextPowerOfTwo(int value) {
+    int result = 1;
+    while (result < value) result <<= 1;
+    return result;
+}
+
+/**
+ * @brief Construtor. O atlas só é criado no primeiro quadro, na thread de OpenGL.
+ */
+Overlay::Overlay()
+    : _atlas(0), _cellWidth(0.0f), _cellHeight(0.0f), _descent(0.0f), _whiteU(0.0f), _whiteV(0.0f) {
+    std::fill(_glyphs, _glyphs + GLYPH_COUNT, Glyph{0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
+}
+
+/**
+ * @brief Rasteriza os caracteres imprimíveis da fonte no atlas.
+ *
+ * Os caracteres são desenhados em branco sobre preto, em células de tamanho fixo,
+ * no canto do back buffer, e copiados para uma textura GL_INTENSITY (com
+ * GL_MODULATE, a intensidade multiplica tanto a cor quanto o alfa do vértice).
+ * Uma célula a mais recebe um bloco branco, usado pelos retângulos sólidos, para
+ * que tudo no HUD use a mesma textura. O back buffer é limpo em seguida e o quadro
+ * ainda não foi desenhado, então nada disso aparece na tela.
+ */
+void Overlay::buildAtlas() {
+    int maxWidth = 0;
+    for (int i = 0; i < GLYPH_COUNT; ++i) {
+        maxWidth = std::max(maxWidth, glutBitmapWidth(HUD_FONT, FIRST_GLYPH + i));
+    }
+    _cellWidth = static_cast<float>(maxWidth + 2);
+    _cellHeight = static_cast<float>(glutBitmapHeight(HUD_FONT));
+    _descent = std::floor(_cellHeight * 0.25f);
+
+    const int rows = (GLYPH_COUNT + 1 + ATLAS_COLUMNS - 1) / ATLAS_COLUMNS; // +1: o bloco branco
+    const int atlasWidth = static_cast<int>(_cellWidth) * ATLAS_COLUMNS;
+    const int atlasHeight = static_cast<int>(_cellHeight) * rows;
+    const float textureWidth = static_cast<float>(nextPowerOfTwo(atlasWidth));
+    const float textureHeight = static_cast<float>(nextPowerOfTwo(atlasHeight));
+
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+
+    glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_CURRENT_BIT | GL_PIXEL_MODE_BIT);
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    gluOrtho2D(0, viewport[2], 0, viewport[3]);
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_LIGHTING);
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_BLEND);
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glColor3f(1.0f, 1.0f, 1.0f);
+
+    for (int i = 0; i <= GLYPH_COUNT; ++i) {
+        float cellX = (i % ATLAS_COLUMNS) * _cellWidth;
+        float cellY = (i / ATLAS_COLUMNS) * _cellHeight;
+
+        if (i == GLYPH_COUNT) {
+            glRectf(cellX + 2.0f, cellY + 2.0f, cellX + _cellWidth - 2.0f, cellY + _cellHeight - 2.0f);
+            _whiteU = (cellX + _cellWidth * 0.5f) / textureWidth;
+            _whiteV = (cellY + _cellHeight * 0.5f) / textureHeight;
+            break;
+        }
+
+        glRasterPos2f(cellX + 1.0f, cellY + _descent);
+        glutBitmapCharacter(HUD_FONT, FIRST_GLYPH + i);
+
+        Glyph& glyph = _glyphs[i];
+        glyph.u0 = cellX / textureWidth;
+        glyph.v0 = cellY / textureHeight;
+        glyph.u1 = (cellX + _cellWidth) / textureWidth;
+        glyph.v1 = (cellY + _cellHeight) / textureHeight;
+        glyph.width = static_cast<float>(glutBitmapWidth(HUD_FONT, FIRST_GLYPH + i));
+    }
+
+    glGenTextures(1, &_atlas);
+    glBindTexture(GL_TEXTURE_2D, _atlas);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+
+    std::vector<GLubyte> blank(static_cast<size_t>(textureWidth * textureHeight), 0);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_INTENSITY, static_cast<GLsizei>(textureWidth), static_cast<GLsizei>(textureHeight),
+                 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, blank.data());
+    glReadBuffer(GL_BACK);
+    glCopyTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 0, 0, atlasWidth, atlasHeight);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+    glPopAttrib();
+}
+
+/**
+ * @brief Começa um novo quadro do HUD.
+ */
+void Overlay::begin() {
+    if (_atlas == 0) {
+        buildAtlas();
+    }
+    _vertices.clear();
+}
+
+// --- ELEMENTOS ---
+
+void Overlay::addQuad(float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1,
+                      const Vector3f& color, float alpha) {
+    GLubyte r = static_cast<GLubyte>(std::min(std::max(color.x, 0.0f), 1.0f) * 255.0f);
+    GLubyte g = static_cast<GLubyte>(std::min(std::max(color.y, 0.0f), 1.0f) * 255.0f);
+    GLubyte b = static_cast<GLubyte>(std::min(std::max(color.z, 0.0f), 1.0f) * 255.0f);
+    GLubyte a = static_cast<GLubyte>(std::min(std::max(alpha, 0.0f), 1.0f) * 255.0f);
+
+    _vertices.push_back({x0, y0, u0, v0, r, g, b, a});
+    _vertices.push_back({x1, y0, u1, v0, r, g, b, a});
+    _vertices.push_back({x1, y1, u1, v1, r, g, b, a});
+    _vertices.push_back({x0, y1, u0, v1, r, g, b, a});
+}
+
+/**
+ * @brief Um retângulo de cor sólida.
+ * @param x A borda esquerda.
+ * @param y A borda de baixo.
+ */
+void Overlay::addRect(float x, float y, float width, float height, const Vector3f& color, float alpha) {
+    addQuad(x, y, x + width, y + height, _whiteU, _whiteV, _whiteU, _whiteV, color, alpha);
+}
+
+/**
+ * @brief A borda de um retângulo, como quatro retângulos finos.
+ */
+void Overlay::addFrame(float x, float y, float width, float height, float thickness, const Vector3f& color, float alpha) {
+    addRect(x, y, width, thickness, color, alpha);
+    addRect(x, y + height - thickness, width, thickness, color, alpha);
+    addRect(x, y + thickness, thickness, height - 2.0f * thickness, color, alpha);
+    addRect(x + width - thickness, y + thickness, thickness, height - 2.0f * thickness, color, alpha);
+}
+
+/**
+ * @brief Uma linha de texto, um quadrilátero por caractere.
+ *
+ * Caracteres fora do intervalo imprimível do ASCII viram '?'.
+ */
+void Overlay::addText(const std::string& text, float x, float y, const Vector3f& color, float alpha) {
+    float penX = x;
+    for (unsigned char c : text) {
+        int index = (c >= FIRST_GLYPH && c < FIRST_GLYPH + GLYPH_COUNT) ? c - FIRST_GLYPH : '?' - FIRST_GLYPH;
+        const Glyph& glyph = _glyphs[index];
+        if (c != ' ') {
+            float x0 = penX - 1.0f;
+            float y0 = y - _descent;
+            addQuad(x0, y0, x0 + _cellWidth, y0 + _cellHeight, glyph.u0, glyph.v0, glyph.u1, glyph.v1, color, alpha);
+        }
+        penX += glyph.width;
+    }
+}
+
+void Overlay::addCenteredText(const std::string& text, float centerX, float y, const Vector3f& color, float alpha) {
+    addText(text, std::floor(centerX - measureText(text) * 0.5f), y, color, alpha);
+}
+
+float Overlay::measureText(const std::string& text) const {
+    float width = 0.0f;
+    for (unsigned char c : text) {
+        int index = (c >= FIRST_GLYPH && c < FIRST_GLYPH + GLYPH_COUNT) ? c - FIRST_GLYPH : '?' - FIRST_GLYPH;
+        width += _glyphs[index].width;
+    }
+    return width;
+}
+
+float Overlay::getLineHeight() const {
+    return _cellHeight;
+}
+
+// --- DESENHO ---
+
+/**
+ * @brief Desenha o HUD do quadro: uma única troca de estado e um único glDrawArrays.
+ */
+void Overlay::flush() {
+    if (_vertices.empty()) return;
+
+    glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_TEXTURE_BIT | GL_CURRENT_BIT);
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    gluOrtho2D(0, Config::SCREEN_WIDTH, 0, Config::SCREEN_HEIGHT);
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_LIGHTING);
+    glDisable(GL_CULL_FACE);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, _atlas);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+
+    const GLsizei stride = sizeof(Vertex);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(2, GL_FLOAT, stride, &_vertices[0].x);
+    glTexCoordPointer(2, GL_FLOAT, stride, &_vertices[0].u);
+    glColorPointer(4, GL_UNSIGNED_BYTE, stride, &_vertices[0].r);
+    glDrawArrays(GL_QUADS, 0, static_cast<GLsizei>(_vertices.size()));
+
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+
+    glPopClientAttrib();
+    glPopAttrib();
+}
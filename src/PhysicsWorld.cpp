@@ -0,0 +1,444 @@
+/**
+ * @file PhysicsWorld.cpp
+ * @brief Implementação dos corpos rígidos, dos contatos e das ilhas que dormem.
+ */
+
+#include "../include/PhysicsWorld.h"
+#include "../include/Config.h"
+#include "../include/VectorMath.h"
+#include <algorithm>
+#include <cmath>
+
+// --- FUNÇÕES AUXILIARES ---
+
+/**
+ * @brief Extensão do corpo em cada eixo (as meias dimensões, ou o raio para esferas).
+ */
+static Vector3f extentsOf(const RigidBody& body) {
+    if (body.shape == BodyShape::SPHERE) return {body.radius, body.radius, body.radius};
+    return body.halfExtents;
+}
+
+/**
+ * @brief Contato entre uma esfera e uma caixa.
+ * @param normal Recebe a normal, apontando da esfera para a caixa.
+ */
+static bool sphereBoxContact(const Vector3f& center, float radius, const Vector3f& boxCenter, const Vector3f& half,
+                             Vector3f& normal, float& depth) {
+    Vector3f local = center - boxCenter;
+    Vector3f closest = {
+        std::max(-half.x, std::min(local.x, half.x)),
+        std::max(-half.y, std::min(local.y, half.y)),
+        std::max(-half.z, std::min(local.z, half.z))
+    };
+    Vector3f offset = closest - local;
+    float distanceSq = lengthSquared(offset);
+    if (distanceSq >= radius * radius) return false;
+
+    if (distanceSq > 1e-12f) {
+        float distance = std::sqrt(distanceSq);
+        normal = offset / distance;
+        depth = radius - distance;
+        return true;
+    }
+
+    // Centro dentro da caixa: sai pela face mais próxima.
+    float gaps[3] = {half.x - std::fabs(local.x), half.y - std::fabs(local.y), half.z - std::fabs(local.z)};
+    int axis = 0;
+    if (gaps[1] < gaps[axis]) axis = 1;
+    if (gaps[2] < gaps[axis]) axis = 2;
+    const float sides[3] = {local.x, local.y, local.z};
+    normal = {0.0f, 0.0f, 0.0f};
+    float sign = (sides[axis] < 0.0f) ? 1.0f : -1.0f;
+    if (axis == 0) normal.x = sign; else if (axis == 1) normal.y = sign; else normal.z = sign;
+    depth = gaps[axis] + radius;
+    return true;
+}
+
+/**
+ * @brief Calcula o contato entre dois corpos.
+ * @param normal Recebe a normal do contato, apontando de `a` para `b`.
+ * @param depth Recebe a profundidade de penetração.
+ * @return true se os corpos se sobrepõem.
+ */
+static bool computeContact(const RigidBody& a, const RigidBody& b, Vector3f& normal, float& depth) {
+    Vector3f d = b.position - a.position;
+
+    if (a.shape == BodyShape::SPHERE && b.shape == BodyShape::SPHERE) {
+        float radii = a.radius + b.radius;
+        float distanceSq = lengthSquared(d);
+        if (distanceSq >= radii * radii) return false;
+        float distance = std::sqrt(distanceSq);
+        normal = (distance > 1e-6f) ? d / distance : Vector3f{0.0f, 1.0f, 0.0f};
+        depth = radii - distance;
+        return true;
+    }
+
+    if (a.shape == BodyShape::SPHERE) {
+        return sphereBoxContact(a.position, a.radius, b.position, b.halfExtents, normal, depth);
+    }
+    if (b.shape == BodyShape::SPHERE) {
+        if (!sphereBoxContact(b.position, b.radius, a.position, a.halfExtents, normal, depth)) return false;
+        normal = -normal;
+        return true;
+    }
+
+    // Caixa contra caixa: eixo de menor sobreposição.
+    float overlaps[3] = {
+        a.halfExtents.x + b.halfExtents.x - std::fabs(d.x),
+        a.halfExtents.y + b.halfExtents.y - std::fabs(d.y),
+        a.halfExtents.z + b.halfExtents.z - std::fabs(d.z)
+    };
+    if (overlaps[0] <= 0.0f || overlaps[1] <= 0.0f || overlaps[2] <= 0.0f) return false;
+    int axis = 0;
+    if (overlaps[1] < overlaps[axis]) axis = 1;
+    if (overlaps[2] < overlaps[axis]) axis = 2;
+    const float sides[3] = {d.x, d.y, d.z};
+    normal = {0.0f, 0.0f, 0.0f};
+    float sign = (sides[axis] < 0.0f) ? -1.0f : 1.0f;
+    if (axis == 0) normal.x = sign; else if (axis == 1) normal.y = sign; else normal.z = sign;
+    depth = overlaps[axis];
+    return true;
+}
+
+/**
+ * @brief Resolve um contato: separa os corpos e aplica os impulsos de choque e de atrito.
+ * @param normal A normal do contato, de `a` para `b`.
+ * @param depth A profundidade de penetração.
+ */
+static void resolveContact(RigidBody& a, RigidBody& b, const Vector3f& normal, float depth) {
+    float totalInverseMass = a.inverseMass + b.inverseMass;
+    if (totalInverseMass <= 0.0f) return;
+
+    // Correção de posição, deixando uma pequena folga para os contatos não "tremerem".
+    float correction = std::max(depth - Config::PHYSICS_CONTACT_SLOP, 0.0f) / totalInverseMass;
+    a.position -= normal * (correction * a.inverseMass);
+    b.position += normal * (correction * b.inverseMass);
+
+    Vector3f relative = b.velocity - a.velocity;
+    float normalSpeed = dot(relative, normal);
+    if (normalSpeed > 0.0f) return; // já se afastando
+
+    // Choques lentos não quicam; sem isso, um corpo apoiado no chão vibraria para sempre.
+    float restitution = (-normalSpeed > Config::PHYSICS_BOUNCE_SPEED) ? std::min(a.restitution, b.restitution) : 0.0f;
+    float impulse = -(1.0f + restitution) * normalSpeed / totalInverseMass;
+    a.velocity -= normal * (impulse * a.inverseMass);
+    b.velocity += normal * (impulse * b.inverseMass);
+
+    // Atrito de Coulomb: o impulso tangencial é limitado por mu * impulso normal.
+    Vector3f tangent = relative;
+    tangent -= normal * normalSpeed;
+    float tangentSpeed = length(tangent);
+    if (tangentSpeed < 1e-6f) return;
+    float mu = std::sqrt(a.friction * b.friction);
+    float frictionImpulse = std::min(tangentSpeed / totalInverseMass, mu * impulse);
+    a.velocity += tangent * (frictionImpulse * a.inverseMass / tangentSpeed);
+    b.velocity -= tangent * (frictionImpulse * b.inverseMass / tangentSpeed);
+}
+
+/**
+ * @brief Cria um corpo imóvel com a forma de uma caixa (usado para paredes e chão).
+ */
+static RigidBody makeStatic(const BoundingBox& box) {
+    Vector3f center = (box.min + box.max) * 0.5f;
+    Vector3f half = (box.max - box.min) * 0.5f;
+    return RigidBody::makeBox(center, half, 0.0f);
+}
+
+// --- IMPLEMENTAÇÃO DO RIGIDBODY ---
+
+/**
+ * @brief Construtor padrão: uma caixa unitária imóvel, acordada.
+ */
+RigidBody::RigidBody()
+    : shape(BodyShape::BOX), position{0.0f, 0.0f, 0.0f}, velocity{0.0f, 0.0f, 0.0f},
+      halfExtents{0.5f, 0.5f, 0.5f}, radius(0.5f), inverseMass(0.0f),
+      restitution(0.2f), friction(0.6f), enabled(true), asleep(false), restTime(0.0f) {}
+
+/**
+ * @brief Cria uma caixa.
+ * @param position O centro da caixa.
+ * @param halfExtents As meias dimensões.
+ * @param mass A massa (0 para um corpo imóvel).
+ * @return O corpo criado.
+ */
+RigidBody RigidBody::makeBox(const Vector3f& position, const Vector3f& halfExtents, float mass) {
+    RigidBody body;
+    body.shape = BodyShape::BOX;
+    body.position = position;
+    body.halfExtents = halfExtents;
+    body.inverseMass = (mass > 0.0f) ? 1.0f / mass : 0.0f;
+    return body;
+}
+
+/**
+ * @brief Cria uma esfera.
+ * @param position O centro da esfera.
+ * @param radius O raio.
+ * @param mass A massa (0 para um corpo imóvel).
+ * @return O corpo criado.
+ */
+RigidBody RigidBody::makeSphere(const Vector3f& position, float radius, float mass) {
+    RigidBody body;
+    body.shape = BodyShape::SPHERE;
+    body.position = position;
+    body.radius = radius;
+    body.halfExtents = {radius, radius, radius};
+    body.inverseMass = (mass > 0.0f) ? 1.0f / mass : 0.0f;
+    return body;
+}
+
+/**
+ * @brief Obtém a caixa delimitadora do corpo na posição atual.
+ * @return A caixa delimitadora.
+ */
+BoundingBox RigidBody::getBounds() const {
+    Vector3f e = extentsOf(*this);
+    return {position - e, position + e};
+}
+
+/**
+ * @brief Acorda o corpo.
+ */
+void RigidBody::wake() {
+    asleep = false;
+    restTime = 0.0f;
+}
+
+/**
+ * @brief Aplica um impulso e acorda o corpo.
+ * @param impulse O impulso.
+ */
+void RigidBody::applyImpulse(const Vector3f& impulse) {
+    velocity += impulse * inverseMass;
+    wake();
+}
+
+// --- IMPLEMENTAÇÃO DO PHYSICSWORLD ---
+
+/**
+ * @brief Construtor do PhysicsWorld.
+ */
+PhysicsWorld::PhysicsWorld() : _staticColliders(nullptr), _accumulator(0.0f) {}
+
+/**
+ * @brief Define as caixas estáticas da sala.
+ * @param colliders Ponteiro para o vetor de caixas.
+ */
+void PhysicsWorld::setStaticColliders(const std::vector<BoundingBox>* colliders) {
+    _staticColliders = colliders;
+}
+
+/**
+ * @brief Registra um corpo.
+ * @param body O corpo. Continua pertencendo a quem o criou.
+ */
+void PhysicsWorld::addBody(RigidBody* body) {
+    if (body && std::find(_bodies.begin(), _bodies.end(), body) == _bodies.end()) {
+        _bodies.push_back(body);
+    }
+}
+
+/**
+ * @brief Remove um corpo.
+ * @param body O corpo.
+ */
+void PhysicsWorld::removeBody(RigidBody* body) {
+    _bodies.erase(std::remove(_bodies.begin(), _bodies.end(), body), _bodies.end());
+}
+
+/**
+ * @brief Conta os corpos ativos e acordados.
+ * @return O número de corpos que serão simulados no próximo passo.
+ */
+int PhysicsWorld::getAwakeCount() const {
+    int count = 0;
+    for (const RigidBody* body : _bodies) {
+        if (body->enabled && !body->asleep) count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Avança a simulação em passos fixos.
+ *
+ * O tempo que sobra (menos que um passo) fica acumulado para a próxima chamada.
+ * O número de passos por chamada é limitado para que um quadro lento não
+ * provoque uma espiral de passos cada vez mais atrasados.
+ *
+ * @param deltaTime O tempo decorrido (em ms).
+ */
+void PhysicsWorld::step(float deltaTime) {
+    if (getAwakeCount() == 0) {
+        _accumulator = 0.0f;
+        return;
+    }
+
+    _accumulator += deltaTime;
+    int steps = 0;
+    while (_accumulator >= Config::PHYSICS_STEP_MS && steps < Config::PHYSICS_MAX_SUBSTEPS) {
+        simulate(Config::PHYSICS_STEP_MS / 1000.0f);
+        _accumulator -= Config::PHYSICS_STEP_MS;
+        steps++;
+    }
+    if (steps == Config::PHYSICS_MAX_SUBSTEPS) {
+        _accumulator = 0.0f;
+    }
+}
+
+/**
+ * @brief Executa um passo fixo: integra, resolve contatos e atualiza as ilhas.
+ * @param dt A duração do passo, em segundos.
+ */
+void PhysicsWorld::simulate(float dt) {
+    const int count = (int)_bodies.size();
+    _islandParent.resize(count);
+    for (int i = 0; i < count; ++i) _islandParent[i] = i;
+
+    // 1. Integração (Euler semi-implícito) dos corpos acordados.
+    for (RigidBody* body : _bodies) {
+        if (!body->enabled || body->asleep || body->inverseMass <= 0.0f) continue;
+        body->velocity.y -= Config::PHYSICS_GRAVITY * dt;
+        body->position += body->velocity * dt;
+    }
+
+    // 2. Contatos com o mundo estático: chão e paredes.
+    static const RigidBody floorBody = makeStatic({{-1.0e4f, -1.0f, -1.0e4f}, {1.0e4f, 0.0f, 1.0e4f}});
+    for (RigidBody* body : _bodies) {
+        if (!body->enabled || body->asleep) continue;
+
+        Vector3f normal;
+        float depth;
+        RigidBody floorCopy = floorBody;
+        if (computeContact(*body, floorCopy, normal, depth)) {
+            resolveContact(*body, floorCopy, normal, depth);
+        }
+        if (!_staticColliders) continue;
+        for (const BoundingBox& box : *_staticColliders) {
+            RigidBody wall = makeStatic(box);
+            if (computeContact(*body, wall, normal, depth)) {
+                resolveContact(*body, wall, normal, depth);
+            }
+        }
+    }
+
+    // 3. Contatos entre corpos. Pares de corpos dormindo são ignorados.
+    for (int i = 0; i < count; ++i) {
+        RigidBody* a = _bodies[i];
+        if (!a->enabled) continue;
+        for (int j = i + 1; j < count; ++j) {
+            RigidBody* b = _bodies[j];
+            if (!b->enabled || (a->asleep && b->asleep)) continue;
+
+            Vector3f normal;
+            float depth;
+            if (computeContact(*a, *b, normal, depth)) {
+                resolveContact(*a, *b, normal, depth);
+                unite(i, j);
+            }
+        }
+    }
+
+    updateSleep(dt);
+}
+
+/**
+ * @brief Atualiza o tempo de repouso de cada corpo e põe para dormir as ilhas paradas.
+ *
+ * Uma ilha só dorme quando todos os seus corpos estão parados há pelo menos
+ * Config::PHYSICS_SLEEP_TIME. Se qualquer corpo de uma ilha estiver em movimento,
+ * a ilha inteira fica acordada (é assim que um corpo em movimento acorda os
+ * corpos dormindo em que ele encosta).
+ *
+ * @param dt A duração do passo, em segundos.
+ */
+void PhysicsWorld::updateSleep(float dt) {
+    const int count = (int)_bodies.size();
+    const float threshold = Config::PHYSICS_SLEEP_VELOCITY * Config::PHYSICS_SLEEP_VELOCITY;
+
+    for (RigidBody* body : _bodies) {
+        if (!body->enabled || body->asleep) continue;
+        if (lengthSquared(body->velocity) < threshold) body->restTime += dt;
+        else body->restTime = 0.0f;
+    }
+
+    // Uma ilha pode dormir se todos os seus membros já repousaram o suficiente.
+    std::vector<char>& canSleep = _islandCanSleep;
+    canSleep.assign(count, 1);
+    for (int i = 0; i < count; ++i) {
+        const RigidBody* body = _bodies[i];
+        if (!body->enabled) continue;
+        if (!body->asleep && body->restTime < Config::PHYSICS_SLEEP_TIME) {
+            canSleep[findRoot(i)] = 0;
+        }
+    }
+
+    for (int i = 0; i < count; ++i) {
+        RigidBody* body = _bodies[i];
+        if (!body->enabled) continue;
+        if (canSleep[findRoot(i)]) {
+            body->asleep = true;
+            body->velocity = {0.0f, 0.0f, 0.0f};
+        } else if (body->asleep) {
+            body->wake();
+        }
+    }
+}
+
+/**
+ * @brief Encontra a raiz da ilha de um corpo (com compressão de caminho).
+ */
+int PhysicsWorld::findRoot(int index) {
+    while (_islandParent[index] != index) {
+        _islandParent[index] = _islandParent[_islandParent[index]];
+        index = _islandParent[index];
+    }
+    return index;
+}
+
+/**
+ * @brief Junta as ilhas de dois corpos que estão em contato.
+ */
+void PhysicsWorld::unite(int a, int b) {
+    int rootA = findRoot(a);
+    int rootB = findRoot(b);
+    if (rootA != rootB) _islandParent[rootB] = rootA;
+}
+
+/**
+ * @brief Empurra os corpos tocados pela cápsula do jogador.
+ *
+ * O teste é feito no plano XZ, entre o círculo da cápsula e a caixa delimitadora
+ * do corpo, quando as faixas verticais se cruzam.
+ *
+ * @param capsule A cápsula do jogador.
+ * @param velocity A velocidade horizontal do jogador.
+ */
+void PhysicsWorld::pushBodies(const Capsule& capsule, const Vector3f& velocity) {
+    const float capsuleMin = capsule.center.y - capsule.halfHeight - capsule.radius;
+    const float capsuleMax = capsule.center.y + capsule.halfHeight + capsule.radius;
+
+    for (RigidBody* body : _bodies) {
+        if (!body->enabled || body->inverseMass <= 0.0f) continue;
+
+        BoundingBox box = body->getBounds();
+        if (box.max.y <= capsuleMin || box.min.y >= capsuleMax) continue;
+
+        float closestX = std::max(box.min.x, std::min(capsule.center.x, box.max.x));
+        float closestZ = std::max(box.min.z, std::min(capsule.center.z, box.max.z));
+        Vector3f offset = {closestX - capsule.center.x, 0.0f, closestZ - capsule.center.z};
+        float distanceSq = lengthSquared(offset);
+        if (distanceSq >= capsule.radius * capsule.radius || distanceSq < 1e-12f) continue;
+
+        float distance = std::sqrt(distanceSq);
+        Vector3f normal = offset / distance;
+        body->position += normal * (capsule.radius - distance);
+
+        float pushSpeed = dot(velocity, normal);
+        float bodySpeed = dot(body->velocity, normal);
+        if (pushSpeed > bodySpeed) {
+            body->velocity += normal * (pushSpeed - bodySpeed);
+        }
+        body->wake();
+    }
+}
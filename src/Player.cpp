@@ -8,19 +8,8 @@
 #include "../include/Config.h"
 #include <vector>
 #include "../include/GameObject.h"
-#include "../include/Wall.h"
-
-/**
- * @brief Verifica a coliso entre duas caixas delimitadoras (Bounding Boxes).
- * @param a A primeira BoundingBox.
- * @param b A segunda BoundingBox.
- * @return Retorna 'true' se as caixas se sobrepem, 'false' caso contrrio.
- */
-bool checkCollision(const BoundingBox& a, const BoundingBox& b) {
-    return (a.min.x < b.max.x && a.max.x > b.min.x) &&
-           (a.min.y < b.max.y && a.max.y > b.min.y) &&
-           (a.min.z < b.max.z && a.max.z > b.min.z);
-}
+#include "../include/Collision.h"
+#include "../include/VectorMath.h"
 
 /**
  * @brief Construtor padro da classe Player.
@@ -31,6 +20,7 @@ bool checkCollision(const BoundingBox& a, const BoundingBox& b) {
 Player::Player() {
     // Voltamos a definir a altura da viso diretamente em _position.y
     _position = {0.0f, 1.6f, 3.0f};
+    _velocity = {0.0f, 0.0f, 0.0f};
 
     _movementSpeed = Config::PLAYER_SPEED;
     _collisionRadius = Config::PLAYER_COLLISION_RADIUS;
@@ -83,11 +73,35 @@ void Player::setPosition(const Vector3f& pos) {
 BoundingBox Player::getBoundingBox() const {
     BoundingBox box;
     // Caixa de coliso centrada na altura do jogador
-    box.min = { _position.x - _collisionRadius, _position.y - 1.0f, _position.z - _collisionRadius };
-    box.max = { _position.x + _collisionRadius, _position.y + 1.0f, _position.z + _collisionRadius };
+    box.min = { _position.x - _collisionRadius, _position.y - Config::PLAYER_BODY_HALF_HEIGHT, _position.z - _collisionRadius };
+    box.max = { _position.x + _collisionRadius, _position.y + Config::PLAYER_BODY_HALF_HEIGHT, _position.z + _collisionRadius };
     return box;
 }
 
+/**
+ * @brief Obtm a cpsula de coliso do jogador.
+ *
+ * A cpsula ocupa a mesma faixa vertical da Bounding Box, com as tampas
+ * arredondadas pelo raio de coliso.
+ *
+ * @return A cpsula centrada na posio do jogador.
+ */
+Capsule Player::getCapsule() const {
+    Capsule capsule;
+    capsule.center = _position;
+    capsule.radius = _collisionRadius;
+    capsule.halfHeight = Config::PLAYER_BODY_HALF_HEIGHT - _collisionRadius;
+    return capsule;
+}
+
+/**
+ * @brief Obtm a velocidade real do jogador no ltimo passo (j descontadas as colises).
+ * @return A velocidade, em unidades por segundo.
+ */
+const Vector3f& Player::getVelocity() const {
+    return _velocity;
+}
+
 /**
  * @brief Obtm a instncia da cmera do jogador.
  * @return Uma referncia para o objeto FPSCamera.
@@ -100,27 +114,21 @@ FPSCamera& Player::getCamera() {
  * @brief Atualiza a posio do jogador e lida com as colises.
  *
  * O mtodo calcula a direo do movimento com base nas teclas pressionadas.
- * Em seguida, ele move o jogador e, para cada objeto na cena, verifica se houve
- * uma coliso. Se uma coliso com uma parede for detectada, o movimento
- * correspondente  revertido.
+ * Em seguida, varre a cpsula do jogador ao longo do deslocamento contra as
+ * caixas estticas da sala: ao encostar numa parede, o jogador desliza ao longo
+ * dela em vez de parar, e nenhum passo, por maior que seja, atravessa uma parede.
  *
  * @param deltaTime O tempo decorrido desde o ltimo quadro.
- * @param objects Uma lista de objetos do jogo para verificar a coliso.
+ * @param colliders As caixas de coliso estticas da sala atual.
  * @param gameStateManager O gerenciador de estado do jogo (no usado nesta implementao).
  */
-void Player::update(float deltaTime, const std::vector<GameObject*>& objects, GameStateManager& gameStateManager) {
+void Player::update(float deltaTime, const std::vector<BoundingBox>& colliders, GameStateManager& gameStateManager) {
     float dtSeconds = deltaTime / 1000.0f;
     float velocity = _movementSpeed * dtSeconds;
 
     Vector3f front = _camera.getFrontVector();
     Vector3f right = _camera.getRightVector();
-    Vector3f moveFront = {front.x, 0.0f, front.z};
-
-    float frontLength = sqrt(moveFront.x * moveFront.x + moveFront.z * moveFront.z);
-    if (frontLength > 0) {
-        moveFront.x /= frontLength;
-        moveFront.z /= frontLength;
-    }
+    Vector3f moveFront = normalize(Vector3f{front.x, 0.0f, front.z});
 
     Vector3f moveDirection = {0.0f, 0.0f, 0.0f};
     if (_keyState['w']) { moveDirection.x += moveFront.x; moveDirection.z += moveFront.z; }
@@ -128,31 +136,16 @@ void Player::update(float deltaTime, const std::vector<GameObject*>& objects, Ga
     if (_keyState['a']) { moveDirection.x -= right.x; moveDirection.z -= right.z; }
     if (_keyState['d']) { moveDirection.x += right.x; moveDirection.z += right.z; }
 
-    float dirLength = sqrt(moveDirection.x * moveDirection.x + moveDirection.z * moveDirection.z);
-    if (dirLength > 0) {
-        moveDirection.x /= dirLength;
-        moveDirection.z /= dirLength;
-
-        Vector3f originalPosition = _position;
-        _position.x += moveDirection.x * velocity;
-
-        for (const auto* obj : objects) {
-            const Wall* wall = dynamic_cast<const Wall*>(obj);
-            if (wall && checkCollision(getBoundingBox(), wall->getBoundingBox())) {
-                _position.x = originalPosition.x;
-                break;
-            }
-        }
-
-        _position.z += moveDirection.z * velocity;
-
-        for (const auto* obj : objects) {
-            const Wall* wall = dynamic_cast<const Wall*>(obj);
-            if (wall && checkCollision(getBoundingBox(), wall->getBoundingBox())) {
-                _position.z = originalPosition.z;
-                break;
-            }
-        }
+    Vector3f previousPosition = _position;
+    if (lengthSquared(moveDirection) > 0.0f) {
+        Vector3f motion = normalize(moveDirection) * velocity;
+        _position = Collision::moveAndSlide(getCapsule(), motion, colliders);
+    }
+
+    _velocity = {0.0f, 0.0f, 0.0f};
+    if (dtSeconds > 0.0f) {
+        _velocity.x = (_position.x - previousPosition.x) / dtSeconds;
+        _velocity.z = (_position.z - previousPosition.z) / dtSeconds;
     }
 
     // Sincroniza a cmera com a posio final e segura do jogador
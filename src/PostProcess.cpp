@@ -0,0 +1,350 @@
+/**
+ * @file PostProcess.cpp
+ * @brief Implementação da cadeia de pós-processamento: alvos, shaders e passadas.
+ */
+
+#include "../include/PostProcess.h"
+#include "../include/GLExtensions.h"
+#include "../include/Config.h"
+#include <GL/freeglut.h>
+#include <algorithm>
+#include <iostream>
+
+bool PostProcess::_bloomFrame = false;
+
+// --- SHADERS (GLSL 1.10) ---
+
+/** @brief Repassa a posição (já em coordenadas de recorte) e a coordenada de textura. */
+static const char* const FULLSCREEN_VERTEX =
+    "varying vec2 uv;\n"
+    "void main() {\n"
+    "    uv = gl_MultiTexCoord0.xy;\n"
+    "    gl_Position = gl_Vertex;\n"
+    "}\n";
+
+/**
+ * @brief A parte emissiva da cena (cor * (1 - alfa)), reduzida: quatro amostras
+ * bilineares cobrem o bloco de 4x4 pixels de cada pixel da textura do bloom.
+ * A cena ocupa só o canto `region` da textura (ver setRenderScale).
+ */
+static const char* const BRIGHT_FRAGMENT =
+    "uniform sampler2D scene;\n"
+    "uniform vec2 texel;\n"
+    "uniform vec2 region;\n"
+    "varying vec2 uv;\n"
+    "vec3 emission(vec2 p) {\n"
+    "    vec4 c = texture2D(scene, min(p, region - texel * 0.5));\n"
+    "    return c.rgb * (1.0 - c.a);\n"
+    "}\n"
+    "void main() {\n"
+    "    vec2 p = uv * region;\n"
+    "    vec3 sum = emission(p + texel * vec2(-1.0, -1.0)) + emission(p + texel * vec2(1.0, -1.0))\n"
+    "             + emission(p + texel * vec2(-1.0, 1.0)) + emission(p + texel * vec2(1.0, 1.0));\n"
+    "    gl_FragColor = vec4(sum * 0.25, 1.0);\n"
+    "}\n";
+
+/**
+ * @brief Gaussiana de 9 amostras numa direção, com 5 leituras (as amostras vizinhas
+ * são combinadas pela filtragem bilinear).
+ */
+static const char* const BLUR_FRAGMENT =
+    "uniform sampler2D source;\n"
+    "uniform vec2 direction;\n"
+    "varying vec2 uv;\n"
+    "void main() {\n"
+    "    vec3 c = texture2D(source, uv).rgb * 0.2270270270;\n"
+    "    c += (texture2D(source, uv + direction * 1.3846153846).rgb\n"
+    "        + texture2D(source, uv - direction * 1.3846153846).rgb) * 0.3162162162;\n"
+    "    c += (texture2D(source, uv + direction * 3.2307692308).rgb\n"
+    "        + texture2D(source, uv - direction * 3.2307692308).rgb) * 0.0702702703;\n"
+    "    gl_FragColor = vec4(c, 1.0);\n"
+    "}\n";
+
+/**
+ * @brief A cena (com FXAA, na versão de Lottes que procura a direção da borda pela
+ * luminância dos quatro vizinhos diagonais) mais o brilho. Com a cena em resolução
+ * reduzida, a ampliação bilinear é seguida de um filtro de nitidez (a cor menos o
+ * laplaciano dos quatro vizinhos).
+ */
+static const char* const COMPOSITE_FRAGMENT =
+    "uniform sampler2D scene;\n"
+    "uniform sampler2D bloom;\n"
+    "uniform vec2 texel;\n"
+    "uniform vec2 region;\n"
+    "uniform float bloomStrength;\n"
+    "uniform float fxaa;\n"
+    "uniform float sharpen;\n"
+    "varying vec2 uv;\n"
+    "const vec3 LUMA = vec3(0.299, 0.587, 0.114);\n"
+    "const float REDUCE_MIN = 1.0 / 128.0;\n"
+    "const float REDUCE_MUL = 1.0 / 8.0;\n"
+    "const float SPAN_MAX = 8.0;\n"
+    "vec3 scenePixel(vec2 p) {\n"
+    "    return texture2D(scene, clamp(p, texel * 0.5, region - texel * 0.5)).rgb;\n"
+    "}\n"
+    "vec3 antialiased(vec2 p) {\n"
+    "    vec3 rgbM = scenePixel(p);\n"
+    "    float lumaNW = dot(scenePixel(p + texel * vec2(-1.0, -1.0)), LUMA);\n"
+    "    float lumaNE = dot(scenePixel(p + texel * vec2(1.0, -1.0)), LUMA);\n"
+    "    float lumaSW = dot(scenePixel(p + texel * vec2(-1.0, 1.0)), LUMA);\n"
+    "    float lumaSE = dot(scenePixel(p + texel * vec2(1.0, 1.0)), LUMA);\n"
+    "    float lumaM = dot(rgbM, LUMA);\n"
+    "    float lumaMin = min(lumaM, min(min(lumaNW, lumaNE), min(lumaSW, lumaSE)));\n"
+    "    float lumaMax = max(lumaM, max(max(lumaNW, lumaNE), max(lumaSW, lumaSE)));\n"
+    "    vec2 dir = vec2(-((lumaNW + lumaNE) - (lumaSW + lumaSE)), (lumaNW + lumaSW) - (lumaNE + lumaSE));\n"
+    "    float reduce = max((lumaNW + lumaNE + lumaSW + lumaSE) * 0.25 * REDUCE_MUL, REDUCE_MIN);\n"
+    "    float scale = 1.0 / (min(abs(dir.x), abs(dir.y)) + reduce);\n"
+    "    dir = clamp(dir * scale, vec2(-SPAN_MAX), vec2(SPAN_MAX)) * texel;\n"
+    "    vec3 rgbA = 0.5 * (scenePixel(p + dir * (1.0 / 3.0 - 0.5))\n"
+    "                     + scenePixel(p + dir * (2.0 / 3.0 - 0.5)));\n"
+    "    vec3 rgbB = rgbA * 0.5 + 0.25 * (scenePixel(p - dir * 0.5)\n"
+    "                                    + scenePixel(p + dir * 0.5));\n"
+    "    float lumaB = dot(rgbB, LUMA);\n"
+    "    return (lumaB < lumaMin || lumaB > lumaMax) ? rgbA : rgbB;\n"
+    "}\n"
+    "vec3 sharpened(vec2 p, vec3 c) {\n"
+    "    vec3 n = scenePixel(p + vec2(texel.x, 0.0)) + scenePixel(p - vec2(texel.x, 0.0))\n"
+    "           + scenePixel(p + vec2(0.0, texel.y)) + scenePixel(p - vec2(0.0, texel.y));\n"
+    "    return clamp(c + (c * 4.0 - n) * sharpen, 0.0, 1.0);\n"
+    "}\n"
+    "void main() {\n"
+    "    vec2 p = uv * region;\n"
+    "    vec3 color = (fxaa > 0.5) ? antialiased(p) : scenePixel(p);\n"
+    "    if (sharpen > 0.0) color = sharpened(p, color);\n"
+    "    gl_FragColor = vec4(color + texture2D(bloom, uv).rgb * bloomStrength, 1.0);\n"
+    "}\n";
+
+PostProcess::PostProcess()
+    : _scene{0, 0, 0, 0}, _bloom{{0, 0, 0, 0}, {0, 0, 0, 0}}, _depthStencil(0),
+      _brightProgram(0), _blurProgram(0), _compositeProgram(0),
+      _active(false), _bloomEnabled(Config::BLOOM_STRENGTH > 0.0f), _fxaaEnabled(Config::POST_FXAA),
+      _renderScale(1.0f) {}
+
+/**
+ * @brief Cria uma textura e um framebuffer que desenha nela.
+ * @param depthStencil Renderbuffer de profundidade e stencil, ou 0 para nenhum.
+ */
+bool PostProcess::createTarget(Target& target, int width, int height, GLenum format, GLuint depthStencil) {
+    target.width = width;
+    target.height = height;
+
+    glGenTextures(1, &target.texture);
+    glBindTexture(GL_TEXTURE_2D, target.texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    GLExtensions::genFramebuffers(1, &target.framebuffer);
+    GLExtensions::bindFramebuffer(GL_FRAMEBUFFER, target.framebuffer);
+    GLExtensions::framebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target.texture, 0);
+    if (depthStencil) {
+        GLExtensions::framebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthStencil);
+        GLExtensions::framebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthStencil);
+    }
+    const bool complete = GLExtensions::checkFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    GLExtensions::bindFramebuffer(GL_FRAMEBUFFER, 0);
+    return complete;
+}
+
+bool PostProcess::init(int width, int height) {
+    release();
+    if (!GLExtensions::hasFramebuffers() || !GLExtensions::hasShaders() || !GLExtensions::hasMultitexture()) {
+        std::cerr << "[Post] Framebuffer objects ou shaders indisponíveis; a cena vai direto para a tela.\n";
+        return false;
+    }
+
+    GLExtensions::genRenderbuffers(1, &_depthStencil);
+    GLExtensions::bindRenderbuffer(GL_RENDERBUFFER, _depthStencil);
+    GLExtensions::renderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+    GLExtensions::bindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    const int bloomWidth = std::max(1, width / Config::BLOOM_DOWNSAMPLE);
+    const int bloomHeight = std::max(1, height / Config::BLOOM_DOWNSAMPLE);
+    bool ok = createTarget(_scene, width, height, GL_RGBA8, _depthStencil) &&
+              createTarget(_bloom[0], bloomWidth, bloomHeight, GL_RGB8, 0) &&
+              createTarget(_bloom[1], bloomWidth, bloomHeight, GL_RGB8, 0);
+
+    if (ok) {
+        _brightProgram = GLExtensions::buildProgram("bloom (extração)", FULLSCREEN_VERTEX, BRIGHT_FRAGMENT);
+        _blurProgram = GLExtensions::buildProgram("bloom (desfoque)", FULLSCREEN_VERTEX, BLUR_FRAGMENT);
+        _compositeProgram = GLExtensions::buildProgram("composição", FULLSCREEN_VERTEX, COMPOSITE_FRAGMENT);
+        ok = _brightProgram && _blurProgram && _compositeProgram;
+    }
+    if (!ok) {
+        std::cerr << "[Post] Não foi possível montar o pós-processamento; a cena vai direto para a tela.\n";
+        release();
+        return false;
+    }
+
+    _active = true;
+    return true;
+}
+
+/** @brief Libera tudo o que init criou (também quando init falha no meio). */
+void PostProcess::release() {
+    Target* targets[] = {&_scene, &_bloom[0], &_bloom[1]};
+    for (Target* target : targets) {
+        if (target->framebuffer) GLExtensions::deleteFramebuffers(1, &target->framebuffer);
+        if (target->texture) glDeleteTextures(1, &target->texture);
+        *target = {0, 0, 0, 0};
+    }
+    if (_depthStencil) GLExtensions::deleteRenderbuffers(1, &_depthStencil);
+    _depthStencil = 0;
+
+    GLuint* programs[] = {&_brightProgram, &_blurProgram, &_compositeProgram};
+    for (GLuint* program : programs) {
+        if (*program) GLExtensions::deleteProgram(*program);
+        *program = 0;
+    }
+    _active = false;
+}
+
+bool PostProcess::isActive() const {
+    return _active;
+}
+
+void PostProcess::setBloomEnabled(bool enabled) {
+    _bloomEnabled = enabled;
+}
+
+void PostProcess::setFxaaEnabled(bool enabled) {
+    _fxaaEnabled = enabled;
+}
+
+bool PostProcess::isBloomEnabled() const {
+    return _bloomEnabled;
+}
+
+bool PostProcess::isFxaaEnabled() const {
+    return _fxaaEnabled;
+}
+
+void PostProcess::emissiveColor(const Vector3f& color, float emission) {
+    glColor4f(color.x, color.y, color.z, 1.0f - emission);
+}
+
+void PostProcess::setRenderScale(float scale) {
+    _renderScale = std::min(std::max(scale, Config::RENDER_SCALE_MIN), 1.0f);
+}
+
+float PostProcess::getRenderScale() const {
+    return _active ? _renderScale : 1.0f;
+}
+
+/** @brief O tamanho, em pixels, do canto da textura da cena em que a cena é desenhada. */
+void PostProcess::getRenderSize(int& width, int& height) const {
+    width = std::max(1, static_cast<int>(_scene.width * _renderScale + 0.5f));
+    height = std::max(1, static_cast<int>(_scene.height * _renderScale + 0.5f));
+}
+
+bool PostProcess::isBloomActive() {
+    return _bloomFrame;
+}
+
+bool PostProcess::setBloomActive(bool active) {
+    const bool previous = _bloomFrame;
+    _bloomFrame = active;
+    return previous;
+}
+
+void PostProcess::beginScene() {
+    _bloomFrame = _active && _bloomEnabled;
+    if (!_active) return;
+
+    int width, height;
+    getRenderSize(width, height);
+    GLExtensions::bindFramebuffer(GL_FRAMEBUFFER, _scene.framebuffer);
+    glViewport(0, 0, width, height);
+}
+
+/** @brief Um quadrilátero que cobre o alvo inteiro (os shaders ignoram as matrizes). */
+void PostProcess::drawFullscreenQuad() {
+    glBegin(GL_QUADS);
+    glTexCoord2f(0.0f, 0.0f); glVertex2f(-1.0f, -1.0f);
+    glTexCoord2f(1.0f, 0.0f); glVertex2f( 1.0f, -1.0f);
+    glTexCoord2f(1.0f, 1.0f); glVertex2f( 1.0f,  1.0f);
+    glTexCoord2f(0.0f, 1.0f); glVertex2f(-1.0f,  1.0f);
+    glEnd();
+}
+
+void PostProcess::endScene() {
+    if (!_active) return;
+
+    int width, height;
+    getRenderSize(width, height);
+    const float regionX = static_cast<float>(width) / _scene.width;
+    const float regionY = static_cast<float>(height) / _scene.height;
+
+    // A viewport não é salva: no fim ela fica na tela inteira, para o HUD.
+    glPushAttrib(GL_ENABLE_BIT | GL_DEPTH_BUFFER_BIT);
+    glDisable(GL_DEPTH_TEST);
+    glDepthMask(GL_FALSE);
+    glDisable(GL_LIGHTING);
+    glDisable(GL_CULL_FACE);
+    glDisable(GL_BLEND);
+    glDisable(GL_STENCIL_TEST);
+    glDisable(GL_SCISSOR_TEST);
+    glDisable(GL_CLIP_PLANE0);
+
+    GLExtensions::activeTexture(GL_TEXTURE0);
+    if (_bloomFrame) {
+        // 1. Extração da parte emissiva, já reduzida.
+        GLExtensions::bindFramebuffer(GL_FRAMEBUFFER, _bloom[0].framebuffer);
+        glViewport(0, 0, _bloom[0].width, _bloom[0].height);
+        GLExtensions::useProgram(_brightProgram);
+        GLExtensions::uniform1i(GLExtensions::getUniformLocation(_brightProgram, "scene"), 0);
+        GLExtensions::uniform2f(GLExtensions::getUniformLocation(_brightProgram, "texel"),
+                                1.0f / _scene.width, 1.0f / _scene.height);
+        GLExtensions::uniform2f(GLExtensions::getUniformLocation(_brightProgram, "region"), regionX, regionY);
+        glBindTexture(GL_TEXTURE_2D, _scene.texture);
+        drawFullscreenQuad();
+
+        // 2. Desfoque separável, ida e volta entre as duas texturas.
+        GLExtensions::useProgram(_blurProgram);
+        GLExtensions::uniform1i(GLExtensions::getUniformLocation(_blurProgram, "source"), 0);
+        const GLint direction = GLExtensions::getUniformLocation(_blurProgram, "direction");
+        for (int pass = 0; pass < Config::BLOOM_BLUR_PASSES; ++pass) {
+            GLExtensions::bindFramebuffer(GL_FRAMEBUFFER, _bloom[1].framebuffer);
+            GLExtensions::uniform2f(direction, 1.0f / _bloom[0].width, 0.0f);
+            glBindTexture(GL_TEXTURE_2D, _bloom[0].texture);
+            drawFullscreenQuad();
+
+            GLExtensions::bindFramebuffer(GL_FRAMEBUFFER, _bloom[0].framebuffer);
+            GLExtensions::uniform2f(direction, 0.0f, 1.0f / _bloom[0].height);
+            glBindTexture(GL_TEXTURE_2D, _bloom[1].texture);
+            drawFullscreenQuad();
+        }
+    }
+
+    // 3. Composição na tela.
+    GLExtensions::bindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, Config::SCREEN_WIDTH, Config::SCREEN_HEIGHT);
+    GLExtensions::useProgram(_compositeProgram);
+    GLExtensions::uniform1i(GLExtensions::getUniformLocation(_compositeProgram, "scene"), 0);
+    GLExtensions::uniform1i(GLExtensions::getUniformLocation(_compositeProgram, "bloom"), 1);
+    GLExtensions::uniform2f(GLExtensions::getUniformLocation(_compositeProgram, "texel"),
+                            1.0f / _scene.width, 1.0f / _scene.height);
+    GLExtensions::uniform2f(GLExtensions::getUniformLocation(_compositeProgram, "region"), regionX, regionY);
+    GLExtensions::uniform1f(GLExtensions::getUniformLocation(_compositeProgram, "sharpen"),
+                            _renderScale < 1.0f ? Config::RENDER_SHARPEN : 0.0f);
+    GLExtensions::uniform1f(GLExtensions::getUniformLocation(_compositeProgram, "bloomStrength"),
+                            _bloomFrame ? Config::BLOOM_STRENGTH : 0.0f);
+    GLExtensions::uniform1f(GLExtensions::getUniformLocation(_compositeProgram, "fxaa"), _fxaaEnabled ? 1.0f : 0.0f);
+    GLExtensions::activeTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, _bloom[0].texture);
+    GLExtensions::activeTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, _scene.texture);
+    drawFullscreenQuad();
+
+    GLExtensions::useProgram(0);
+    GLExtensions::activeTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    GLExtensions::activeTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glPopAttrib();
+
+    _bloomFrame = false;
+}
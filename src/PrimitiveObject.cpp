@@ -4,7 +4,10 @@
  */
 
 #include "../include/PrimitiveObject.h"
+#include "../include/MeshManager.h"
+#include "../include/ModelManager.h"
 #include <GL/freeglut.h>
+#include <algorithm>
 
 /**
  * @brief Construtor da classe PrimitiveObject.
@@ -16,12 +19,23 @@
  * @param color A cor RGB do objeto.
  * @param scale O vetor de escala do objeto.
  */
-PrimitiveObject::PrimitiveObject(PrimitiveShape shape, const Vector3f& position, const Vector3f& color, const Vector3f& scale) {
-    _shape = shape;
-    _position = position;
-    _color = color;
-    _scale = scale;
-}
+PrimitiveObject::PrimitiveObject(PrimitiveShape shape, const Vector3f& position, const Vector3f& color, const Vector3f& scale)
+    : _shape(shape), _transform(position, scale), _color(color), _lod(0), _model(-1) {}
+
+/**
+ * @brief Construtor de um objeto com modelo.
+ *
+ * O modelo começa a ser carregado em segundo plano; o objeto aparece quando ele
+ * estiver pronto.
+ *
+ * @param modelFile O arquivo do modelo.
+ * @param position A posição do objeto no espaço 3D.
+ * @param color A cor RGB do objeto.
+ * @param scale O vetor de escala do objeto.
+ */
+PrimitiveObject::PrimitiveObject(const std::string& modelFile, const Vector3f& position, const Vector3f& color, const Vector3f& scale)
+    : _shape(PrimitiveShape::MODEL), _transform(position, scale), _color(color), _lod(0),
+      _model(ModelManager::load(modelFile)) {}
 
 /**
  * @brief Atualiza o estado do objeto primitivo.
@@ -36,30 +50,49 @@ void PrimitiveObject::update(float deltaTime, GameStateManager& gameStateManager
 }
 
 /**
- * @brief Renderiza o objeto primitivo na tela.
+ * @brief Registra o objeto no pacote do quadro com a matriz em cache e a cor atual.
  *
- * Define a cor do objeto, aplica as transformações de translação e escala
- * e desenha a forma geométrica correspondente.
+ * Esferas, cones e toros também escolhem aqui o nível de detalhe, pela distância
+ * até a câmera do quadro.
+ *
+ * @param packet O pacote do quadro sendo montado pela simulação.
  */
-void PrimitiveObject::render() {
-    // A cor é definida usando glColor3f. Como GL_COLOR_MATERIAL está ativo,
-    // a iluminação será calculada com base nesta cor.
-    glColor3f(_color.x, _color.y, _color.z);
+void PrimitiveObject::collectDrawItems(RenderPacket& packet) {
+    DrawItem item(this, _transform);
+    item.color = _color;
 
-    glPushMatrix();
-    glTranslatef(_position.x, _position.y, _position.z);
-    glScalef(_scale.x, _scale.y, _scale.z);
+    if (_shape == PrimitiveShape::SPHERE || _shape == PrimitiveShape::CONE || _shape == PrimitiveShape::TORUS) {
+        const Vector3f& scale = _transform.getScale();
+        float extent = (_shape == PrimitiveShape::TORUS) ? 1.5f : 1.0f; // raio da malha sem escala
+        float radius = extent * std::max(scale.x, std::max(scale.y, scale.z));
+        _lod = MeshManager::selectLod(packet.camera.position, _transform.getWorldPosition(), radius, _lod);
+        item.lod = _lod;
+    }
+    packet.items.push_back(item);
+}
+
+/**
+ * @brief Desenha a forma geométrica em coordenadas locais.
+ *
+ * A cor é definida usando glColor3f. Como GL_COLOR_MATERIAL está ativo,
+ * a iluminação será calculada com base nesta cor. A translação e a escala
+ * já estão na matriz do item.
+ *
+ * @param item O item com a matriz, a cor e o nível de detalhe capturados na simulação.
+ */
+void PrimitiveObject::draw(const DrawItem& item) {
+    glColor3f(item.color.x, item.color.y, item.color.z);
 
     switch (_shape) {
         case PrimitiveShape::SPHERE:
-            glutSolidSphere(1.0, 32, 32);
+            MeshManager::drawSphere(1.0f, item.lod);
             break;
         case PrimitiveShape::CONE:
             glRotatef(-90, 1.0f, 0.0f, 0.0f);
-            glutSolidCone(0.5, 1.0, 32, 32);
+            MeshManager::drawCone(0.5f, 1.0f, item.lod);
             break;
         case PrimitiveShape::TORUS:
-            glutSolidTorus(0.5, 1.0, 32, 32);
+            MeshManager::drawTorus(0.5f, 1.0f, item.lod);
             break;
         case PrimitiveShape::TEAPOT: {
             glutSolidTeapot(1.0f);
@@ -68,17 +101,34 @@ void PrimitiveObject::render() {
         case PrimitiveShape::CUBE:
             glutSolidCube(1.0);
             break;
+        case PrimitiveShape::MODEL:
+            ModelManager::draw(_model);
+            break;
     }
-    glPopMatrix();
 }
 
 /**
  * @brief Obtém a caixa delimitadora (Bounding Box) do objeto primitivo.
  *
- * A implementação atual retorna uma Bounding Box vazia.
+ * Para modelos já carregados, é a caixa do modelo levada ao mundo; para as
+ * demais formas, a implementação atual retorna uma Bounding Box vazia.
  *
- * @return Um objeto BoundingBox vazio.
+ * @return A caixa do modelo, ou um objeto BoundingBox vazio.
  */
 BoundingBox PrimitiveObject::getBoundingBox() const {
-    return {{0,0,0}, {0,0,0}};
+    BoundingBox local;
+    if (_shape != PrimitiveShape::MODEL || !ModelManager::getBounds(_model, local)) {
+        return {{0,0,0}, {0,0,0}};
+    }
+
+    const Matrix4& world = _transform.getWorldMatrix();
+    BoundingBox box = {world.transformPoint(local.min), world.transformPoint(local.min)};
+    for (int corner = 1; corner < 8; ++corner) {
+        const Vector3f p = world.transformPoint({(corner & 1) ? local.max.x : local.min.x,
+                                                 (corner & 2) ? local.max.y : local.min.y,
+                                                 (corner & 4) ? local.max.z : local.min.z});
+        box.min = {std::min(box.min.x, p.x), std::min(box.min.y, p.y), std::min(box.min.z, p.z)};
+        box.max = {std::max(box.max.x, p.x), std::max(box.max.y, p.y), std::max(box.max.z, p.z)};
+    }
+    return box;
 }
@@ -4,6 +4,7 @@
  */
 
 #include "../include/PuzzleDoor.h"
+#include "../include/PostProcess.h"
 #include <GL/freeglut.h>
 #include <cmath>
 #include <algorithm> // Includo para compatibilidade
@@ -16,81 +17,41 @@
  * @struct BlendGuard
  * @brief Uma classe auxiliar para gerenciar temporariamente o estado de blending do OpenGL.
  *
- * O construtor desabilita a iluminao e o teste de profundidade, habilita o blending
- * com uma funo aditiva ("neon") e armazena os estados originais. O destrutor restaura
- * os estados de volta para o que eram antes.
+ * O construtor desabilita a iluminao, habilita o blending com uma funo aditiva
+ * ("neon") e armazena os estados originais. O teste de profundidade continua ligado
+ * (com GL_LEQUAL e sem gravar profundidade, para que as passadas do brilho se somem),
+ * ento o cone fica escondido atrs do que estiver na frente da porta. O destrutor
+ * restaura os estados de volta para o que eram antes.
  */
 struct BlendGuard {
-    GLboolean lighting, depth, blend;
-    GLint src, dst;
+    GLboolean lighting, blend, depthMask;
+    GLint src, dst, depthFunc;
     BlendGuard() {
         lighting = glIsEnabled(GL_LIGHTING);
-        depth    = glIsEnabled(GL_DEPTH_TEST);
         blend    = glIsEnabled(GL_BLEND);
+        glGetBooleanv(GL_DEPTH_WRITEMASK, &depthMask);
+        glGetIntegerv(GL_DEPTH_FUNC, &depthFunc);
         glDisable(GL_LIGHTING);
-        glDisable(GL_DEPTH_TEST);
         glEnable(GL_BLEND);
+        glDepthMask(GL_FALSE);
+        glDepthFunc(GL_LEQUAL);
         glGetIntegerv(GL_BLEND_SRC, &src);
         glGetIntegerv(GL_BLEND_DST, &dst);
         glBlendFunc(GL_SRC_ALPHA, GL_ONE); // aditivo = brilho
     }
     ~BlendGuard() {
         glBlendFunc(src, dst);
+        glDepthFunc(depthFunc);
+        glDepthMask(depthMask);
         if (!blend)  glDisable(GL_BLEND);
-        if (depth)   glEnable(GL_DEPTH_TEST);
         if (lighting) glEnable(GL_LIGHTING);
     }
 };
 
-/**
- * @brief Desenha o corpo principal da porta.
- *
- * A porta  modelada usando cubos slidos para a moldura, a folha e os painis.
- * Tambm  adicionada uma maaneta.
- *
- * @param color A cor base da porta.
- */
-static void drawDoorBody(const Vector3f& color) {
-    const float W = 1.1f;
-    const float H = 2.2f;
-    const float T = 0.10f;
-
-    // moldura
-    glColor3f(color.x*0.9f, color.y*0.9f, color.z*0.9f);
-    glPushMatrix();
-      glScalef(W+0.12f, H+0.12f, T);
-      glutSolidCube(1.0);
-    glPopMatrix();
-
-    // folha
-    glColor3f(color.x, color.y, color.z);
-    glPushMatrix();
-      glScalef(W, H, T*0.6f);
-      glutSolidCube(1.0);
-    glPopMatrix();
-
-    // painis
-    glColor3f(color.x*0.85f, color.y*0.85f, color.z*0.85f);
-    glPushMatrix();
-      glTranslatef(0.0f, 0.45f, T*0.35f);
-      glScalef(W*0.75f, H*0.32f, 0.02f);
-      glutSolidCube(1.0);
-    glPopMatrix();
-
-    glPushMatrix();
-      glTranslatef(0.0f, -0.40f, T*0.35f);
-      glScalef(W*0.78f, H*0.36f, 0.02f);
-      glutSolidCube(1.0);
-    glPopMatrix();
-
-    // maaneta  esquerda
-    glColor3f(0.95f, 0.95f, 0.95f);
-    glPushMatrix();
-      glTranslatef(-W*0.48f, -0.05f, T*0.35f);
-      glScalef(0.06f, 0.30f, 0.06f);
-      glutSolidCube(1.0);
-    glPopMatrix();
-}
+// Dimenses da folha da porta.
+static const float DOOR_WIDTH = 1.1f;
+static const float DOOR_HEIGHT = 2.2f;
+static const float DOOR_THICKNESS = 0.10f;
 
 /**
  * @brief Desenha o cone de onda.
@@ -158,27 +119,39 @@ static void drawIconMountain(float scale) {
 /**
  * @brief Desenha o cone em estilo neon na porta.
  *
- * Utiliza o `BlendGuard` para criar um efeito de brilho aditivo e desenha o cone
- * duas vezes com diferentes opacidades e larguras de linha para simular o brilho.
+ * Com o ps-processamento ativo, o cone  desenhado uma vez como emissivo e o
+ * bloom faz o brilho. Sem ele, utiliza o `BlendGuard` para criar um efeito de
+ * brilho aditivo e desenha o cone duas vezes com diferentes opacidades e larguras
+ * de linha para simular o brilho.
  *
  * @param icon O tipo de cone a ser desenhado.
  * @param glow A cor do brilho.
- * @param zOffset O deslocamento no eixo Z para o cone.
  */
-static void drawIconNeon(PuzzleDoor::Icon icon, const Vector3f& glow, float zOffset) {
+static void drawIconNeon(PuzzleDoor::Icon icon, const Vector3f& glow) {
+    auto drawIcon = [icon](float scale) {
+        switch (icon) {
+          case PuzzleDoor::Icon::Wave:     drawIconWave(scale);     break;
+          case PuzzleDoor::Icon::Sun:      drawIconSun(scale);      break;
+          case PuzzleDoor::Icon::Mountain: drawIconMountain(scale); break;
+          default: break;
+        }
+    };
+
+    if (PostProcess::isBloomActive()) {
+        glPushAttrib(GL_DEPTH_BUFFER_BIT);
+        glDepthFunc(GL_LEQUAL); // o corpo da porta  empurrado para trs com glPolygonOffset
+        PostProcess::emissiveColor(glow, 1.0f);
+        glLineWidth(2.5f);
+        drawIcon(1.0f);
+        glPopAttrib();
+        return;
+    }
+
     BlendGuard guard;
     auto draw = [&](float scale, float alpha, float lineWidth){
         glColor4f(glow.x, glow.y, glow.z, alpha);
         glLineWidth(lineWidth);
-        glPushMatrix();
-          glTranslatef(0.0f, 0.15f, zOffset);
-          switch (icon) {
-            case PuzzleDoor::Icon::Wave:     drawIconWave(scale);     break;
-            case PuzzleDoor::Icon::Sun:      drawIconSun(scale);      break;
-            case PuzzleDoor::Icon::Mountain: drawIconMountain(scale); break;
-            default: break;
-          }
-        glPopMatrix();
+        drawIcon(scale);
     };
     draw(1.0f, 0.18f, 8.0f);
     draw(1.0f, 0.90f, 2.5f);
@@ -209,32 +182,96 @@ PuzzleDoor::PuzzleDoor(const Vector3f& position,
                        Icon icon,
                        const Vector3f& iconGlow)
     : Door(position, targetRoomIndex, spawnPosition),
-      _doorColor(doorColor),
-      _iconGlow(iconGlow),
-      _icon(icon)
+      _icon(icon),
+      _root(position),
+      _impostor({{-DOOR_WIDTH * 0.5f - 0.10f, -DOOR_HEIGHT * 0.5f - 0.10f, -DOOR_THICKNESS * 0.5f - 0.01f},
+                 { DOOR_WIDTH * 0.5f + 0.10f,  DOOR_HEIGHT * 0.5f + 0.10f,  DOOR_THICKNESS * 0.35f + 0.05f}})
 {
-    // O construtor da classe base j fez todo o trabalho de inicializao
-    // de posio, raio de coliso, etc. O corpo pode ficar vazio.
+    // Peas em coordenadas locais da porta: cubos unitrios transladados e escalados.
+    const float T = DOOR_THICKNESS;
+    _parts[FRAME]        = Transform({0.0f, 0.0f, 0.0f}, {DOOR_WIDTH + 0.12f, DOOR_HEIGHT + 0.12f, T});
+    _parts[LEAF]         = Transform({0.0f, 0.0f, 0.0f}, {DOOR_WIDTH, DOOR_HEIGHT, T * 0.6f});
+    _parts[PANEL_TOP]    = Transform({0.0f, 0.45f, T * 0.35f}, {DOOR_WIDTH * 0.75f, DOOR_HEIGHT * 0.32f, 0.02f});
+    _parts[PANEL_BOTTOM] = Transform({0.0f, -0.40f, T * 0.35f}, {DOOR_WIDTH * 0.78f, DOOR_HEIGHT * 0.36f, 0.02f});
+    _parts[HANDLE]       = Transform({-DOOR_WIDTH * 0.48f, -0.05f, T * 0.35f}, {0.06f, 0.30f, 0.06f}); // maaneta  esquerda
+    _parts[ICON]         = Transform({0.0f, 0.15f, T * 0.5f + 0.005f}); // logo  frente da moldura
+    for (int part = 0; part < PART_COUNT; ++part) {
+        _parts[part].setParent(&_root);
+        _partLocal[part] = _parts[part].getLocalMatrix();
+    }
+
+    const Vector3f& c = doorColor;
+    _partColors[FRAME]        = {c.x * 0.9f, c.y * 0.9f, c.z * 0.9f};
+    _partColors[LEAF]         = c;
+    _partColors[PANEL_TOP]    = {c.x * 0.85f, c.y * 0.85f, c.z * 0.85f};
+    _partColors[PANEL_BOTTOM] = _partColors[PANEL_TOP];
+    _partColors[HANDLE]       = {0.95f, 0.95f, 0.95f};
+    _partColors[ICON]         = iconGlow;
 }
 
 /**
- * @brief Renderiza a porta na tela, incluindo o corpo e o cone.
+ * @brief Registra cada pea da porta como um item do pacote.
+ *
+ * As matrizes das peas so calculadas uma vez (a porta no se move) e depois
+ * apenas copiadas a cada quadro. De longe, a porta inteira  um nico item (o impostor).
  *
- * O mtodo desabilita a iluminao e armazena os atributos atuais do OpenGL
- * antes de desenhar o corpo da porta e o cone, restaurando-os no final.
+ * @param packet O pacote do quadro sendo montado pela simulao.
  */
-void PuzzleDoor::render() {
-    glPushAttrib(GL_LIGHTING_BIT | GL_ENABLE_BIT | GL_CURRENT_BIT);
+void PuzzleDoor::collectDrawItems(RenderPacket& packet) {
+    if (_impostor.select(packet.camera.position, _root.getWorldPosition())) {
+        packet.items.push_back(DrawItem(this, _root, IMPOSTOR));
+        return;
+    }
+
+    for (int part = 0; part < PART_COUNT; ++part) {
+        if (part == ICON && _icon == Icon::None) continue;
+        DrawItem item(this, _parts[part], part);
+        item.color = _partColors[part];
+        if (part == ICON) item.layer = DrawLayer::Overlay; // brilho somado por cima do corpo
+        packet.items.push_back(item);
+    }
+}
+
+/**
+ * @brief Desenha uma pea da porta, sem iluminao.
+ *
+ * As peas do corpo so cubos unitrios (a forma vem da matriz do item); o cone
+ *  desenhado em estilo neon.
+ *
+ * @param item O item com a pea, a matriz e a cor.
+ */
+void PuzzleDoor::draw(const DrawItem& item) {
+    if (item.part == IMPOSTOR) {
+        _impostor.draw([this](const Matrix4& view) { drawParts(view); });
+        return;
+    }
+
+    glPushAttrib(GL_LIGHTING_BIT | GL_ENABLE_BIT | GL_CURRENT_BIT | GL_POLYGON_BIT);
     glDisable(GL_LIGHTING);
-    glPushMatrix();
-      // Usa a funo getPosition() herdada de Door/InteractableObject
-      glTranslatef(getPosition().x, getPosition().y, getPosition().z);
-      drawDoorBody(_doorColor);
-
-      if (_icon != Icon::None) {
-          const float T = 0.10f;
-          drawIconNeon(_icon, _iconGlow, T * 0.49f);
-      }
-    glPopMatrix();
+    if (item.part == ICON) {
+        drawIconNeon(_icon, item.color);
+    } else {
+        // Um pouco mais fundo no depth buffer, para o cone no brigar com a moldura.
+        glEnable(GL_POLYGON_OFFSET_FILL);
+        glPolygonOffset(1.0f, 1.0f);
+        glColor3f(item.color.x, item.color.y, item.color.z);
+        glutSolidCube(1.0);
+    }
     glPopAttrib();
 }
+
+/**
+ * @brief Desenha todas as peas em coordenadas locais da porta (a foto do impostor).
+ * @param view Leva as coordenadas locais da porta para as da cmera.
+ */
+void PuzzleDoor::drawParts(const Matrix4& view) {
+    for (int part = 0; part < PART_COUNT; ++part) {
+        if (part == ICON && _icon == Icon::None) continue;
+        DrawItem item(this);
+        item.transform = _partLocal[part];
+        item.color = _partColors[part];
+        item.part = part;
+        glLoadMatrixf((view * _partLocal[part]).m);
+        draw(item);
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * @file QualityGovernor.cpp
+ * @brief Implementação do QualityGovernor: janela de tempos, decisões e log.
+ */
+
+#include "../include/QualityGovernor.h"
+#include "../include/Config.h"
+#include <fstream>
+#include <iostream>
+
+std::vector<QualityGovernor::Knob> QualityGovernor::_knobs;
+std::vector<float> QualityGovernor::_window;
+size_t QualityGovernor::_next = 0;
+size_t QualityGovernor::_count = 0;
+unsigned long QualityGovernor::_frame = 0;
+
+void QualityGovernor::registerKnob(const std::string& name, int tierCount, ApplyFunction apply) {
+    if (tierCount < 1) return;
+    _knobs.push_back({name, tierCount, tierCount - 1, apply});
+    apply(tierCount - 1);
+}
+
+bool QualityGovernor::addFrame(float frameMs, bool allowDown, bool allowUp) {
+    ++_frame;
+    if (_knobs.empty()) return false;
+
+    const size_t window = static_cast<size_t>(Config::QUALITY_WINDOW);
+    if (_window.size() != window) _window.assign(window, 0.0f);
+    _window[_next] = frameMs;
+    _next = (_next + 1) % window;
+    if (_count < window) ++_count;
+    if (_count < window) return false;
+
+    float sum = 0.0f;
+    for (float ms : _window) sum += ms;
+    const float average = sum / window;
+
+    const float budget = Config::FRAME_BUDGET_MS;
+    int direction = 0;
+    if (allowDown && average > budget * (1.0f + Config::QUALITY_DOWN_MARGIN)) direction = -1;
+    else if (allowUp && average < budget * (1.0f - Config::QUALITY_UP_MARGIN)) direction = 1;
+    if (direction == 0 || !step(direction, average)) return false;
+
+    // A janela volta a encher com a qualidade nova antes da próxima decisão.
+    _count = 0;
+    _next = 0;
+    return true;
+}
+
+/**
+ * @brief Move um degrau do botão mais alto (direction = -1) ou do mais baixo (+1),
+ * comparando a fração do caminho de cada um até o degrau máximo.
+ * @return false se todos os botões já estiverem no limite.
+ */
+bool QualityGovernor::step(int direction, float averageMs) {
+    Knob* chosen = nullptr;
+    float chosenLevel = 0.0f;
+    for (Knob& knob : _knobs) {
+        const int target = knob.tier + direction;
+        if (target < 0 || target >= knob.tierCount) continue;
+
+        const float level = knob.tierCount > 1 ? static_cast<float>(knob.tier) / (knob.tierCount - 1) : 1.0f;
+        const bool better = direction < 0 ? level > chosenLevel : level <= chosenLevel;
+        if (!chosen || better) {
+            chosen = &knob;
+            chosenLevel = level;
+        }
+    }
+    if (!chosen) return false;
+
+    const int from = chosen->tier;
+    chosen->tier += direction;
+    chosen->apply(chosen->tier);
+    log(*chosen, from, averageMs);
+    return true;
+}
+
+/** @brief Mostra a decisão e a acrescenta ao CSV (quadro, média, botão, degrau anterior, novo). */
+void QualityGovernor::log(const Knob& knob, int from, float averageMs) {
+    std::cout << "[Qualidade] " << averageMs << " ms por quadro: " << knob.name << " " << from << " -> " << knob.tier << "\n";
+
+    std::ofstream file(Config::QUALITY_LOG_FILE, std::ios::app);
+    if (file) {
+        file << _frame << ',' << averageMs << ',' << knob.name << ',' << from << ',' << knob.tier << '\n';
+    }
+}
+
+int QualityGovernor::getTier(const std::string& name) {
+    for (const Knob& knob : _knobs) {
+        if (knob.name == name) return knob.tier;
+    }
+    return -1;
+}
+
+void QualityGovernor::clear() {
+    _knobs.clear();
+    _window.clear();
+    _next = 0;
+    _count = 0;
+}
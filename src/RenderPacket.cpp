@@ -0,0 +1,130 @@
+/**
+ * @file RenderPacket.cpp
+ * @brief Implementação dos auxiliares de DrawItem e RenderPacket.
+ */
+
+#include "../include/RenderPacket.h"
+#include "../include/Hash.h"
+#include <algorithm>
+
+/**
+ * @brief Cria um item para o objeto informado, com matriz identidade e cor branca.
+ * @param obj O objeto que desenhará o item.
+ */
+DrawItem::DrawItem(GameObject* obj)
+    : object(obj), transform(Matrix4::identity()), color{1.0f, 1.0f, 1.0f}, part(0), lod(0), layer(DrawLayer::Opaque) {}
+
+/**
+ * @brief Cria um item com a matriz de mundo de um Transform e cor branca.
+ * @param obj O objeto que desenhará o item.
+ * @param objectTransform A transformação do objeto ou da peça.
+ * @param part A peça do objeto.
+ */
+DrawItem::DrawItem(GameObject* obj, const Transform& objectTransform, int part)
+    : object(obj), transform(objectTransform.getWorldMatrix()), color{1.0f, 1.0f, 1.0f}, part(part), lod(0),
+      layer(DrawLayer::Opaque) {}
+
+/**
+ * @brief Esvazia as listas do pacote sem liberar sua memória.
+ */
+void RenderPacket::clear() {
+    items.clear();
+    roomItemCount = 0;
+    depthPrepass = false;
+    portals.clear();
+    debugLines.clear();
+    debugTexts.clear();
+    hud.keypadInput.clear();
+    hud.inventory.clear();
+}
+
+/**
+ * @brief Calcula o resumo do pacote.
+ *
+ * Os campos são lidos um a um (e não a struct inteira) para que bytes de
+ * preenchimento não entrem no resumo.
+ */
+uint64_t RenderPacket::signature() const {
+    uint64_t hash = FNV1A_OFFSET;
+    hash = fnv1a(&camera.position, sizeof(Vector3f), hash);
+    hash = fnv1a(&camera.front, sizeof(Vector3f), hash);
+    hash = fnv1a(&camera.up, sizeof(Vector3f), hash);
+    hash = fnv1a(&flashlight.position, sizeof(Vector3f), hash);
+    hash = fnv1a(&flashlight.direction, sizeof(Vector3f), hash);
+    hash = fnv1a(&flashlight.color, sizeof(Vector3f), hash);
+
+    for (const DrawItem& item : items) {
+        hash = fnv1a(&item.object, sizeof(item.object), hash);
+        hash = fnv1a(item.transform.m, sizeof(item.transform.m), hash);
+        hash = fnv1a(&item.color, sizeof(Vector3f), hash);
+        hash = fnv1a(&item.part, sizeof(item.part), hash);
+        hash = fnv1a(&item.lod, sizeof(item.lod), hash);
+        hash = fnv1a(&item.layer, sizeof(item.layer), hash);
+    }
+    hash = fnv1a(&roomItemCount, sizeof(roomItemCount), hash);
+    hash = fnv1a(&depthPrepass, sizeof(depthPrepass), hash);
+
+    for (const PortalView& portal : portals) {
+        hash = fnv1a(&portal.parent, sizeof(portal.parent), hash);
+        hash = fnv1a(&portal.firstItem, sizeof(portal.firstItem), hash);
+        hash = fnv1a(&portal.itemCount, sizeof(portal.itemCount), hash);
+        hash = fnv1a(portal.scissor, sizeof(portal.scissor), hash);
+        hash = fnv1a(portal.offset.m, sizeof(portal.offset.m), hash);
+    }
+
+    hash = fnv1a(&hud.keypadActive, sizeof(hud.keypadActive), hash);
+    hash = fnv1a(hud.keypadInput.data(), hud.keypadInput.size(), hash);
+    const size_t inventorySize = hud.inventory.size();
+    hash = fnv1a(&inventorySize, sizeof(inventorySize), hash);
+    if (!hud.inventory.empty()) {
+        hash = fnv1a(hud.inventory.data(), hud.inventory.size() * sizeof(ItemType), hash);
+    }
+    hash = fnv1a(&gameState, sizeof(gameState), hash);
+    return hash;
+}
+
+/**
+ * @brief Ordena um trecho dos itens para desenho.
+ *
+ * Ordena as chaves (camada, profundidade, posição) e depois move os itens para
+ * a nova ordem seguindo os ciclos da permutação, sem vetores temporários. A
+ * posição na chave deixa a ordem estável: itens Enclosing e Overlay mantêm a
+ * ordem em que foram registrados.
+ */
+void RenderPacket::sortFrontToBack(size_t first, const Vector3f& eye, const Vector3f& front) {
+    const size_t count = items.size() - first;
+    sortKeys.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        const DrawItem& item = items[first + i];
+        const float* m = item.transform.m;
+        DrawSortKey& key = sortKeys[i];
+        key.layer = item.layer;
+        key.depth = item.layer == DrawLayer::Opaque
+            ? (m[12] - eye.x) * front.x + (m[13] - eye.y) * front.y + (m[14] - eye.z) * front.z
+            : 0.0f;
+        key.index = static_cast<uint32_t>(i);
+    }
+    std::sort(sortKeys.begin(), sortKeys.end(), [](const DrawSortKey& a, const DrawSortKey& b) {
+        if (a.layer != b.layer) return a.layer < b.layer;
+        if (a.depth != b.depth) return a.depth < b.depth;
+        return a.index < b.index;
+    });
+
+    // A posição i recebe o item que estava em sortKeys[i].index. Cada ciclo é
+    // percorrido uma vez; as posições já resolvidas ficam com index == i.
+    for (size_t i = 0; i < count; ++i) {
+        if (sortKeys[i].index == i) continue;
+        DrawItem held = items[first + i];
+        size_t j = i;
+        for (;;) {
+            const size_t source = sortKeys[j].index;
+            sortKeys[j].index = static_cast<uint32_t>(j);
+            if (source == i) {
+                items[first + j] = held;
+                break;
+            }
+            items[first + j] = items[first + source];
+            j = source;
+        }
+    }
+}
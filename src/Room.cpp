@@ -4,16 +4,25 @@
  */
 #include "../include/Room.h"
 #include "../include/InteractableObject.h"
+#include "../include/Wall.h"
+#include "../include/Door.h"
+#include "../include/MazeLevel.h"
+#include "../include/Floor.h"
+#include "../include/JobSystem.h"
+#include "../include/Config.h"
 #include <algorithm>
 
 /**
  * @brief Construtor da classe Room.
  *
- * O construtor  inicializado sem aes. No futuro, ele poderia
- * ser expandido para receber um identificador ou nome para a sala.
+ * Liga o mundo fsico da sala ao conjunto de caixas estticas e registra o
+ * jogador no sistema de gatilhos. No futuro, ele
+ * poderia ser expandido para receber um identificador ou nome para a sala.
  */
 Room::Room() {
-    // O construtor est vazio por enquanto.
+    // As paredes adicionadas depois tambm passam a valer para a fsica.
+    _physics.setStaticColliders(&_staticColliders);
+    _playerHandle = _triggers.addTracked(nullptr);
 }
 
 /**
@@ -38,7 +47,12 @@ Room::~Room() {
  *
  * O objeto  adicionado ao vetor principal de objetos. Se o objeto for
  * interativo (uma subclasse de `InteractableObject`), ele tambm 
- * adicionado a um vetor separado para fcil acesso.
+ * adicionado a um vetor separado para fcil acesso. Paredes, que no se
+ * movem, tm a sua caixa de coliso guardada no conjunto esttico da sala e
+ * so desenhadas pelo lote esttico (StaticBatch); um labirinto (MazeLevel)
+ * contribui com as caixas das suas paredes, mas desenha a si mesmo; e
+ * objetos com corpo rgido so registrados no mundo fsico e rastreados pelos
+ * gatilhos. Objetos que possuem um volume de gatilho tm o volume registrado.
  *
  * @param object Um ponteiro para o objeto a ser adicionado.
  */
@@ -52,35 +66,127 @@ void Room::addObject(GameObject* object) {
             // Se a converso deu certo, adiciona na lista de interativos
             _interactables.push_back(interactable);
         }
+
+        Door* door = dynamic_cast<Door*>(object);
+        if (door) {
+            _doors.push_back(door);
+        }
+
+        Wall* wall = dynamic_cast<Wall*>(object);
+        if (wall) {
+            _staticColliders.push_back(wall->getBoundingBox());
+            _staticBatch.addWall(wall);
+        } else {
+            _drawObjects.push_back(object);
+        }
+
+        Floor* floor = dynamic_cast<Floor*>(object);
+        if (floor) {
+            _floors.push_back(floor);
+        }
+
+        MazeLevel* maze = dynamic_cast<MazeLevel*>(object);
+        if (maze) {
+            _staticColliders.insert(_staticColliders.end(), maze->getColliders().begin(), maze->getColliders().end());
+        }
+
+        RigidBody* body = object->getRigidBody();
+        if (body) {
+            _physics.addBody(body);
+            _trackedBodies.push_back(std::make_pair(body, _triggers.addTracked(object)));
+        }
+
+        TriggerListener* listener = dynamic_cast<TriggerListener*>(object);
+        if (listener) {
+            _triggers.addTrigger(listener->getTriggerVolume(), listener);
+        }
+    }
+}
+
+/**
+ * @brief Calcula o lightmap da sala.
+ *
+ * As superfcies so as paredes do lote esttico e os blocos do cho; a luz 
+ * bloqueada pelas caixas das paredes (as mesmas da coliso) e pela placa do cho.
+ *
+ * @param cacheFile O arquivo do cache do lightmap.
+ */
+void Room::bakeLighting(const std::string& cacheFile) {
+    std::vector<BakeSurface> surfaces;
+    _staticBatch.collectBakeSurfaces(surfaces);
+    for (Floor* floor : _floors) {
+        floor->collectBakeSurfaces(surfaces);
+    }
+    if (surfaces.empty()) return;
+
+    std::vector<BoundingBox> occluders = _staticColliders;
+    for (Floor* floor : _floors) {
+        occluders.push_back(floor->getOccluderBox());
+    }
+
+    LightBaker::bake(surfaces, occluders, _bakedLights, cacheFile, _lightmap);
+    if (_lightmap.isEmpty()) return;
+
+    _staticBatch.setLightmap(&_lightmap);
+    for (Floor* floor : _floors) {
+        floor->setLightmap(&_lightmap);
     }
 }
 
 /**
  * @brief Atualiza o estado de todos os objetos na sala.
  *
- * Este mtodo delega a chamada de `update` para cada `GameObject` na sala,
- * permitindo que a lgica de cada objeto seja processada a cada quadro.
+ * Primeiro a fsica da sala avana (sem custo se todos os corpos estiverem
+ * dormindo) e os gatilhos recebem os eventos dos corpos que se moveram.
+ * Depois, a atualizao dos objetos acontece em duas fases:
+ * 1. `update` de cada objeto, distribudo em blocos pelo JobSystem. Nesta fase
+ *    cada objeto s altera a si mesmo.
+ * 2. `commit` de cada objeto, em srie, na ordem de insero. Efeitos entre
+ *    objetos (como as jogadas do CubePuzzle) e escritas no GameStateManager
+ *    acontecem aqui, sem disputa entre threads.
  *
  * @param deltaTime O tempo decorrido desde o ltimo quadro.
  * @param gameStateManager O gerenciador de estado do jogo.
  */
 void Room::update(float deltaTime, GameStateManager& gameStateManager) {
-    // Delega a chamada de 'update' para cada objeto na sala.
+    _physics.step(deltaTime);
+
+    // Corpos dormindo no se moveram; s os acordados ou desativados so informados.
+    for (const auto& tracked : _trackedBodies) {
+        const RigidBody* body = tracked.first;
+        if (!body->enabled) _triggers.disableTracked(tracked.second);
+        else if (!body->asleep) _triggers.moveTracked(tracked.second, body->getBounds());
+    }
+    _triggers.dispatch(gameStateManager);
+
+    // Fase 1: atualizao independente, em paralelo.
+    JobSystem::parallelFor(_objects.size(), Config::ROOM_UPDATE_BATCH, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            _objects[i]->update(deltaTime, gameStateManager);
+        }
+    });
+
+    // Fase 2: efeitos entre objetos, em srie.
     for (GameObject* obj : _objects) {
-        obj->update(deltaTime, gameStateManager);
+        obj->commit(gameStateManager);
     }
 }
 
 /**
- * @brief Renderiza todos os objetos na sala.
+ * @brief Registra no pacote do quadro os itens de desenho de todos os objetos.
+ *
+ * Delega a chamada de `collectDrawItems` para cada `GameObject`, exceto as
+ * paredes, que entram como um nico item do lote esttico. O desenho em si
+ * acontece depois, na thread de OpenGL, a partir do pacote.
  *
- * Delega a chamada de `render` para cada `GameObject`, permitindo que
- * cada objeto desenhe a si mesmo na cena.
+ * @param packet O pacote sendo montado pela simulao.
  */
-void Room::render() {
-    // Delega a chamada de 'render' para cada objeto na sala.
-    for (GameObject* obj : _objects) {
-        obj->render();
+void Room::collectDrawItems(RenderPacket& packet) {
+    if (!_staticBatch.isEmpty()) {
+        _staticBatch.collectDrawItems(packet);
+    }
+    for (GameObject* obj : _drawObjects) {
+        obj->collectDrawItems(packet);
     }
 }
 
@@ -97,3 +203,32 @@ std::vector<InteractableObject*>& Room::getInteractableObjects() {
  * @return Uma referncia constante para o vetor de todos os objetos.
  */
 const std::vector<GameObject*>& Room::getObjects() const { return _objects; }
+
+/**
+ * @brief Obtm as portas da sala.
+ * @return Uma referncia constante para o vetor de portas.
+ */
+const std::vector<Door*>& Room::getDoors() const { return _doors; }
+
+/**
+ * @brief Obtm as caixas de coliso estticas da sala.
+ * @return Uma referncia constante para o vetor de caixas.
+ */
+const std::vector<BoundingBox>& Room::getStaticColliders() const { return _staticColliders; }
+
+/**
+ * @brief Obtm o mundo fsico da sala.
+ * @return Uma referncia para o PhysicsWorld da sala.
+ */
+PhysicsWorld& Room::getPhysics() { return _physics; }
+
+/**
+ * @brief Informa a caixa atual do jogador aos gatilhos da sala.
+ * @param bounds A caixa do jogador.
+ */
+void Room::trackPlayer(const BoundingBox& bounds) { _triggers.moveTracked(_playerHandle, bounds); }
+
+/**
+ * @brief Retira o jogador de todos os volumes de gatilho da sala.
+ */
+void Room::untrackPlayer() { _triggers.disableTracked(_playerHandle); }
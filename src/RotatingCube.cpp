@@ -5,16 +5,16 @@
 
 #include "../include/RotatingCube.h"
 #include "../include/CubePuzzle.h"
-#include <random>
+#include "../include/AnimationSystem.h"
+#include "../include/Config.h"
 #include <GL/freeglut.h>
-#include <cmath>
 
 /**
  * @brief Construtor da classe RotatingCube.
  *
  * Inicializa um cubo com uma posição, tamanho, coordenadas de linha/coluna e
- * uma referência ao gerenciador do quebra-cabeça. O estado de rotação inicial
- * é definido de forma aleatória.
+ * uma referência ao gerenciador do quebra-cabeça. O cubo começa no estado 0;
+ * o embaralhamento é feito pelo CubePuzzle, que garante um tabuleiro com solução.
  *
  * @param position A posição do cubo no espaço 3D.
  * @param size O tamanho do cubo.
@@ -27,50 +27,59 @@
 RotatingCube::RotatingCube(const Vector3f& position, float size, int row, int col, CubePuzzle* puzzleManager)
     : InteractableObject(position), _size(size), _row(row), _col(col), _puzzleManager(puzzleManager) {
 
-    _rotationState = rand() % 4 * 90.0f; // Estado inicial aleatório
-    _currentAngle = _rotationState;
-    _targetAngle = _currentAngle;
+    _rotationState = 0;
+    _currentAngle = 0.0f;
+    _targetAngle = 0.0f;
     _currentPosition = position;
     _targetPosition = position;
+    _transform = Transform(position, {size, size, size});
+    _animations = nullptr;
 }
 
 
+/**
+ * @brief Destrutor: interrompe as animações que apontam para este cubo.
+ */
+RotatingCube::~RotatingCube() {
+    if (_animations) {
+        _animations->cancel(&_currentAngle);
+        _animations->cancel(&_currentPosition);
+    }
+}
+
 /**
  * @brief Atualiza o estado do cubo a cada quadro.
  *
- * Anima a rotação e o movimento do cubo de forma suave. A rotação
- * utiliza interpolação linear para se mover em direção ao ângulo alvo.
+ * Não há nada a fazer: a rotação e o movimento são animados pelo AnimationSystem,
+ * então um cubo parado não custa nada.
  *
  * @param deltaTime O tempo decorrido desde o último quadro.
  * @param gameStateManager O gerenciador de estado do jogo (não utilizado diretamente aqui).
  */
-void RotatingCube::update(float deltaTime, GameStateManager&) {
-    // Animação suave de rotação
-    if (std::abs(_currentAngle - _targetAngle) > 0.1f) {
-        float diff = _targetAngle - _currentAngle;
-        _currentAngle += diff * std::min(1.0f, deltaTime * 10.0f);
-    } else {
-        _currentAngle = _targetAngle;
-    }
-    // Animação suave de movimento (LERP)
-    float speed = 5.0f;
-    _currentPosition.x += (_targetPosition.x - _currentPosition.x) * std::min(1.0f, deltaTime * speed);
-    _currentPosition.y += (_targetPosition.y - _currentPosition.y) * std::min(1.0f, deltaTime * speed);
-    _currentPosition.z += (_targetPosition.z - _currentPosition.z) * std::min(1.0f, deltaTime * speed);
-}
+void RotatingCube::update(float deltaTime, GameStateManager&) {}
 
 /**
- * @brief Renderiza o cubo na tela.
+ * @brief Copia para o pacote do quadro a posição e o ângulo atuais da animação.
+ *
+ * A matriz só é recalculada enquanto o cubo estiver girando ou se movendo.
  *
- * O método define as cores de cada face (uma face especial e as outras normais),
- * aplica as transformações de translação e rotação e desenha o cubo com `GL_QUADS`.
+ * @param packet O pacote do quadro sendo montado pela simulação.
  */
-void RotatingCube::render() {
-    glPushMatrix();
-    glTranslatef(_currentPosition.x, _currentPosition.y, _currentPosition.z);
-    glRotatef(_currentAngle, 0, 1, 0);
-    glScalef(_size, _size, _size);
+void RotatingCube::collectDrawItems(RenderPacket& packet) {
+    _transform.setPosition(_currentPosition);
+    _transform.setRotationY(_currentAngle);
+    packet.items.push_back(DrawItem(this, _transform));
+}
 
+/**
+ * @brief Desenha o cubo a partir de um item do pacote.
+ *
+ * O método define as cores de cada face (uma face especial e as outras normais)
+ * e desenha o cubo unitário com `GL_QUADS` (a escala já está na matriz do item).
+ *
+ * @param item O item com a transformação capturada na simulação.
+ */
+void RotatingCube::draw(const DrawItem& item) {
     // Define as cores para as faces
     Vector3f corEspecial = {1.0f, 1.0f, 0.0f};
     Vector3f corNormal = {0.4f, 0.4f, 0.4f};
@@ -100,7 +109,6 @@ void RotatingCube::render() {
     glVertex3f(-0.5f, -0.5f, -0.5f); glVertex3f(-0.5f, -0.5f,  0.5f); glVertex3f(-0.5f,  0.5f,  0.5f); glVertex3f(-0.5f,  0.5f, -0.5f);
 
     glEnd();
-    glPopMatrix();
 }
 
 /**
@@ -122,11 +130,47 @@ void RotatingCube::onClick(GameStateManager&) {
  * @brief Inicia a rotação do cubo.
  *
  * Altera o estado de rotação do cubo e define um novo ângulo alvo para a animação.
+ * O ângulo alvo só cresce, para que a volta de 270° para 0° também gire 90° para
+ * frente em vez de desfazer três quartos de volta.
+ *
+ * @param animations O sistema que anima a rotação; com nullptr, o cubo gira na hora.
  */
-void RotatingCube::rotate() {
+void RotatingCube::rotate(AnimationSystem* animations) {
     _rotationState = (_rotationState + 1) % 4;
-    _targetAngle = _rotationState * 90.0f;
+    _targetAngle += 90.0f;
+    if (!animations) {
+        _currentAngle = _targetAngle;
+        return;
+    }
     // Apenas animação suave de rotação, sem alterar posição
+    _animations = animations;
+    _animations->animate(&_currentAngle, _targetAngle, Config::CUBE_ROTATION_MS, Ease::OUT);
+}
+
+/**
+ * @brief Move o cubo suavemente até uma nova posição.
+ * @param newPos A posição final.
+ * @param animations O sistema que anima o movimento; com nullptr, o cubo vai direto.
+ */
+void RotatingCube::moveTo(const Vector3f& newPos, AnimationSystem* animations) {
+    _targetPosition = newPos;
+    if (!animations) {
+        _currentPosition = newPos;
+        return;
+    }
+    _animations = animations;
+    _animations->animate(&_currentPosition, newPos, Config::CUBE_MOVE_MS);
+}
+
+/**
+ * @brief Define o estado de rotação sem animação (usado ao montar o tabuleiro).
+ * @param state O novo estado, reduzido a 0..3.
+ */
+void RotatingCube::setRotationState(int state) {
+    if (_animations) _animations->cancel(&_currentAngle);
+    _rotationState = ((state % 4) + 4) % 4;
+    _targetAngle = _rotationState * 90.0f;
+    _currentAngle = _targetAngle;
 }
 
 /**
@@ -0,0 +1,562 @@
+/**
+ * @file RuleEngine.cpp
+ * @brief Implementação do compilador e da máquina virtual das regras dos puzzles.
+ */
+
+#include "../include/RuleEngine.h"
+#include "../include/GameStateManager.h"
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// --- FUNÇÕES AUXILIARES ---
+
+/**
+ * @brief Nomes aceitos para os itens no arquivo de regras.
+ */
+static const struct { const char* name; ItemType item; } ITEM_NAMES[] = {
+    {"CHAVE_SALA_1", ItemType::CHAVE_SALA_1},
+    {"CHAVE_SALA_2", ItemType::CHAVE_SALA_2},
+    {"CHAVE_SALA_3", ItemType::CHAVE_SALA_3},
+    {"CHAVE_SALA_4", ItemType::CHAVE_SALA_4},
+    {"FORMA_ESFERA", ItemType::FORMA_ESFERA},
+    {"FORMA_CUBO", ItemType::FORMA_CUBO},
+    {"FORMA_PIRAMIDE", ItemType::FORMA_PIRAMIDE}
+};
+
+/** @brief Quantidade de valores em ItemType, para indexar as regras por item. */
+static const int ITEM_COUNT = static_cast<int>(ItemType::FORMA_PIRAMIDE) + 1;
+
+static bool parseItem(const std::string& name, ItemType& item) {
+    for (const auto& entry : ITEM_NAMES) {
+        if (name == entry.name) {
+            item = entry.item;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Divide uma linha em palavras, parênteses e textos entre aspas.
+ *
+ * Textos entre aspas mantêm as aspas iniciais, para que o parser os distinga de
+ * palavras. Tudo depois de um '#' fora de aspas é ignorado.
+ */
+static std::vector<std::string> tokenize(const std::string& line) {
+    std::vector<std::string> tokens;
+    size_t i = 0;
+    while (i < line.size()) {
+        char c = line[i];
+        if (std::isspace(static_cast<unsigned char>(c))) { ++i; continue; }
+        if (c == '#') break;
+        if (c == '(' || c == ')') {
+            tokens.push_back(std::string(1, c));
+            ++i;
+        } else if (c == '"') {
+            size_t close = line.find('"', i + 1);
+            if (close == std::string::npos) close = line.size();
+            tokens.push_back(line.substr(i, close - i));
+            i = close + 1;
+        } else {
+            size_t start = i;
+            while (i < line.size() && !std::isspace(static_cast<unsigned char>(line[i])) &&
+                   line[i] != '(' && line[i] != ')' && line[i] != '#') {
+                ++i;
+            }
+            tokens.push_back(line.substr(start, i - start));
+        }
+    }
+    return tokens;
+}
+
+// --- PARSER DE CONDIÇÕES ---
+
+/**
+ * @brief Parser descendente de uma condição, que emite o bytecode pós-fixo.
+ *
+ * Precedência: not > and > or.
+ */
+struct RuleEngine::Parser {
+    RuleEngine& engine;
+    const std::vector<std::string>& tokens;
+    size_t position;
+    std::vector<int>& out;
+    std::string error;
+    int depth;    ///< Profundidade atual da pilha durante a execução do código emitido.
+    int maxDepth;
+    bool readsInput;
+
+    Parser(RuleEngine& e, const std::vector<std::string>& t, size_t start, std::vector<int>& o)
+        : engine(e), tokens(t), position(start), out(o), depth(0), maxDepth(0), readsInput(false) {}
+
+    bool atEnd() const { return position >= tokens.size(); }
+    const std::string& peek() const { return tokens[position]; }
+
+    void push() { if (++depth > maxDepth) maxDepth = depth; }
+
+    bool parseOr() {
+        if (!parseAnd()) return false;
+        while (!atEnd() && peek() == "or") {
+            ++position;
+            if (!parseAnd()) return false;
+            out.push_back(OP_OR);
+            --depth;
+        }
+        return true;
+    }
+
+    bool parseAnd() {
+        if (!parseUnary()) return false;
+        while (!atEnd() && peek() == "and") {
+            ++position;
+            if (!parseUnary()) return false;
+            out.push_back(OP_AND);
+            --depth;
+        }
+        return true;
+    }
+
+    bool parseUnary() {
+        if (!atEnd() && peek() == "not") {
+            ++position;
+            if (!parseUnary()) return false;
+            out.push_back(OP_NOT);
+            return true;
+        }
+        return parsePrimary();
+    }
+
+    bool parsePrimary() {
+        if (atEnd()) { error = "condição incompleta"; return false; }
+        std::string word = tokens[position++];
+
+        if (word == "(") {
+            if (!parseOr()) return false;
+            if (atEnd() || peek() != ")") { error = "falta ')'"; return false; }
+            ++position;
+            return true;
+        }
+        if (word == "flag") {
+            if (atEnd()) { error = "flag sem identificador"; return false; }
+            out.push_back(OP_FLAG);
+            out.push_back(engine.internFlag(tokens[position++]));
+            push();
+            return true;
+        }
+        if (word == "item") {
+            ItemType item;
+            if (atEnd() || !parseItem(peek(), item)) { error = "item desconhecido"; return false; }
+            ++position;
+            out.push_back(OP_ITEM);
+            out.push_back(static_cast<int>(item));
+            push();
+            return true;
+        }
+        if (word == "input") {
+            if (position + 1 >= tokens.size()) { error = "input precisa de canal e valor"; return false; }
+            int channel = engine.findChannel(tokens[position]);
+            if (channel < 0) { error = "canal não declarado: " + tokens[position]; return false; }
+            const std::string& value = tokens[position + 1];
+            if (value.empty() || value[0] != '"') { error = "o valor do input deve estar entre aspas"; return false; }
+            position += 2;
+            out.push_back(OP_INPUT);
+            out.push_back(channel);
+            out.push_back(engine.internConstant(value.substr(1)));
+            push();
+            readsInput = true;
+            return true;
+        }
+        error = "esperava flag, item, input, not ou '(' e encontrou '" + word + "'";
+        return false;
+    }
+};
+
+// --- CARREGAMENTO E COMPILAÇÃO ---
+
+/**
+ * @brief Construtor padrão: nenhum canal e nenhuma regra.
+ */
+RuleEngine::RuleEngine() : _running(false) {}
+
+/**
+ * @brief Lê e compila um arquivo de regras.
+ *
+ * Assim como as texturas, o arquivo também é procurado um diretório acima, para
+ * funcionar tanto a partir da raiz do projeto quanto da pasta de saída.
+ *
+ * @param path O caminho do arquivo.
+ * @return false se o arquivo não pôde ser aberto ou tiver erros.
+ */
+bool RuleEngine::loadFromFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) file.open("../" + path);
+    if (!file) {
+        std::cerr << "[Rules] Arquivo não encontrado: " << path << "\n";
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const int errors = compile(buffer.str(), path);
+    std::cout << "[Rules] " << _rules.size() << " regras carregadas de " << path << std::endl;
+    return errors == 0;
+}
+
+/**
+ * @brief Compila regras a partir de um texto.
+ * @param source O conteúdo do arquivo de regras.
+ * @param sourceName Nome usado nas mensagens de erro.
+ * @return O número de erros encontrados.
+ */
+int RuleEngine::compile(const std::string& source, const std::string& sourceName) {
+    _code.clear();
+    _rules.clear();
+    _flagNames.clear();
+    _flagIds.clear();
+    _constants.clear();
+    _channels.clear();
+
+    std::istringstream in(source);
+    std::string line;
+    int lineNumber = 0;
+
+    bool inRule = false;
+    bool ruleOk = false;
+    Rule rule;
+    std::vector<int> condition;
+    std::vector<int> actions;
+
+    int errors = 0;
+    auto report = [&](const std::string& message) {
+        ++errors;
+        std::cerr << "[Rules] " << sourceName << ":" << lineNumber << ": " << message << "\n";
+    };
+
+    while (std::getline(in, line)) {
+        ++lineNumber;
+        std::vector<std::string> tokens = tokenize(line);
+        if (tokens.empty()) continue;
+        const std::string& keyword = tokens[0];
+
+        if (keyword == "input") {
+            int length = (tokens.size() == 3) ? std::atoi(tokens[2].c_str()) : 0;
+            if (length <= 0) { report("uso: input <canal> <tamanho>"); continue; }
+            int index = findChannel(tokens[1]);
+            if (index < 0) {
+                _channels.push_back({tokens[1], length, {}});
+            } else {
+                _channels[index].length = length;
+            }
+        } else if (keyword == "rule") {
+            if (inRule) report("regra '" + rule.name + "' sem 'end'");
+            inRule = true;
+            ruleOk = true;
+            rule = Rule();
+            rule.name = (tokens.size() > 1) ? tokens[1] : "";
+            rule.readsInput = false;
+            condition.clear();
+            actions.clear();
+        } else if (!inRule) {
+            report("'" + keyword + "' fora de uma regra");
+        } else if (keyword == "when") {
+            if (!condition.empty()) { report("a regra já tem uma condição"); ruleOk = false; continue; }
+            Parser parser(*this, tokens, 1, condition);
+            if (!parser.parseOr() || !parser.atEnd()) {
+                report(parser.error.empty() ? "texto sobrando após a condição" : parser.error);
+                ruleOk = false;
+            } else if (parser.maxDepth > STACK_SIZE) {
+                report("condição complexa demais");
+                ruleOk = false;
+            }
+            rule.readsInput = parser.readsInput;
+        } else if (keyword == "do") {
+            if (tokens.size() != 3) { report("uso: do <ação> <argumento>"); ruleOk = false; continue; }
+            const std::string& action = tokens[1];
+            if (action == "set" || action == "unlock" || action == "reveal") {
+                actions.push_back(ACT_SET);
+                actions.push_back(internFlag(tokens[2]));
+            } else if (action == "clear") {
+                actions.push_back(ACT_CLEAR);
+                actions.push_back(internFlag(tokens[2]));
+            } else if (action == "give" || action == "take") {
+                ItemType item;
+                if (!parseItem(tokens[2], item)) { report("item desconhecido: " + tokens[2]); ruleOk = false; continue; }
+                actions.push_back(action == "give" ? ACT_GIVE : ACT_TAKE);
+                actions.push_back(static_cast<int>(item));
+            } else {
+                report("ação desconhecida: " + action);
+                ruleOk = false;
+            }
+        } else if (keyword == "end") {
+            inRule = false;
+            if (condition.empty()) report("regra '" + rule.name + "' sem condição");
+            if (!ruleOk || condition.empty()) continue;
+
+            rule.conditionStart = static_cast<int>(_code.size());
+            _code.insert(_code.end(), condition.begin(), condition.end());
+            _code.push_back(OP_END);
+            rule.actionStart = static_cast<int>(_code.size());
+            rule.actionCount = static_cast<int>(actions.size() / 2);
+            _code.insert(_code.end(), actions.begin(), actions.end());
+            rule.lastResult = false;
+            rule.queued = false;
+            _rules.push_back(rule);
+        } else {
+            report("comando desconhecido: " + keyword);
+        }
+    }
+    if (inRule) report("regra '" + rule.name + "' sem 'end'");
+
+    buildIndex();
+    return errors;
+}
+
+/**
+ * @brief Monta os índices evento -> regras a partir do bytecode das condições.
+ */
+void RuleEngine::buildIndex() {
+    _flagRules.assign(_flagNames.size(), std::vector<int>());
+    _itemRules.assign(ITEM_COUNT, std::vector<int>());
+
+    for (int r = 0; r < static_cast<int>(_rules.size()); ++r) {
+        int pc = _rules[r].conditionStart;
+        while (_code[pc] != OP_END) {
+            switch (_code[pc]) {
+                case OP_FLAG: {
+                    std::vector<int>& list = _flagRules[_code[pc + 1]];
+                    if (list.empty() || list.back() != r) list.push_back(r);
+                    pc += 2;
+                    break;
+                }
+                case OP_ITEM: {
+                    std::vector<int>& list = _itemRules[_code[pc + 1]];
+                    if (list.empty() || list.back() != r) list.push_back(r);
+                    pc += 2;
+                    break;
+                }
+                case OP_INPUT: {
+                    std::vector<int>& list = _channels[_code[pc + 1]].rules;
+                    if (list.empty() || list.back() != r) list.push_back(r);
+                    pc += 3;
+                    break;
+                }
+                default:
+                    pc += 1;
+                    break;
+            }
+        }
+    }
+
+    // Uma regra só entra de novo na fila depois de avaliada, então, fora cadeias
+    // de regras que se realimentam, a capacidade inicial basta.
+    _queue.clear();
+    _queue.reserve(_rules.size());
+}
+
+int RuleEngine::internFlag(const std::string& flag) {
+    auto it = _flagIds.find(flag);
+    if (it != _flagIds.end()) return it->second;
+    int id = static_cast<int>(_flagNames.size());
+    _flagNames.push_back(flag);
+    _flagIds[flag] = id;
+    return id;
+}
+
+int RuleEngine::internConstant(const std::string& value) {
+    for (int i = 0; i < static_cast<int>(_constants.size()); ++i) {
+        if (_constants[i] == value) return i;
+    }
+    _constants.push_back(value);
+    return static_cast<int>(_constants.size()) - 1;
+}
+
+int RuleEngine::findChannel(const std::string& channel) const {
+    for (int i = 0; i < static_cast<int>(_channels.size()); ++i) {
+        if (_channels[i].name == channel) return i;
+    }
+    return -1;
+}
+
+// --- MÁQUINA VIRTUAL ---
+
+/**
+ * @brief Executa o bytecode da condição de uma regra.
+ *
+ * @param rule A regra.
+ * @param gameStateManager O estado consultado por flags e itens.
+ * @param channel O canal da entrada sendo avaliada, ou -1.
+ * @param input A entrada do canal, ou nullptr.
+ * @return O valor da condição.
+ */
+bool RuleEngine::evaluate(const Rule& rule, const GameStateManager& gameStateManager, int channel, const std::string* input) const {
+    bool stack[STACK_SIZE];
+    int top = 0;
+    int pc = rule.conditionStart;
+
+    for (;;) {
+        switch (_code[pc]) {
+            case OP_FLAG:
+                stack[top++] = gameStateManager.isPuzzleSolved(_flagNames[_code[pc + 1]]);
+                pc += 2;
+                break;
+            case OP_ITEM:
+                stack[top++] = gameStateManager.playerHasItem(static_cast<ItemType>(_code[pc + 1]));
+                pc += 2;
+                break;
+            case OP_INPUT:
+                stack[top++] = input && _code[pc + 1] == channel && *input == _constants[_code[pc + 2]];
+                pc += 3;
+                break;
+            case OP_NOT:
+                stack[top - 1] = !stack[top - 1];
+                pc += 1;
+                break;
+            case OP_AND:
+                --top;
+                stack[top - 1] = stack[top - 1] && stack[top];
+                pc += 1;
+                break;
+            case OP_OR:
+                --top;
+                stack[top - 1] = stack[top - 1] || stack[top];
+                pc += 1;
+                break;
+            default: // OP_END
+                return stack[0];
+        }
+    }
+}
+
+/**
+ * @brief Executa as ações de uma regra.
+ *
+ * As ações alteram o GameStateManager, que por sua vez notifica este motor;
+ * as regras afetadas entram na fila e são avaliadas por runQueue.
+ */
+void RuleEngine::execute(const Rule& rule, GameStateManager& gameStateManager) {
+    std::cout << "[Rules] Regra '" << rule.name << "' disparou." << std::endl;
+    int pc = rule.actionStart;
+    for (int i = 0; i < rule.actionCount; ++i, pc += 2) {
+        int argument = _code[pc + 1];
+        switch (_code[pc]) {
+            case ACT_SET:   gameStateManager.setPuzzleState(_flagNames[argument], true); break;
+            case ACT_CLEAR: gameStateManager.setPuzzleState(_flagNames[argument], false); break;
+            case ACT_GIVE:  gameStateManager.addItemToInventory(static_cast<ItemType>(argument)); break;
+            case ACT_TAKE:  gameStateManager.removeItemFromInventory(static_cast<ItemType>(argument)); break;
+        }
+    }
+}
+
+void RuleEngine::enqueue(const std::vector<int>& rules) {
+    for (int r : rules) {
+        if (!_rules[r].queued) {
+            _rules[r].queued = true;
+            _queue.push_back(r);
+        }
+    }
+}
+
+/**
+ * @brief Avalia as regras enfileiradas até a fila esvaziar.
+ *
+ * Regras que não leem entrada disparam apenas na borda de subida da condição,
+ * o que impede laços entre regras que se alimentam mutuamente.
+ */
+void RuleEngine::runQueue(GameStateManager& gameStateManager) {
+    if (_running) return; // o laço externo vai processar o que foi enfileirado
+    _running = true;
+    for (size_t i = 0; i < _queue.size(); ++i) {
+        Rule& rule = _rules[_queue[i]];
+        rule.queued = false;
+        if (rule.readsInput) continue;
+
+        bool result = evaluate(rule, gameStateManager, -1, nullptr);
+        bool rising = result && !rule.lastResult;
+        rule.lastResult = result;
+        if (rising) execute(rule, gameStateManager);
+    }
+    _queue.clear();
+    _running = false;
+}
+
+// --- EVENTOS ---
+
+/**
+ * @brief Avalia todas as regras que não dependem de entrada.
+ * @param gameStateManager O gerenciador de estado do jogo.
+ */
+void RuleEngine::evaluateAll(GameStateManager& gameStateManager) {
+    for (int r = 0; r < static_cast<int>(_rules.size()); ++r) {
+        if (!_rules[r].queued) {
+            _rules[r].queued = true;
+            _queue.push_back(r);
+        }
+    }
+    runQueue(gameStateManager);
+}
+
+/**
+ * @brief Reavalia as regras que leem a flag alterada.
+ * @param flag O identificador da flag.
+ * @param gameStateManager O gerenciador de estado do jogo.
+ */
+void RuleEngine::onFlagChanged(const std::string& flag, GameStateManager& gameStateManager) {
+    auto it = _flagIds.find(flag);
+    if (it == _flagIds.end()) return;
+    enqueue(_flagRules[it->second]);
+    runQueue(gameStateManager);
+}
+
+/**
+ * @brief Reavalia as regras que leem o item alterado.
+ * @param item O item que entrou ou saiu do inventário.
+ * @param gameStateManager O gerenciador de estado do jogo.
+ */
+void RuleEngine::onItemChanged(ItemType item, GameStateManager& gameStateManager) {
+    int index = static_cast<int>(item);
+    if (index < 0 || index >= static_cast<int>(_itemRules.size())) return;
+    enqueue(_itemRules[index]);
+    runQueue(gameStateManager);
+}
+
+/**
+ * @brief Avalia as regras de um canal com a entrada recebida.
+ *
+ * @param channel O nome do canal.
+ * @param value Os símbolos digitados.
+ * @param gameStateManager O gerenciador de estado do jogo.
+ * @return true se alguma regra disparou.
+ */
+bool RuleEngine::onInput(const std::string& channel, const std::string& value, GameStateManager& gameStateManager) {
+    int index = findChannel(channel);
+    if (index < 0) return false;
+
+    bool fired = false;
+    for (int r : _channels[index].rules) {
+        if (evaluate(_rules[r], gameStateManager, index, &value)) {
+            execute(_rules[r], gameStateManager);
+            fired = true;
+        }
+    }
+    runQueue(gameStateManager);
+    return fired;
+}
+
+/**
+ * @brief Quantos símbolos um canal junta antes de ser avaliado.
+ * @param channel O nome do canal.
+ * @return O tamanho declarado, ou 0 se o canal não existir.
+ */
+int RuleEngine::getInputLength(const std::string& channel) const {
+    int index = findChannel(channel);
+    return index < 0 ? 0 : _channels[index].length;
+}
+
+/**
+ * @brief Número de regras compiladas.
+ */
+int RuleEngine::getRuleCount() const {
+    return static_cast<int>(_rules.size());
+}
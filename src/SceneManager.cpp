@@ -12,13 +12,22 @@
 #include "../include/Door.h"
 #include "../include/PuzzleDoor.h"
 #include "../include/Sign.h"
+#include "../include/MazeLevel.h"
 #include "../include/CubePuzzle.h"
 #include "../include/RotatingCube.h"
+#include "../include/MovableVase.h"
+#include "../include/CollectableShape.h"
+#include "../include/ShapeSocket.h"
 #include "../include/Player.h"
 #include "../include/Room.h"
 #include "../include/InteractableObject.h"
+#include "../include/RenderPacket.h"
+#include "../include/Config.h"
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <iostream>
+#include <string>
 
 /**
  * @brief Construtor da classe SceneManager.
@@ -52,8 +61,12 @@ SceneManager::~SceneManager() {
 void SceneManager::init(Player& player) {
     _player = &player;
     const int penaltyRoomIndex = 5; // �ndice da sala de "Game Over"
+    const int mazeRoomIndex = 6;     // Índice do labirinto, entre a sala dos cubos e a vitória
     const float spawnHeight = 1.6f; // Altura padr�o consistente para o spawn do jogador
 
+    // O labirinto é lido antes, para que a porta da sala 4 saiba onde ele começa.
+    MazeLevel* maze = new MazeLevel(Config::MAZE_FILE, "Textures/628.jpg");
+
     // --- SALA 1 (�NDICE 0): PUZZLE DAS PORTAS COM �CONES ---
     Room* room1 = new Room();
     {
@@ -115,7 +128,9 @@ void SceneManager::init(Player& player) {
         room3->addObject(new Wall({ roomSize,wallHeight/2.0f, 0.0f},   {0.5f, wallHeight, roomSize*2.0f},"Textures/1124.jpg"));
 
         // A porta requer as chaves vermelha (SALA_2) e azul (SALA_3)
-        room3->addObject(new Door({0.0f, 1.0f, -5.5f}, 3, {0.0f, spawnHeight, 8.5f}, {ItemType::CHAVE_SALA_2, ItemType::CHAVE_SALA_3}));
+        Door* room3Exit = new Door({0.0f, 1.0f, -5.5f}, 3, {0.0f, spawnHeight, 8.5f}, PuzzleID::Porta_Sala3); // chaves vermelha e azul (ver regras)
+        room3Exit->setPortal(true);
+        room3->addObject(room3Exit);
 
         float radius = 4.5f;
 
@@ -125,10 +140,32 @@ void SceneManager::init(Player& player) {
         room3->addObject(new PrimitiveObject(PrimitiveShape::CUBE, { radius, 0.25f, 0.0f }, {0.3f, 0.3f, 0.3f}, {1.0f, 0.5f, 1.0f}));
 
         // Chaves posicionadas em cima das plataformas
-        room3->addObject(new Key({ 0.0f, 1.5f, radius }, ItemType::CHAVE_SALA_4, "", false, {0.0f, 1.0f, 0.5f}));  // Chave Verde
+        room3->addObject(new Key({ 0.0f, 1.5f, radius }, ItemType::CHAVE_SALA_4, PuzzleID::Sala2_FormasEncaixadas, false, {0.0f, 1.0f, 0.5f}));  // Chave Verde
         room3->addObject(new Key({ -radius, 2.25f, 0.0f }, ItemType::CHAVE_SALA_3, "", false, {0.0f, 0.0f, 1.0f})); // Chave Azul
         room3->addObject(new Key({ radius, 1.25f, 0.0f }, ItemType::CHAVE_SALA_2, "", false, {1.0f, 0.0f, 0.0f}));   // Chave Vermelha
 
+        // Vasos que podem ser empurrados e formas que podem ser carregadas
+        room3->addObject(new MovableVase({-3.0f, 0.0f, -3.5f}, {0.55f, 0.35f, 0.2f}));
+        room3->addObject(new MovableVase({ 3.0f, 0.0f, -3.5f}, {0.2f, 0.35f, 0.55f}, 1.0f, 0.35f));
+        room3->addObject(new MovableVase({ 2.5f, 0.0f,  2.5f}, {0.45f, 0.45f, 0.45f}, 0.6f, 0.25f));
+        CollectableShape* sphere  = new CollectableShape({-2.0f, 0.3f,  2.0f}, ItemType::FORMA_ESFERA,   {0.9f, 0.9f, 0.2f});
+        CollectableShape* cube    = new CollectableShape({ 2.0f, 0.3f, -1.0f}, ItemType::FORMA_CUBO,     {0.2f, 0.8f, 0.9f});
+        CollectableShape* pyramid = new CollectableShape({-1.5f, 0.3f, -2.0f}, ItemType::FORMA_PIRAMIDE, {0.9f, 0.4f, 0.8f});
+        room3->addObject(sphere);
+        room3->addObject(cube);
+        room3->addObject(pyramid);
+
+        // Encaixes das formas: com os três ocupados, a chave verde aparece
+        std::vector<ShapeSocket*> sockets = {
+            new ShapeSocket({-4.0f, 0.0f, -3.0f}, sphere,  PuzzleID::Sala2_FormasEncaixadas),
+            new ShapeSocket({-4.0f, 0.0f, -1.5f}, cube,    PuzzleID::Sala2_FormasEncaixadas),
+            new ShapeSocket({-4.0f, 0.0f,  1.5f}, pyramid, PuzzleID::Sala2_FormasEncaixadas)
+        };
+        ShapeSocket::linkGroup(sockets);
+        for (ShapeSocket* socket : sockets) {
+            room3->addObject(socket);
+        }
+
         room3->addObject(new Sign({0.0f, 2.75f, -5.0f}, "A porta pede o fruto da uniao do fogo e do ceu. Colete as cores certas para provar seu valor."));
     }
     _rooms.push_back(room3);
@@ -148,7 +185,7 @@ void SceneManager::init(Player& player) {
         room4->addObject(new PrimitiveObject(PrimitiveShape::CUBE, {0.0f, 0.1f, 0.0f}, {0.1f, 0.1f, 0.1f}, {5.0f, 0.2f, 5.0f}));
 
         // Puzzle dos cubos centralizado e em cima do pedestal
-        CubePuzzle* puzzle = new CubePuzzle(2, 2, {-1.0f, 0.7f, -1.0f}, 2.0f, 1.0f, PuzzleID::Sala_Cubos);
+        CubePuzzle* puzzle = new CubePuzzle(2, 2, {-1.0f, 0.7f, -1.0f}, 2.0f, 1.0f, PuzzleID::Sala_Cubos, 3);
         room4->addObject(puzzle);
         const auto& cubes = puzzle->getCubes();
 
@@ -157,7 +194,16 @@ void SceneManager::init(Player& player) {
                 room4->addObject(cubes[i][j]);
 
         // Porta da vit�ria que leva para a sala de �ndice 4
-        room4->addObject(new Door({0.0f, 1.0f, -9.5f}, 4, {0.0f, spawnHeight, 4.5f}, PuzzleID::Sala_Cubos));
+        // A porta final leva ao labirinto, se ele tiver sido carregado, e dele à vitória.
+        int finalTarget = 4;
+        Vector3f finalSpawn = {0.0f, spawnHeight, 4.5f};
+        if (maze->isLoaded()) {
+            finalTarget = mazeRoomIndex;
+            finalSpawn = {maze->getStartPosition().x, spawnHeight, maze->getStartPosition().z};
+        }
+        Door* room4Exit = new Door({0.0f, 1.0f, -9.5f}, finalTarget, finalSpawn, PuzzleID::Porta_Final); // cubos (ver regras)
+        room4Exit->setPortal(true);
+        room4->addObject(room4Exit);
         room4->addObject(new Sign({0.0f, 2.75f, -9.4f}, "O desafio final. A ordem precede a vitoria. Encontre a harmonia."));
     }
     _rooms.push_back(room4);
@@ -174,6 +220,13 @@ void SceneManager::init(Player& player) {
         room5->addObject(new Wall({roomSize, wallHeight / 2.0f, 0.0f}, {0.5f, wallHeight, roomSize * 2.0f},"../Textures/festa.jpg"));
 
         room5->addObject(new Sign({0.0f, 1.5f, 0.0f}, "PARABENS! Voce escapou!"));
+        room5->addObject(new PrimitiveObject(std::string(Config::MODEL_DIR) + "mesa.obj", {3.5f, 0.0f, -3.5f}, {0.55f, 0.35f, 0.2f}));
+
+        // Luzes coloridas de festa nos cantos, pré-calculadas no lightmap.
+        room5->addBakedLight({{-4.5f, 3.2f, -4.5f}, {0.9f, 0.3f, 0.3f}, 7.0f});
+        room5->addBakedLight({{4.5f, 3.2f, -4.5f}, {0.3f, 0.9f, 0.3f}, 7.0f});
+        room5->addBakedLight({{-4.5f, 3.2f, 4.5f}, {0.3f, 0.3f, 0.9f}, 7.0f});
+        room5->addBakedLight({{4.5f, 3.2f, 4.5f}, {0.9f, 0.8f, 0.3f}, 7.0f});
     }
     _rooms.push_back(room5);
 
@@ -194,6 +247,25 @@ void SceneManager::init(Player& player) {
     }
     _rooms.push_back(room6);
 
+    // --- SALA 7 (ÍNDICE 6): LABIRINTO ---
+    Room* room7 = new Room();
+    {
+        room7->addObject(maze);
+        if (maze->isLoaded()) {
+            Vector3f start = maze->getStartPosition();
+            Vector3f exit = maze->getExitPosition();
+            room7->setSpawnPoint({start.x, spawnHeight, start.z});
+            // A saída fica encostada na parede ao sul da célula 'E'.
+            room7->addObject(new Door({exit.x, 1.0f, exit.z - Config::TILE_SIZE / 2.0f + 0.2f}, 4, {0.0f, spawnHeight, 4.5f}));
+        }
+    }
+    _rooms.push_back(room7);
+
+    // Iluminação estática das salas (do cache, se a geometria não mudou).
+    for (size_t i = 0; i < _rooms.size(); ++i) {
+        _rooms[i]->bakeLighting(std::string(Config::LIGHTMAP_DIR) + "sala" + std::to_string(i + 1) + ".lmap");
+    }
+
     // In�cio do jogo na Sala 1
     if (!_rooms.empty()) {
         _currentRoomIndex = 0;
@@ -223,6 +295,9 @@ void SceneManager::setActiveRoom(int index) {
  */
 void SceneManager::switchToRoom(int roomIndex, Player& player, const Vector3f& spawnPosition) {
     if (roomIndex >= 0 && (unsigned int)roomIndex < _rooms.size()) {
+        if (_currentRoomIndex != -1) {
+            _rooms[_currentRoomIndex]->untrackPlayer();
+        }
         _currentRoomIndex = roomIndex;
         player.setPosition(spawnPosition);
         std::cout << "MUDOU PARA A SALA " << roomIndex << std::endl;
@@ -233,24 +308,202 @@ void SceneManager::switchToRoom(int roomIndex, Player& player, const Vector3f& s
  * @brief Atualiza a sala ativa.
  *
  * Chama o m�todo `update` da sala atual, delegando a atualiza��o de seus objetos.
+ * As portas das outras salas também são reavaliadas, já que elas podem aparecer
+ * através dos portais da sala atual.
  *
  * @param deltaTime O tempo decorrido desde o �ltimo quadro.
  * @param gameStateManager O gerenciador de estado do jogo.
  */
 void SceneManager::update(float deltaTime, GameStateManager& gameStateManager) {
     if (_currentRoomIndex != -1) {
+        // O jogador empurra os objetos móveis em que encostou neste passo.
+        _rooms[_currentRoomIndex]->getPhysics().pushBodies(_player->getCapsule(), _player->getVelocity());
+        _rooms[_currentRoomIndex]->trackPlayer(_player->getBoundingBox());
         _rooms[_currentRoomIndex]->update(deltaTime, gameStateManager);
     }
+
+    for (size_t i = 0; i < _rooms.size(); ++i) {
+        if ((int)i == _currentRoomIndex) continue;
+        for (Door* door : _rooms[i]->getDoors()) {
+            door->refreshPortal(gameStateManager);
+        }
+    }
 }
 
 /**
- * @brief Renderiza a sala ativa.
- *
- * Chama o m�todo `render` da sala atual, delegando o desenho de seus objetos.
+ * @brief Registra no pacote do quadro os itens de desenho da sala ativa e das
+ * salas vistas através das suas portas abertas.
+ * @param packet O pacote sendo montado pela simulação.
  */
-void SceneManager::render() {
+void SceneManager::collectDrawItems(RenderPacket& packet) {
     if (_currentRoomIndex != -1) {
-        _rooms[_currentRoomIndex]->render();
+        const CameraSnapshot& camera = packet.camera;
+        _rooms[_currentRoomIndex]->collectDrawItems(packet);
+        packet.sortFrontToBack(0, camera.position, camera.front);
+        packet.roomItemCount = packet.items.size();
+        packet.depthPrepass = useDepthPrepass(packet);
+
+        const Matrix4 viewProjection = cameraProjection() *
+            Matrix4::lookAt(camera.position, camera.position + camera.front, camera.up);
+        collectPortals(_rooms[_currentRoomIndex], Matrix4::identity(), Frustum::fromMatrix(viewProjection),
+                       viewProjection, -1, 1, packet);
+    }
+}
+
+/**
+ * @brief Decide se a sala atual é desenhada com a passada de profundidade (Config::DEPTH_PREPASS).
+ *
+ * No modo automático, a passada é usada quando há itens opacos suficientes para que
+ * a ordenação por origem deixe sobreposições fora de ordem (objetos grandes que se
+ * cruzam, peças dentro de outras); o custo extra é só de vértices.
+ *
+ * @param packet O pacote com os itens da sala atual já ordenados.
+ */
+bool SceneManager::useDepthPrepass(const RenderPacket& packet) {
+    if (Config::DEPTH_PREPASS >= 0) return Config::DEPTH_PREPASS > 0;
+
+    size_t opaque = 0;
+    while (opaque < packet.roomItemCount && packet.items[opaque].layer == DrawLayer::Opaque) ++opaque;
+    return opaque >= static_cast<size_t>(Config::DEPTH_PREPASS_MIN_ITEMS);
+}
+
+/**
+ * @brief A mesma projeção perspectiva configurada em Game::init.
+ */
+Matrix4 SceneManager::cameraProjection() {
+    return Matrix4::perspective(Config::CAMERA_FOV_Y, (float)Config::SCREEN_WIDTH / (float)Config::SCREEN_HEIGHT,
+                                Config::CAMERA_ZNEAR, Config::CAMERA_ZFAR);
+}
+
+/**
+ * @brief Testa se algum ponto do polígono pode estar dentro do frustum.
+ *
+ * Conservador: só descarta o polígono se todos os cantos estiverem do lado de
+ * fora de um mesmo plano.
+ */
+static bool polygonInFrustum(const Frustum& frustum, const Vector3f* corners, int count) {
+    for (const Vector4f& plane : frustum.planes) {
+        int outside = 0;
+        for (int i = 0; i < count; ++i) {
+            if (plane.x * corners[i].x + plane.y * corners[i].y + plane.z * corners[i].z + plane.w < 0.0f) ++outside;
+        }
+        if (outside == count) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Um plano (normal voltada para `inside`) passando por três pontos.
+ */
+static Vector4f planeThrough(const Vector3f& a, const Vector3f& b, const Vector3f& c, const Vector3f& inside) {
+    Vector3f n = normalize(cross(b - a, c - a));
+    float d = -dot(n, a);
+    if (dot(n, inside) + d < 0.0f) {
+        n = -n;
+        d = -d;
+    }
+    return {n.x, n.y, n.z, d};
+}
+
+/**
+ * @brief O retângulo da tela (em pixels) que contém o polígono.
+ *
+ * Se algum canto estiver atrás da câmera, a projeção não é confiável e o
+ * retângulo é a tela inteira.
+ */
+static void screenRect(const Matrix4& viewProjection, const Vector3f* corners, int count, int rect[4]) {
+    float minX = 1.0f, minY = 1.0f, maxX = -1.0f, maxY = -1.0f;
+    for (int i = 0; i < count; ++i) {
+        Vector4f clip = viewProjection.transform({corners[i].x, corners[i].y, corners[i].z, 1.0f});
+        if (clip.w <= Config::CAMERA_ZNEAR) {
+            minX = minY = -1.0f;
+            maxX = maxY = 1.0f;
+            break;
+        }
+        minX = std::min(minX, clip.x / clip.w);
+        maxX = std::max(maxX, clip.x / clip.w);
+        minY = std::min(minY, clip.y / clip.w);
+        maxY = std::max(maxY, clip.y / clip.w);
+    }
+    minX = std::max(minX, -1.0f); minY = std::max(minY, -1.0f);
+    maxX = std::min(maxX, 1.0f);  maxY = std::min(maxY, 1.0f);
+
+    rect[0] = static_cast<int>(std::floor((minX * 0.5f + 0.5f) * Config::SCREEN_WIDTH));
+    rect[1] = static_cast<int>(std::floor((minY * 0.5f + 0.5f) * Config::SCREEN_HEIGHT));
+    rect[2] = std::max(0, static_cast<int>(std::ceil((maxX * 0.5f + 0.5f) * Config::SCREEN_WIDTH)) - rect[0]);
+    rect[3] = std::max(0, static_cast<int>(std::ceil((maxY * 0.5f + 0.5f) * Config::SCREEN_HEIGHT)) - rect[1]);
+}
+
+/**
+ * @brief Registra as salas vistas através das portas abertas de uma sala.
+ *
+ * Cada porta-portal visível vira um PortalView. A sala de destino é posicionada
+ * de forma que o seu ponto de chegada fique Config::PORTAL_DEPTH atrás da porta,
+ * e só é visitada se a abertura estiver dentro do frustum atual. Os portais da
+ * sala de destino são testados contra um frustum recortado pela abertura (quatro
+ * planos passando pela câmera e pelas arestas da porta, mais o plano da porta),
+ * até Config::PORTAL_MAX_DEPTH salas em sequência.
+ *
+ * @param room A sala cujas portas são examinadas.
+ * @param offset Leva coordenadas de `room` para as da sala atual.
+ * @param frustum O volume de visão (já recortado pelos portais anteriores).
+ * @param viewProjection Projeção * visão da câmera, para o retângulo de tesoura.
+ * @param parent O portal através do qual `room` é vista (-1 para a sala atual).
+ * @param depth A profundidade dos portais desta sala.
+ * @param packet O pacote do quadro.
+ */
+void SceneManager::collectPortals(Room* room, const Matrix4& offset, const Frustum& frustum,
+                                  const Matrix4& viewProjection, int parent, int depth, RenderPacket& packet) {
+    if (depth > Config::PORTAL_MAX_DEPTH) return;
+
+    const Vector3f eye = packet.camera.position;
+    for (const Door* door : room->getDoors()) {
+        int target = door->getTargetRoomIndex();
+        if (!door->isPortalOpen() || target < 0 || (size_t)target >= _rooms.size()) continue;
+
+        PortalView portal;
+        Vector3f normal;
+        door->getPortalQuad(portal.corners, normal);
+        VectorMath::transformPoints(offset, portal.corners, portal.corners, 4);
+        normal = offset.transformDirection(normal);
+
+        // A câmera precisa estar do lado da sala, olhando para a abertura.
+        const Vector3f center = (portal.corners[0] + portal.corners[2]) * 0.5f;
+        if (dot(normal, eye - center) <= 0.0f || !polygonInFrustum(frustum, portal.corners, 4)) continue;
+
+        // O ponto de chegada da sala de destino vai para trás da porta (no mesmo piso).
+        const Vector3f& spawn = door->getSpawnPosition();
+        const Vector3f arrival = center - normal * Config::PORTAL_DEPTH;
+        const Vector3f shift = {arrival.x - spawn.x, 0.0f, arrival.z - spawn.z};
+        portal.offset = Matrix4::translation(shift);
+
+        // Geometria da sala de destino entre a câmera e o ponto de chegada (como a
+        // parede atrás dele) fica de fora.
+        portal.clipPlane = {-normal.x, -normal.y, -normal.z, dot(normal, arrival)};
+
+        portal.parent = parent;
+        portal.depth = depth;
+        screenRect(viewProjection, portal.corners, 4, portal.scissor);
+
+        // A sala de destino escolhe os seus níveis de detalhe com a câmera nas coordenadas dela.
+        portal.firstItem = packet.items.size();
+        packet.camera.position = eye - shift;
+        _rooms[target]->collectDrawItems(packet);
+        packet.sortFrontToBack(portal.firstItem, packet.camera.position, packet.camera.front);
+        packet.camera.position = eye;
+        portal.itemCount = packet.items.size() - portal.firstItem;
+
+        packet.portals.push_back(portal);
+        const int index = static_cast<int>(packet.portals.size()) - 1;
+
+        // Laterais e plano próximo trocados pelos da abertura; o plano distante continua.
+        const Vector3f beyond = center + (center - eye);
+        Frustum clipped = frustum;
+        for (int i = 0; i < 4; ++i) {
+            clipped.planes[i] = planeThrough(eye, portal.corners[i], portal.corners[(i + 1) % 4], beyond);
+        }
+        clipped.planes[4] = portal.clipPlane;
+        collectPortals(_rooms[target], portal.offset, clipped, viewProjection, index, depth + 1, packet);
     }
 }
 
@@ -269,3 +522,11 @@ std::vector<InteractableObject*>& SceneManager::getInteractableObjects() {
 const std::vector<GameObject*>& SceneManager::getCurrentRoomObjects() const {
     return _rooms[_currentRoomIndex]->getObjects();
 }
+
+/**
+ * @brief Obtém as caixas de colisão estáticas da sala atual.
+ * @return Uma referência constante para o vetor de caixas da sala ativa.
+ */
+const std::vector<BoundingBox>& SceneManager::getCurrentRoomColliders() const {
+    return _rooms[_currentRoomIndex]->getStaticColliders();
+}
@@ -0,0 +1,106 @@
+/**
+ * @file SequenceButton.cpp
+ * @brief Implementação da classe SequenceButton, um botão de puzzle de sequência.
+ */
+
+#include "../include/SequenceButton.h"
+#include "../include/GameStateManager.h"
+#include "../include/AnimationSystem.h"
+#include "../include/MeshManager.h"
+#include <GL/freeglut.h>
+#include <iostream>
+
+/** @brief Duração (ms) do brilho depois que o botão é pressionado. */
+static const float GLOW_DURATION_MS = 400.0f;
+
+/** @brief Raio da esfera do botão. */
+static const float BUTTON_RADIUS = 0.3f;
+
+/**
+ * @brief Construtor da classe SequenceButton.
+ * @param position A posição do botão (o centro da esfera).
+ * @param channel O canal de entrada que recebe o símbolo.
+ * @param symbol O símbolo enviado ao pressionar.
+ * @param color A cor do botão.
+ */
+SequenceButton::SequenceButton(const Vector3f& position, const std::string& channel, char symbol, const Vector3f& color)
+    : InteractableObject(position), _transform(position), _channel(channel), _symbol(symbol), _color(color), _glow(0.0f), _lod(0), _animations(nullptr) {}
+
+/**
+ * @brief Destrutor: interrompe a animação do brilho.
+ */
+SequenceButton::~SequenceButton() {
+    if (_animations) _animations->cancel(&_glow);
+}
+
+/**
+ * @brief O brilho é animado pelo AnimationSystem; não há nada a atualizar.
+ * @param deltaTime O tempo decorrido desde o último quadro.
+ * @param gameStateManager O gerenciador de estado do jogo.
+ */
+void SequenceButton::update(float deltaTime, GameStateManager& gameStateManager) {}
+
+/**
+ * @brief Registra o botão no pacote do quadro, clareando a cor enquanto brilha.
+ * @param packet O pacote do quadro sendo montado pela simulação.
+ */
+void SequenceButton::collectDrawItems(RenderPacket& packet) {
+    DrawItem item(this, _transform);
+    item.color = {
+        _color.x + (1.0f - _color.x) * _glow,
+        _color.y + (1.0f - _color.y) * _glow,
+        _color.z + (1.0f - _color.z) * _glow
+    };
+    _lod = MeshManager::selectLod(packet.camera.position, _transform.getWorldPosition(), BUTTON_RADIUS, _lod);
+    item.lod = _lod;
+    packet.items.push_back(item);
+}
+
+/**
+ * @brief Desenha o botão: uma esfera sobre um pedestal cinza.
+ * @param item O item com a posição e a cor capturadas na simulação.
+ */
+void SequenceButton::draw(const DrawItem& item) {
+    glColor3f(0.3f, 0.3f, 0.3f);
+    glPushMatrix();
+    glTranslatef(0.0f, -BUTTON_RADIUS - 0.4f, 0.0f);
+    glScalef(0.5f, 0.8f, 0.5f);
+    glutSolidCube(1.0f);
+    glPopMatrix();
+
+    glColor3f(item.color.x, item.color.y, item.color.z);
+    MeshManager::drawSphere(BUTTON_RADIUS, item.lod);
+}
+
+/**
+ * @brief Envia o símbolo do botão para o seu canal de entrada.
+ * @param gameStateManager O gerenciador de estado do jogo.
+ */
+void SequenceButton::onClick(GameStateManager& gameStateManager) {
+    std::cout << "Botao '" << _symbol << "' pressionado." << std::endl;
+    _animations = gameStateManager.getAnimationSystem();
+    if (_animations) {
+        _glow = 1.0f;
+        _animations->animate(&_glow, 0.0f, GLOW_DURATION_MS, Ease::LINEAR);
+    }
+    gameStateManager.appendToInput(_channel, _symbol);
+}
+
+/**
+ * @brief Obtém o raio de colisão (para a interação por raio).
+ * @return O raio da esfera do botão.
+ */
+float SequenceButton::getCollisionRadius() const {
+    return BUTTON_RADIUS;
+}
+
+/**
+ * @brief Obtém a caixa delimitadora do botão e do pedestal.
+ * @return A caixa que envolve a esfera e o pedestal até o chão.
+ */
+BoundingBox SequenceButton::getBoundingBox() const {
+    BoundingBox box;
+    box.min = {_position.x - 0.25f, _position.y - BUTTON_RADIUS - 0.8f, _position.z - 0.25f};
+    box.max = {_position.x + 0.25f, _position.y + BUTTON_RADIUS, _position.z + 0.25f};
+    return box;
+}
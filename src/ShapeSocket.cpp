@@ -0,0 +1,145 @@
+/**
+ * @file ShapeSocket.cpp
+ * @brief Implementação da classe ShapeSocket, um encaixe de forma ou placa de pressão.
+ */
+
+#include "../include/ShapeSocket.h"
+#include "../include/CollectableShape.h"
+#include "../include/GameStateManager.h"
+#include <GL/freeglut.h>
+#include <iostream>
+
+namespace {
+    const float SOCKET_HALF_SIZE = 0.4f;   // Meia largura do encaixe
+    const float SOCKET_THICKNESS = 0.04f;  // Espessura da placa no chão
+    const float TRIGGER_HEIGHT = 0.6f;     // Altura do volume acima do chão
+}
+
+/**
+ * @brief Construtor da classe ShapeSocket.
+ * @param position O centro do encaixe, no chão.
+ * @param expectedShape A forma aceita, ou nullptr para uma placa de pressão.
+ * @param puzzleId O puzzle controlado pelo encaixe (e pelo seu grupo).
+ */
+ShapeSocket::ShapeSocket(const Vector3f& position, CollectableShape* expectedShape, const std::string& puzzleId)
+    : InteractableObject(position),
+      _expectedShape(expectedShape),
+      _puzzleId(puzzleId),
+      // A placa é um cubo unitário achatado, apoiado no chão.
+      _transform({position.x, position.y + SOCKET_THICKNESS / 2.0f, position.z},
+                 {SOCKET_HALF_SIZE * 2.0f, SOCKET_THICKNESS, SOCKET_HALF_SIZE * 2.0f}),
+      _occupants(0) {
+    _color = expectedShape ? expectedShape->getColor() : Vector3f{0.5f, 0.5f, 0.5f};
+    _group.push_back(this);
+    setInteractable(expectedShape != nullptr);
+}
+
+/**
+ * @brief Liga os encaixes de um mesmo puzzle.
+ * @param sockets Os encaixes do grupo.
+ */
+void ShapeSocket::linkGroup(const std::vector<ShapeSocket*>& sockets) {
+    for (ShapeSocket* socket : sockets) {
+        socket->_group = sockets;
+    }
+}
+
+/**
+ * @brief O encaixe não tem lógica por quadro; ele reage aos eventos de gatilho.
+ * @param deltaTime O tempo decorrido desde o último quadro.
+ * @param gameStateManager O gerenciador de estado do jogo.
+ */
+void ShapeSocket::update(float deltaTime, GameStateManager& gameStateManager) {
+}
+
+/**
+ * @brief Registra o encaixe no pacote do quadro. A cor indica se ele está ocupado.
+ * @param packet O pacote do quadro sendo montado pela simulação.
+ */
+void ShapeSocket::collectDrawItems(RenderPacket& packet) {
+    DrawItem item(this, _transform);
+    item.color = isFilled() ? _color : Vector3f{_color.x * 0.35f, _color.y * 0.35f, _color.z * 0.35f};
+    packet.items.push_back(item);
+}
+
+/**
+ * @brief Desenha a placa do encaixe, rente ao chão.
+ * @param item O item com a posição e a cor capturadas na simulação.
+ */
+void ShapeSocket::draw(const DrawItem& item) {
+    glColor3f(item.color.x, item.color.y, item.color.z);
+    glutSolidCube(1.0);
+}
+
+/**
+ * @brief Coloca a forma esperada no encaixe, se o jogador a estiver carregando.
+ *
+ * A forma é solta logo acima do encaixe; a física a assenta e o gatilho
+ * registra a entrada no próximo passo.
+ *
+ * @param gameStateManager O gerenciador de estado do jogo.
+ */
+void ShapeSocket::onClick(GameStateManager& gameStateManager) {
+    if (!_expectedShape || !_expectedShape->isCarried()) {
+        std::cout << "Este encaixe espera outra forma." << std::endl;
+        return;
+    }
+    _expectedShape->dropAt({_position.x, _position.y + TRIGGER_HEIGHT, _position.z}, gameStateManager);
+}
+
+/**
+ * @brief Obtém o raio de interação do encaixe.
+ * @return O raio de colisão.
+ */
+float ShapeSocket::getCollisionRadius() const {
+    return SOCKET_HALF_SIZE * 1.2f;
+}
+
+/**
+ * @brief Obtém a caixa delimitadora da placa.
+ * @return A caixa da placa.
+ */
+BoundingBox ShapeSocket::getBoundingBox() const {
+    return {{_position.x - SOCKET_HALF_SIZE, _position.y, _position.z - SOCKET_HALF_SIZE},
+            {_position.x + SOCKET_HALF_SIZE, _position.y + SOCKET_THICKNESS, _position.z + SOCKET_HALF_SIZE}};
+}
+
+/**
+ * @brief Obtém o volume de gatilho: a área da placa até a altura TRIGGER_HEIGHT.
+ * @return O volume monitorado.
+ */
+BoundingBox ShapeSocket::getTriggerVolume() const {
+    return {{_position.x - SOCKET_HALF_SIZE, _position.y, _position.z - SOCKET_HALF_SIZE},
+            {_position.x + SOCKET_HALF_SIZE, _position.y + TRIGGER_HEIGHT, _position.z + SOCKET_HALF_SIZE}};
+}
+
+/**
+ * @brief Indica se um objeto conta para ocupar o encaixe.
+ * @param other O objeto (nullptr para o jogador).
+ */
+bool ShapeSocket::accepts(GameObject* other) const {
+    if (!_expectedShape) return true; // Placa de pressão: qualquer coisa serve
+    return other == _expectedShape;
+}
+
+/**
+ * @brief Atualiza a ocupação do encaixe e o estado do puzzle do grupo.
+ * @param event O tipo do evento.
+ * @param other O objeto que causou o evento.
+ * @param gameStateManager O gerenciador de estado do jogo.
+ */
+void ShapeSocket::onTriggerEvent(TriggerEvent event, GameObject* other, GameStateManager& gameStateManager) {
+    if (event == TriggerEvent::STAY || !accepts(other)) return;
+
+    bool wasFilled = isFilled();
+    _occupants += (event == TriggerEvent::ENTER) ? 1 : -1;
+    if (isFilled() == wasFilled) return;
+
+    bool solved = true;
+    for (const ShapeSocket* socket : _group) {
+        if (!socket->isFilled()) solved = false;
+    }
+    if (!_puzzleId.empty()) {
+        gameStateManager.setPuzzleState(_puzzleId, solved);
+    }
+}
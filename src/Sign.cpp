@@ -3,6 +3,7 @@
  * @brief Implementao da classe Sign, que representa uma placa de madeira com texto.
  */
 #include "../include/Sign.h"
+#include "../include/MeshManager.h"
 #include <GL/freeglut.h>
 
 #include <sstream>   // istringstream
@@ -16,59 +17,19 @@
 // VISUAL DA PLACA
 // =======================
 
-/**
- * @brief Desenha uma corda simples como um cilindro.
- * @param x A coordenada x do topo da corda.
- * @param yTop A coordenada y do topo da corda.
- * @param z A coordenada z do topo da corda.
- * @param length O comprimento da corda.
- */
-static void drawRope(float x, float yTop, float z, float length) {
-    GLUquadric* q = gluNewQuadric();
-    glColor3f(0.55f, 0.38f, 0.20f);
-    glPushMatrix();
-      glTranslatef(x, yTop - length*0.5f, z);
-      glRotatef(90, 1,0,0);
-      gluCylinder(q, 0.03, 0.03, length, 10, 1);
-    glPopMatrix();
-    gluDeleteQuadric(q);
-}
+// dimenses da placa
+static const float BOARD_W     = 3.0f;
+static const float BOARD_H     = 1.30f;
+static const float THICK       = 0.10f;
+static const float ROPE_TOP    = 2.3f;
+static const float ROPE_LENGTH = 0.8f;
 
 /**
- * @brief Desenha a placa de madeira com ripas e cordas.
- *
- * A placa  composta por mltiplas tbuas horizontais com uma leve variao de cor.
- *  desenhada com as cordas para pendurar.
- *
- * @param pos A posio do centro da placa.
- * @param width A largura total da placa.
- * @param height A altura total da placa.
- * @param thick A espessura da placa.
+ * @brief Desenha uma corda simples como um cilindro, a partir da origem local.
+ * @param lod O nvel de detalhe do cilindro.
  */
-static void drawWoodBoard(const Vector3f& pos, float width=2.9f, float height=1.25f, float thick=0.10f) {
-    glDisable(GL_LIGHTING);
-    glPushMatrix();
-    glTranslatef(pos.x, pos.y, pos.z);
-
-    // cordas
-    drawRope(-width*0.35f, 2.3f, 0.0f, 0.8f);
-    drawRope( width*0.35f, 2.3f, 0.0f, 0.8f);
-
-    // tbuas
-    int boards = 5;
-    float h = height / boards;
-    for (int i=0;i<boards;i++){
-        float y = 1.5f + ( (boards-1)/2.0f - i ) * h; // centro de cada ripa
-        float t = 0.78f + 0.05f*std::sin(i*1.7f);
-        glColor3f(0.55f*t, 0.33f*t, 0.18f*t);
-        glPushMatrix();
-          glTranslatef(0.0f, y, 0.0f);
-          glScalef(width, h*0.95f, thick);
-          glutSolidCube(1.0);
-        glPopMatrix();
-    }
-
-    glPopMatrix();
+static void drawRope(int lod) {
+    MeshManager::drawCylinder(0.03f, ROPE_LENGTH, lod);
 }
 
 // ===============
@@ -126,43 +87,37 @@ static std::vector<std::string> wrapStroke(const std::string& text, int maxWidth
 /**
  * @brief Desenha uma nica linha de texto centralizada.
  *
- * Desenha o texto com a fonte GLUT_STROKE_ROMAN e aplica um efeito de
- * "negrito" desenhando a linha mltiplas vezes com um pequeno deslocamento.
+ * Desenha o texto com a fonte GLUT_STROKE_ROMAN numa nica passada, com um trao
+ * mais largo para o "negrito"; o FXAA do ps-processamento suaviza as bordas.
  *
  * @param s A string a ser desenhada.
  * @param cx A coordenada x do centro horizontal.
  * @param cy A coordenada y do centro vertical.
  * @param cz A coordenada z.
  * @param scale O fator de escala do texto.
- * @param rgb Um array de 3 floats para a cor do texto.
+ * @param rgb A cor do texto.
  */
 static void drawStrokeCenteredLine(const std::string& s,
                                    float cx, float cy, float cz,
-                                   float scale, const float rgb[3]) {
-    glPushAttrib(GL_ENABLE_BIT | GL_LIGHTING_BIT | GL_CURRENT_BIT | GL_LINE_BIT);
+                                   float scale, const Vector3f& rgb) {
+    glPushAttrib(GL_ENABLE_BIT | GL_LIGHTING_BIT | GL_CURRENT_BIT | GL_LINE_BIT | GL_DEPTH_BUFFER_BIT);
     glDisable(GL_LIGHTING);
-    glDisable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LEQUAL); // as tbuas so empurradas para trs com glPolygonOffset
 
     // cor e espessura do trao
-    glColor3f(rgb[0], rgb[1], rgb[2]);
-    glLineWidth(1.5f);
+    glColor3f(rgb.x, rgb.y, rgb.z);
+    glLineWidth(2.0f);
 
     // centraliza horizontalmente
     int w = 0; for (unsigned char c : s) w += glutStrokeWidth(GLUT_STROKE_ROMAN, c);
     float x = cx - (w * 0.5f * scale);
     float z = cz + 0.065f; //  frente da madeira
 
-    // desenha 3 passadas com micro-offset para reforar o contraste
-    const float off = 0.0007f;
-    for (int pass = 0; pass < 3; ++pass) {
-        float ox = (pass == 1 ? off : 0.0f);
-        float oy = (pass == 2 ? off : 0.0f);
-        glPushMatrix();
-          glTranslatef(x + ox, cy + oy, z);
-          glScalef(scale, scale, scale);
-          for (unsigned char c : s) glutStrokeCharacter(GLUT_STROKE_ROMAN, c);
-        glPopMatrix();
-    }
+    glPushMatrix();
+      glTranslatef(x, cy, z);
+      glScalef(scale, scale, scale);
+      for (unsigned char c : s) glutStrokeCharacter(GLUT_STROKE_ROMAN, c);
+    glPopMatrix();
 
     glPopAttrib();
 }
@@ -174,41 +129,116 @@ static void drawStrokeCenteredLine(const std::string& s,
 
 /**
  * @brief Construtor da classe Sign.
+ *
+ * Monta as peas da placa (duas cordas, as tbuas e o texto) como filhas da
+ * transformao da placa, em coordenadas locais.
+ *
  * @param pos A posio da placa.
  * @param text A string de texto a ser exibida.
  */
 Sign::Sign(const Vector3f& pos, const std::string& text)
-: InteractableObject(pos), _pos(pos), _text(text) {}
+: InteractableObject(pos), _pos(pos), _text(text), _root(pos),
+  _impostor({{-BOARD_W * 0.5f - 0.05f, 0.80f, -THICK * 0.5f - 0.01f}, {BOARD_W * 0.5f + 0.05f, 2.20f, 0.08f}}),
+  _textScale(0.0f), _textReady(false), _ropeLod(0) {
+    const Quaternion hanging = Quaternion::fromAxisAngle({1.0f, 0.0f, 0.0f}, 90.0f); // cilindro ao longo de -Y
+    _parts[ROPE_LEFT]  = Transform({-BOARD_W * 0.35f, ROPE_TOP - ROPE_LENGTH * 0.5f, 0.0f});
+    _parts[ROPE_RIGHT] = Transform({ BOARD_W * 0.35f, ROPE_TOP - ROPE_LENGTH * 0.5f, 0.0f});
+    _parts[ROPE_LEFT].setRotation(hanging);
+    _parts[ROPE_RIGHT].setRotation(hanging);
+    _partColors[ROPE_LEFT] = _partColors[ROPE_RIGHT] = {0.55f, 0.38f, 0.20f};
+
+    // tbuas, com uma leve variao de cor
+    const float h = BOARD_H / BOARDS;
+    for (int i = 0; i < BOARDS; ++i) {
+        float y = 1.5f + ((BOARDS - 1) / 2.0f - i) * h; // centro de cada ripa
+        float t = 0.78f + 0.05f * std::sin(i * 1.7f);
+        _parts[BOARD_FIRST + i] = Transform({0.0f, y, 0.0f}, {BOARD_W, h * 0.95f, THICK});
+        _partColors[BOARD_FIRST + i] = {0.55f * t, 0.33f * t, 0.18f * t};
+    }
+
+    _parts[TEXT] = Transform();
+    _partColors[TEXT] = {0.07f, 0.06f, 0.05f};
+
+    for (int part = 0; part < PART_COUNT; ++part) {
+        _parts[part].setParent(&_root);
+        _partLocal[part] = _parts[part].getLocalMatrix();
+    }
+}
 
 /**
- * @brief Renderiza a placa e o texto na tela.
- *
- * O mtodo desenha a base de madeira e, em seguida, quebra e desenha o texto
- * de forma que ele se ajuste  placa.
+ * @brief Registra cada pea da placa como um item do pacote, ou um nico item
+ * para o impostor quando a placa est longe.
+ * @param packet O pacote do quadro sendo montado pela simulao.
  */
-void Sign::render() {
-    // dimenses da placa
-    const float BOARD_W = 3.0f;
-    const float BOARD_H = 1.30f;
-    const float THICK   = 0.10f;
-    const int   BOARDS  = 5;
-
-    // desenha a madeira
-    drawWoodBoard(_pos, BOARD_W, BOARD_H, THICK);
-
-    // centros das 5 tbuas em coordenadas de mundo
-    std::vector<float> yCenter(BOARDS);
-    {
-        const float yMid = _pos.y + 1.5f;
-        const float step = BOARD_H / BOARDS;
-        for (int i = 0; i < BOARDS; ++i) {
-            float top    =  (BOARD_H*0.5f) - i*step;
-            float bottom =  top - step;
-            float yLocalCenter = (top + bottom) * 0.5f;
-            yCenter[i] = yMid + yLocalCenter;
-        }
+void Sign::collectDrawItems(RenderPacket& packet) {
+    if (_impostor.select(packet.camera.position, _parts[BOARD_FIRST + BOARDS / 2].getWorldPosition())) {
+        packet.items.push_back(DrawItem(this, _root, IMPOSTOR));
+        return;
+    }
+
+    // As duas cordas ficam lado a lado e usam o mesmo nvel.
+    _ropeLod = MeshManager::selectLod(packet.camera.position, _parts[ROPE_LEFT].getWorldPosition(),
+                                      ROPE_LENGTH * 0.5f, _ropeLod);
+
+    for (int part = 0; part < PART_COUNT; ++part) {
+        DrawItem item(this, _parts[part], part);
+        item.color = _partColors[part];
+        if (part == ROPE_LEFT || part == ROPE_RIGHT) item.lod = _ropeLod;
+        if (part == TEXT) item.layer = DrawLayer::Overlay; // por cima das tbuas, depois delas
+        packet.items.push_back(item);
+    }
+}
+
+/**
+ * @brief Desenha uma pea da placa, sem iluminao.
+ * @param item O item com a pea, a matriz e a cor.
+ */
+void Sign::draw(const DrawItem& item) {
+    if (item.part == IMPOSTOR) {
+        _impostor.draw([this](const Matrix4& view) { drawParts(view); });
+        return;
     }
+    if (item.part == TEXT) {
+        drawText(item.color);
+        return;
+    }
+
+    glPushAttrib(GL_ENABLE_BIT | GL_CURRENT_BIT | GL_POLYGON_BIT);
+    glDisable(GL_LIGHTING);
+    glColor3f(item.color.x, item.color.y, item.color.z);
+    if (item.part == ROPE_LEFT || item.part == ROPE_RIGHT) {
+        drawRope(item.lod);
+    } else {
+        // Tbua: um pouco mais funda no depth buffer, para o texto no brigar com ela.
+        glEnable(GL_POLYGON_OFFSET_FILL);
+        glPolygonOffset(1.0f, 1.0f);
+        glutSolidCube(1.0);
+    }
+    glPopAttrib();
+}
 
+/**
+ * @brief Desenha todas as peas, no nvel de detalhe mais alto (a foto do impostor).
+ * @param view Leva as coordenadas locais da placa para as da cmera.
+ */
+void Sign::drawParts(const Matrix4& view) {
+    for (int part = 0; part < PART_COUNT; ++part) {
+        DrawItem item(this);
+        item.transform = _partLocal[part];
+        item.color = _partColors[part];
+        item.part = part;
+        glLoadMatrixf((view * _partLocal[part]).m);
+        draw(item);
+    }
+}
+
+/**
+ * @brief Quebra o texto em linhas que caibam nas tbuas.
+ *
+ * Chamado na primeira vez que o texto  desenhado: as medidas da fonte do GLUT
+ * exigem o GLUT inicializado, e o resultado no muda depois disso.
+ */
+void Sign::layoutText() {
     // rea til horizontal (margem dentro da madeira)
     const float MARGIN_X = 0.30f;
     const float usableW  = BOARD_W - 2.0f * MARGIN_X;
@@ -236,31 +266,33 @@ void Sign::render() {
 
     // auto-fit final: garante que a maior linha caiba na largura til
     int wmax = 1; for (auto &s : wrapped) wmax = std::max(wmax, strokeWidth(s));
-    float scaleFit     = usableW / float(wmax);
-    float finalScale = std::min(baseScale, scaleFit);
+    float scaleFit = usableW / float(wmax);
+
+    _textScale = std::min(baseScale, scaleFit);
+    _lines = wrapped;
+    _textReady = true;
+}
 
-    // cor do texto
-    const float rgb[3] = {0.07f, 0.06f, 0.05f};
+/**
+ * @brief Desenha o texto centralizado nas tbuas, em coordenadas locais da placa.
+ * @param rgb A cor do texto.
+ */
+void Sign::drawText(const Vector3f& rgb) {
+    if (!_textReady) layoutText();
 
     // desenha centralizado: usa as tbuas do MEIO quando houver < 5 linhas
-    const int linesToDraw = std::min((int)wrapped.size(), BOARDS);
+    const int linesToDraw = std::min<int>((int)_lines.size(), BOARDS);
     int startBoard = (BOARDS - linesToDraw) / 2;
     const float TOP_NUDGE = 0.030f;
+    const float step = BOARD_H / BOARDS;
 
     for (int i = 0; i < linesToDraw; ++i) {
         int boardIndex = startBoard + i;
 
-        // se esta for a PRIMEIRA linha do pargrafo, desce um pouco
-        float y = yCenter[boardIndex];
+        // centro da tbua; se esta for a PRIMEIRA linha do pargrafo, desce um pouco
+        float y = 1.5f + ((BOARDS - 1) / 2.0f - boardIndex) * step;
         if (i == 0) y -= TOP_NUDGE;
 
-        drawStrokeCenteredLine(
-            wrapped[i],
-            _pos.x,
-            y,
-            _pos.z,
-            finalScale,
-            rgb
-        );
+        drawStrokeCenteredLine(_lines[i], 0.0f, y, 0.0f, _textScale, rgb);
     }
 }
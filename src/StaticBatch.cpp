@@ -0,0 +1,155 @@
+/**
+ * @file StaticBatch.cpp
+ * @brief Implementação do StaticBatch, o lote de geometria estática de uma sala.
+ */
+
+#include "../include/StaticBatch.h"
+#include "../include/Wall.h"
+#include "../include/GLExtensions.h"
+#include "../include/VectorMath.h"
+#include <GL/freeglut.h>
+#include <algorithm>
+
+StaticBatch::StaticBatch() : _list(0), _atlasVersion(0), _lightmap(nullptr), _firstSurface(0), _listBaked(false) {}
+
+/**
+ * @brief Inclui uma parede no lote.
+ *
+ * A display list é compilada na primeira vez que o lote for desenhado, na
+ * thread de OpenGL.
+ *
+ * @param wall A parede.
+ */
+void StaticBatch::addWall(const Wall* wall) {
+    _walls.push_back(wall);
+    _atlasVersion = 0;
+}
+
+bool StaticBatch::isEmpty() const {
+    return _walls.empty();
+}
+
+/**
+ * @brief Os quadriláteros das paredes, em coordenadas de mundo.
+ *
+ * As faces internas das paredes (voltadas para dentro da própria caixa) só
+ * aparecem com a câmera dentro da parede, então não recebem texels.
+ */
+void StaticBatch::collectBakeSurfaces(std::vector<BakeSurface>& out) {
+    _firstSurface = static_cast<int>(out.size());
+    for (const Wall* wall : _walls) {
+        const Matrix4& world = wall->getWorldMatrix();
+        const BoundingBox box = wall->getBoundingBox();
+        const Vector3f boxCenter = (box.min + box.max) * 0.5f;
+        const std::vector<StaticVertex>& geometry = wall->getGeometry();
+        for (size_t k = 0; k + 3 < geometry.size(); k += 4) {
+            const Vector3f a = world.transformPoint(geometry[k].position);
+            const Vector3f b = world.transformPoint(geometry[k + 1].position);
+            const Vector3f c = world.transformPoint(geometry[k + 2].position);
+            const Vector3f d = world.transformPoint(geometry[k + 3].position);
+            const Vector3f normal = normalize(world.transformDirection(geometry[k].normal));
+            const bool hidden = dot(normal, boxCenter - (a + c) * 0.5f) > 0.0f;
+            out.push_back({a, b - a, d - a, normal, {1.0f, 1.0f, 1.0f}, hidden});
+        }
+    }
+}
+
+void StaticBatch::setLightmap(Lightmap* lightmap) {
+    _lightmap = lightmap;
+}
+
+/**
+ * @brief Compila a display list com todas as paredes, em coordenadas de mundo.
+ * @param baked Se a lista deve levar as coordenadas do lightmap.
+ */
+void StaticBatch::build(bool baked) {
+    if (_list == 0) _list = glGenLists(1);
+
+    glNewList(_list, GL_COMPILE);
+    glBegin(GL_QUADS);
+    int surface = _firstSurface;
+    for (const Wall* wall : _walls) {
+        const Matrix4& world = wall->getWorldMatrix();
+        emitVertices(wall->getGeometry(), TextureManager::getMaterialRegion(wall->getMaterial()), &world,
+                     baked ? _lightmap : nullptr, surface);
+        surface += static_cast<int>(wall->getGeometry().size() / 4);
+    }
+    glEnd();
+    glEndList();
+
+    _atlasVersion = TextureManager::getAtlasVersion();
+    _listBaked = baked;
+}
+
+void StaticBatch::collectDrawItems(RenderPacket& packet) {
+    DrawItem item(this);
+    item.layer = DrawLayer::Enclosing;
+    packet.items.push_back(item);
+}
+
+/**
+ * @brief Desenha todas as paredes do lote com o atlas.
+ *
+ * A display list é recompilada se o atlas tiver sido remontado (as áreas dos
+ * materiais podem ter mudado) ou se o lightmap passar a valer.
+ *
+ * @param item O item do pacote (matriz identidade: o lote está em coordenadas de mundo).
+ */
+void StaticBatch::draw(const DrawItem& item) {
+    GLuint atlas = TextureManager::getAtlasTexture();
+    const bool baked = _lightmap && _lightmap->bind();
+    if (_list == 0 || _atlasVersion != TextureManager::getAtlasVersion() || _listBaked != baked) {
+        build(baked);
+    }
+
+    glColor3f(1.0f, 1.0f, 1.0f);
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, atlas);
+    glCallList(_list);
+    if (baked) {
+        Lightmap::unbind();
+    } else {
+        glDisable(GL_TEXTURE_2D);
+    }
+}
+
+/**
+ * @brief A caixa que envolve todas as paredes do lote.
+ */
+BoundingBox StaticBatch::getBoundingBox() const {
+    if (_walls.empty()) return {{0,0,0}, {0,0,0}};
+
+    BoundingBox box = _walls[0]->getBoundingBox();
+    for (const Wall* wall : _walls) {
+        BoundingBox wallBox = wall->getBoundingBox();
+        box.min = {std::min(box.min.x, wallBox.min.x), std::min(box.min.y, wallBox.min.y), std::min(box.min.z, wallBox.min.z)};
+        box.max = {std::max(box.max.x, wallBox.max.x), std::max(box.max.y, wallBox.max.y), std::max(box.max.z, wallBox.max.z)};
+    }
+    return box;
+}
+
+/**
+ * @brief Emite os vértices, convertendo (s, t) para a área do material no atlas.
+ */
+void StaticBatch::emitVertices(const std::vector<StaticVertex>& vertices, const MaterialRegion& region,
+                               const Matrix4* transform, const Lightmap* lightmap, int firstSurface) {
+    const float du = region.u1 - region.u0;
+    const float dv = region.v1 - region.v0;
+    for (size_t k = 0; k < vertices.size(); ++k) {
+        const StaticVertex& vertex = vertices[k];
+        Vector3f position = transform ? transform->transformPoint(vertex.position) : vertex.position;
+        Vector3f normal = transform ? transform->transformDirection(vertex.normal) : vertex.normal;
+        glNormal3f(normal.x, normal.y, normal.z);
+        if (lightmap) {
+            // Cantos do quadrilátero na ordem da superfície: origem, +U, +U+V, +V.
+            const LightmapRect& rect = lightmap->getRect(firstSurface + static_cast<int>(k / 4));
+            const int corner = static_cast<int>(k % 4);
+            GLExtensions::multiTexCoord2f(GL_TEXTURE0, (corner == 1 || corner == 2) ? rect.u1 : rect.u0,
+                                          (corner >= 2) ? rect.v1 : rect.v0);
+            GLExtensions::multiTexCoord2f(GL_TEXTURE1, region.u0 + vertex.s * du, region.v0 + vertex.t * dv);
+        } else {
+            glTexCoord2f(region.u0 + vertex.s * du, region.v0 + vertex.t * dv);
+        }
+        glVertex3f(position.x, position.y, position.z);
+    }
+}
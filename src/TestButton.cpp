@@ -36,12 +36,11 @@ void TestButton::update(float deltaTime, GameStateManager& gameStateManager) {
 }
 
 /**
- * @brief Renderiza o boto na tela.
- *
- * Delega o desenho do objeto visual (`_visual`) para sua prpria funo de renderizao.
+ * @brief Registra o objeto visual do boto no pacote do quadro.
+ * @param packet O pacote do quadro sendo montado pela simulao.
  */
-void TestButton::render() {
-    _visual.render();
+void TestButton::collectDrawItems(RenderPacket& packet) {
+    _visual.collectDrawItems(packet);
 }
 
 /**
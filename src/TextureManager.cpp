@@ -12,8 +12,12 @@
 #include "../include/stb_image.h"
 
 #include "../include/TextureManager.h"
+#include "../include/Config.h"
+#include "../include/GLExtensions.h"
 #include <GL/freeglut.h>
+#include <algorithm>
 #include <cstdio>
+#include <cmath>
 #include <cstring>
 #include <iostream>
 #include <string>
@@ -26,6 +30,13 @@
  * A chave  o nome do arquivo da textura e o valor  o identificador OpenGL da textura (GLuint).
  */
 std::unordered_map<std::string, GLuint> TextureManager::_textures;
+std::unordered_map<std::string, int> TextureManager::_materialIds;
+std::vector<std::string> TextureManager::_materialFiles(1); // material 0: branco
+std::vector<MaterialRegion> TextureManager::_materialRegions;
+GLuint TextureManager::_atlas = 0;
+bool TextureManager::_atlasDirty = true;
+unsigned int TextureManager::_atlasVersion = 0;
+int TextureManager::_filterTier = TextureManager::FILTER_TIERS - 1;
 
 /**
  * @brief Checa a existncia de um arquivo de forma porttil.
@@ -148,3 +159,191 @@ GLuint TextureManager::loadTexture(const std::string& filename) {
               << " (" << width << "x" << height << ", ch=" << channels << ")\n";
     return tex;
 }
+
+// ===============
+// ATLAS DE MATERIAIS
+// ===============
+
+/**
+ * @brief Obtm o ID de material de um arquivo de textura.
+ *
+ * S registra o arquivo; a imagem  lida quando o atlas for montado, na thread de
+ * OpenGL. Um nome vazio  o material 0 (branco).
+ *
+ * @param filename O nome do arquivo da textura.
+ * @return O ID do material.
+ */
+int TextureManager::getMaterial(const std::string& filename) {
+    if (filename.empty()) return 0;
+
+    auto it = _materialIds.find(filename);
+    if (it != _materialIds.end()) return it->second;
+
+    int id = static_cast<int>(_materialFiles.size());
+    _materialFiles.push_back(filename);
+    _materialIds[filename] = id;
+    _atlasDirty = true;
+    return id;
+}
+
+/**
+ * @brief Reamostra uma imagem RGB para um quadrado de `size` pixels.
+ *
+ * Cada pixel de destino  a mdia dos pixels de origem que ele cobre (ou o pixel
+ * mais prximo, ao ampliar). A proporo da imagem no importa: as coordenadas de
+ * textura j vo de 0 a 1 nos dois eixos.
+ */
+static void resampleToSquare(const unsigned char* src, int width, int height, int size, unsigned char* dst) {
+    for (int y = 0; y < size; ++y) {
+        int y0 = y * height / size;
+        int y1 = std::max(y0 + 1, (y + 1) * height / size);
+        for (int x = 0; x < size; ++x) {
+            int x0 = x * width / size;
+            int x1 = std::max(x0 + 1, (x + 1) * width / size);
+            unsigned int sum[3] = {0, 0, 0};
+            for (int sy = y0; sy < y1; ++sy) {
+                const unsigned char* row = src + (static_cast<size_t>(sy) * width + x0) * 3;
+                for (int sx = x0; sx < x1; ++sx, row += 3) {
+                    sum[0] += row[0];
+                    sum[1] += row[1];
+                    sum[2] += row[2];
+                }
+            }
+            unsigned int count = static_cast<unsigned int>((y1 - y0) * (x1 - x0));
+            unsigned char* out = dst + (static_cast<size_t>(y) * size + x) * 3;
+            out[0] = static_cast<unsigned char>(sum[0] / count);
+            out[1] = static_cast<unsigned char>(sum[1] / count);
+            out[2] = static_cast<unsigned char>(sum[2] / count);
+        }
+    }
+}
+
+/**
+ * @brief Monta o atlas com todos os materiais registrados.
+ *
+ * Cada material ocupa uma clula quadrada de uma grade: a imagem reamostrada para
+ * Config::ATLAS_TILE_SIZE pixels, cercada por Config::ATLAS_PADDING pixels copiados
+ * do lado oposto da prpria imagem. Com essa borda "enrolada", a filtragem linear
+ * na emenda entre duas repeties l os mesmos texels que leria com GL_REPEAT. A
+ * repetio em si  feita pela geometria (ver Wall), que  dividida para que cada
+ * quadriltero cubra no mximo uma repetio da textura.
+ *
+ * Materiais cujo arquivo no pde ser lido ficam brancos, como antes.
+ */
+void TextureManager::buildAtlas() {
+    const int count = static_cast<int>(_materialFiles.size());
+    const int columns = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(count))));
+    const int rows = (count + columns - 1) / columns;
+
+    GLint maxSize = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+    int tile = Config::ATLAS_TILE_SIZE;
+    const int pad = Config::ATLAS_PADDING;
+    while (tile > 16 && std::max(columns, rows) * (tile + 2 * pad) > maxSize) {
+        tile /= 2;
+    }
+    const int cell = tile + 2 * pad;
+
+    int atlasWidth = 1, atlasHeight = 1;
+    while (atlasWidth < columns * cell) atlasWidth <<= 1;
+    while (atlasHeight < rows * cell) atlasHeight <<= 1;
+
+    std::vector<unsigned char> pixels(static_cast<size_t>(atlasWidth) * atlasHeight * 3, 255);
+    std::vector<unsigned char> tilePixels(static_cast<size_t>(tile) * tile * 3);
+    _materialRegions.assign(count, MaterialRegion{0.0f, 0.0f, 0.0f, 0.0f});
+
+    stbi_set_flip_vertically_on_load(1);
+    for (int id = 0; id < count; ++id) {
+        std::fill(tilePixels.begin(), tilePixels.end(), 255);
+        if (id > 0) {
+            std::string path = resolveTexturePath(_materialFiles[id]);
+            int width = 0, height = 0, channels = 0;
+            unsigned char* data = path.empty() ? nullptr : stbi_load(path.c_str(), &width, &height, &channels, 3);
+            if (data) {
+                resampleToSquare(data, width, height, tile, tilePixels.data());
+                stbi_image_free(data);
+                std::cerr << "[Texture] Atlas: " << _materialFiles[id] << " -> material " << id << "\n";
+            } else {
+                std::cerr << "[Texture] Material sem imagem (branco): " << _materialFiles[id] << "\n";
+            }
+        }
+
+        // Copia a clula com a borda enrolada.
+        const int cellX = (id % columns) * cell;
+        const int cellY = (id / columns) * cell;
+        for (int y = 0; y < cell; ++y) {
+            int sy = ((y - pad) % tile + tile) % tile;
+            for (int x = 0; x < cell; ++x) {
+                int sx = ((x - pad) % tile + tile) % tile;
+                const unsigned char* in = &tilePixels[(static_cast<size_t>(sy) * tile + sx) * 3];
+                unsigned char* out = &pixels[(static_cast<size_t>(cellY + y) * atlasWidth + cellX + x) * 3];
+                out[0] = in[0];
+                out[1] = in[1];
+                out[2] = in[2];
+            }
+        }
+
+        MaterialRegion& region = _materialRegions[id];
+        region.u0 = static_cast<float>(cellX + pad) / atlasWidth;
+        region.v0 = static_cast<float>(cellY + pad) / atlasHeight;
+        region.u1 = static_cast<float>(cellX + pad + tile) / atlasWidth;
+        region.v1 = static_cast<float>(cellY + pad + tile) / atlasHeight;
+    }
+
+    if (_atlas == 0) glGenTextures(1, &_atlas);
+    glBindTexture(GL_TEXTURE_2D, _atlas);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    gluBuild2DMipmaps(GL_TEXTURE_2D, GL_RGB, atlasWidth, atlasHeight, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+    applyFilter();
+
+    _atlasDirty = false;
+    ++_atlasVersion;
+    std::cerr << "[Texture] Atlas " << atlasWidth << "x" << atlasHeight << " com " << count << " materiais\n";
+}
+
+/**
+ * @brief Obtm o atlas de materiais, montando-o se houver materiais novos.
+ * @return O identificador OpenGL do atlas.
+ */
+GLuint TextureManager::getAtlasTexture() {
+    if (_atlasDirty) buildAtlas();
+    return _atlas;
+}
+
+/**
+ * @brief Obtm a rea de um material no atlas.
+ * @param material O ID do material.
+ * @return A rea; um ID desconhecido usa o material 0 (branco).
+ */
+MaterialRegion TextureManager::getMaterialRegion(int material) {
+    if (material < 0 || material >= static_cast<int>(_materialRegions.size())) material = 0;
+    return _materialRegions.empty() ? MaterialRegion{0.0f, 0.0f, 0.0f, 0.0f} : _materialRegions[material];
+}
+
+unsigned int TextureManager::getAtlasVersion() {
+    return _atlasVersion;
+}
+
+void TextureManager::setFilterTier(int tier) {
+    tier = std::max(0, std::min(tier, FILTER_TIERS - 1));
+    if (tier == _filterTier) return;
+    _filterTier = tier;
+    if (_atlas != 0) applyFilter();
+}
+
+/**
+ * @brief Aplica a filtragem de _filterTier ao atlas (que fica vinculado).
+ *
+ * O preenchimento em volta de cada material (Config::ATLAS_PADDING) cobre os
+ * primeiros nveis de mipmap; nos menores, as bordas dos materiais se misturam,
+ * o que s aparece em superfcies muito distantes.
+ */
+void TextureManager::applyFilter() {
+    glBindTexture(GL_TEXTURE_2D, _atlas);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                    _filterTier >= 2 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR_MIPMAP_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, _filterTier >= 1 ? 0 : 1);
+}
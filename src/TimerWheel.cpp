@@ -0,0 +1,267 @@
+/**
+ * @file TimerWheel.cpp
+ * @brief Implementação da roda hierárquica de timers.
+ */
+
+#include "../include/TimerWheel.h"
+#include <algorithm>
+
+/**
+ * @brief Construtor: roda vazia, relógio em 0 e não pausada.
+ */
+TimerWheel::TimerWheel() : _now(0), _fraction(0.0f), _sequence(0), _pending(0), _fired(0), _paused(false) {
+    std::fill(_heads, _heads + LEVELS * SLOTS, -1);
+    std::fill(_tails, _tails + LEVELS * SLOTS, -1);
+}
+
+// --- AGENDAMENTO ---
+
+/**
+ * @brief Agenda um callback de disparo único.
+ * @param delayMs O atraso, em ms de simulação.
+ * @param callback A função a chamar.
+ * @return O identificador do timer.
+ */
+TimerWheel::TimerId TimerWheel::schedule(uint32_t delayMs, Callback callback) {
+    return add(delayMs, 0, std::move(callback));
+}
+
+/**
+ * @brief Agenda um callback que se repete.
+ * @param intervalMs O intervalo, em ms de simulação.
+ * @param callback A função a chamar.
+ * @return O identificador do timer.
+ */
+TimerWheel::TimerId TimerWheel::scheduleRepeating(uint32_t intervalMs, Callback callback) {
+    if (intervalMs == 0) intervalMs = 1;
+    return add(intervalMs, intervalMs, std::move(callback));
+}
+
+TimerWheel::TimerId TimerWheel::add(uint32_t delayMs, uint32_t interval, Callback callback) {
+    int index;
+    if (!_freeList.empty()) {
+        index = _freeList.back();
+        _freeList.pop_back();
+    } else {
+        index = static_cast<int>(_timers.size());
+        _timers.push_back(Timer());
+        _timers[index].generation = 0;
+    }
+
+    Timer& timer = _timers[index];
+    timer.due = _now + std::max<uint32_t>(delayMs, 1);
+    timer.sequence = _sequence++;
+    timer.interval = interval;
+    timer.generation += 1;
+    timer.callback = std::move(callback);
+    insert(index);
+    ++_pending;
+
+    return (static_cast<TimerId>(timer.generation) << 32) | static_cast<TimerId>(index + 1);
+}
+
+/**
+ * @brief Converte um identificador no índice do timer, se ele ainda for válido.
+ * @return O índice, ou -1.
+ */
+int TimerWheel::find(TimerId id) const {
+    if (id == INVALID_TIMER) return -1;
+    int index = static_cast<int>(id & 0xFFFFFFFFu) - 1;
+    uint32_t generation = static_cast<uint32_t>(id >> 32);
+    if (index < 0 || index >= static_cast<int>(_timers.size())) return -1;
+    const Timer& timer = _timers[index];
+    if (timer.slot == FREE || timer.generation != generation) return -1;
+    return index;
+}
+
+/**
+ * @brief Cancela um timer pendente.
+ *
+ * Pode ser chamado de dentro de um callback, inclusive para o próprio timer ou
+ * para outro que venceria no mesmo milissegundo.
+ *
+ * @param id O identificador do timer.
+ * @return false se o timer não estava mais pendente.
+ */
+bool TimerWheel::cancel(TimerId id) {
+    int index = find(id);
+    if (index < 0) return false;
+    if (_timers[index].slot != FIRING) unlink(index);
+    release(index);
+    return true;
+}
+
+/**
+ * @brief Indica se o timer ainda vai disparar.
+ * @param id O identificador do timer.
+ */
+bool TimerWheel::isPending(TimerId id) const {
+    return find(id) >= 0;
+}
+
+// --- LISTAS DA RODA ---
+
+/**
+ * @brief Coloca o timer na posição da roda correspondente ao seu vencimento.
+ *
+ * O nível é o menor cujo alcance cobre o tempo restante; a posição dentro do nível
+ * vem dos bits do próprio instante de vencimento.
+ */
+void TimerWheel::insert(int index) {
+    Timer& timer = _timers[index];
+    uint64_t remaining = (timer.due > _now) ? timer.due - _now : 0;
+    uint64_t due = (timer.due > _now) ? timer.due : _now;
+
+    int level = 0;
+    while (level < LEVELS - 1 && remaining >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+        ++level;
+    }
+    // Além do alcance: fica na última posição do último nível e é reencaixado ao cascatear.
+    uint64_t maxAhead = (uint64_t(1) << (SLOT_BITS * LEVELS)) - 1;
+    if (remaining > maxAhead) due = _now + maxAhead;
+
+    int slot = level * SLOTS + static_cast<int>((due >> (SLOT_BITS * level)) & (SLOTS - 1));
+    timer.slot = slot;
+    timer.next = -1;
+    timer.prev = _tails[slot];
+    if (_tails[slot] >= 0) _timers[_tails[slot]].next = index;
+    else _heads[slot] = index;
+    _tails[slot] = index;
+}
+
+/**
+ * @brief Tira o timer da lista da sua posição.
+ */
+void TimerWheel::unlink(int index) {
+    Timer& timer = _timers[index];
+    int slot = timer.slot;
+    if (timer.prev >= 0) _timers[timer.prev].next = timer.next;
+    else _heads[slot] = timer.next;
+    if (timer.next >= 0) _timers[timer.next].prev = timer.prev;
+    else _tails[slot] = timer.prev;
+    timer.prev = timer.next = -1;
+}
+
+/**
+ * @brief Devolve a entrada do timer à lista livre.
+ */
+void TimerWheel::release(int index) {
+    Timer& timer = _timers[index];
+    timer.slot = FREE;
+    timer.callback = nullptr;
+    _freeList.push_back(index);
+    --_pending;
+}
+
+/**
+ * @brief Redistribui os timers de uma posição de um nível superior pelos níveis de baixo.
+ */
+void TimerWheel::cascade(int level, int slot) {
+    int position = level * SLOTS + slot;
+    int index = _heads[position];
+    _heads[position] = _tails[position] = -1;
+    while (index >= 0) {
+        int next = _timers[index].next;
+        insert(index);
+        index = next;
+    }
+}
+
+// --- RELÓGIO ---
+
+/**
+ * @brief Avança um milissegundo: cascateia os níveis que viraram e dispara os vencidos.
+ */
+void TimerWheel::tick() {
+    ++_now;
+
+    // Do nível mais alto para o mais baixo, para que um timer que desce dois níveis
+    // de uma vez ainda seja redistribuído neste mesmo milissegundo.
+    for (int level = LEVELS - 1; level >= 1; --level) {
+        uint64_t mask = (uint64_t(1) << (SLOT_BITS * level)) - 1;
+        if ((_now & mask) == 0) {
+            cascade(level, static_cast<int>((_now >> (SLOT_BITS * level)) & (SLOTS - 1)));
+        }
+    }
+
+    int slot = static_cast<int>(_now & (SLOTS - 1));
+    if (_heads[slot] < 0) return;
+
+    _firing.clear();
+    for (int index = _heads[slot]; index >= 0;) {
+        int next = _timers[index].next;
+        if (_timers[index].due <= _now) {
+            unlink(index);
+            _timers[index].slot = FIRING;
+            _firing.push_back(std::make_pair(_timers[index].sequence, index));
+        }
+        index = next;
+    }
+    std::sort(_firing.begin(), _firing.end());
+
+    for (const auto& entry : _firing) {
+        int index = entry.second;
+        // Cancelado (e talvez reutilizado) por um callback anterior neste milissegundo.
+        if (_timers[index].slot != FIRING || _timers[index].sequence != entry.first) continue;
+
+        // O callback pode agendar timers (realocando _timers) ou cancelar a si mesmo.
+        Callback callback = std::move(_timers[index].callback);
+        uint32_t generation = _timers[index].generation;
+        ++_fired;
+        callback();
+
+        Timer& timer = _timers[index];
+        if (timer.slot != FIRING || timer.generation != generation) continue;
+        if (timer.interval > 0) {
+            timer.due += timer.interval;
+            timer.callback = std::move(callback);
+            insert(index);
+        } else {
+            release(index);
+        }
+    }
+}
+
+/**
+ * @brief Avança o relógio e dispara os timers vencidos.
+ * @param deltaTime O tempo decorrido (em ms).
+ */
+void TimerWheel::advance(float deltaTime) {
+    if (_paused || deltaTime <= 0.0f) return;
+
+    _fraction += deltaTime;
+    uint64_t steps = static_cast<uint64_t>(_fraction);
+    _fraction -= static_cast<float>(steps);
+
+    if (_pending == 0) {
+        _now += steps;
+        return;
+    }
+    for (uint64_t i = 0; i < steps; ++i) {
+        tick();
+    }
+}
+
+/**
+ * @brief Pausa ou retoma o relógio.
+ * @param paused true para pausar.
+ */
+void TimerWheel::setPaused(bool paused) {
+    _paused = paused;
+}
+
+bool TimerWheel::isPaused() const {
+    return _paused;
+}
+
+uint64_t TimerWheel::getTime() const {
+    return _now;
+}
+
+size_t TimerWheel::getPendingCount() const {
+    return _pending;
+}
+
+uint64_t TimerWheel::getFiredCount() const {
+    return _fired;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file Transform.cpp
+ * @brief Implementação do Transform e da sua matriz de mundo em cache.
+ */
+
+#include "../include/Transform.h"
+
+/**
+ * @brief Construtor padrão: identidade, sem pai.
+ */
+Transform::Transform() : Transform({0.0f, 0.0f, 0.0f}) {}
+
+/**
+ * @brief Construtor com posição e escala, sem rotação e sem pai.
+ * @param position A translação.
+ * @param scale A escala em cada eixo.
+ */
+Transform::Transform(const Vector3f& position, const Vector3f& scale)
+    : _position(position),
+      _rotation(Quaternion::identity()),
+      _scale(scale),
+      _parent(nullptr),
+      _world(Matrix4::identity()),
+      _dirty(true),
+      _version(0),
+      _parentVersion(0)
+{}
+
+void Transform::setPosition(const Vector3f& position) {
+    if (position.x == _position.x && position.y == _position.y && position.z == _position.z) return;
+    _position = position;
+    _dirty = true;
+}
+
+void Transform::setRotation(const Quaternion& rotation) {
+    if (rotation.x == _rotation.x && rotation.y == _rotation.y &&
+        rotation.z == _rotation.z && rotation.w == _rotation.w) return;
+    _rotation = rotation;
+    _dirty = true;
+}
+
+void Transform::setRotationY(float degrees) {
+    setRotation(Quaternion::fromAxisAngle({0.0f, 1.0f, 0.0f}, degrees));
+}
+
+void Transform::setScale(const Vector3f& scale) {
+    if (scale.x == _scale.x && scale.y == _scale.y && scale.z == _scale.z) return;
+    _scale = scale;
+    _dirty = true;
+}
+
+void Transform::setParent(const Transform* parent) {
+    _parent = parent;
+    _dirty = true;
+}
+
+/**
+ * @brief Obtém a matriz de mundo, recalculando-a se este Transform ou algum
+ * ancestral mudou.
+ *
+ * Os filhos não são avisados quando o pai muda: cada um guarda a versão do pai
+ * que usou e compara com a atual. Assim não é preciso manter a lista de filhos.
+ *
+ * @return A matriz Pai * Translação * Rotação * Escala, em ordem coluna-maior.
+ */
+const Matrix4& Transform::getWorldMatrix() const {
+    const Matrix4* parentWorld = nullptr;
+    if (_parent) {
+        parentWorld = &_parent->getWorldMatrix();
+        if (_parentVersion != _parent->_version) _dirty = true;
+    }
+    if (!_dirty) return _world;
+
+    const Matrix4 local = getLocalMatrix();
+    _world = parentWorld ? (*parentWorld) * local : local;
+    if (_parent) _parentVersion = _parent->_version;
+    _dirty = false;
+    ++_version;
+    return _world;
+}
+
+Matrix4 Transform::getLocalMatrix() const {
+    // Rotação com as colunas escaladas, e a translação na última coluna.
+    Matrix4 local = _rotation.toMatrix();
+    for (int i = 0; i < 3; ++i) {
+        local.m[i] *= _scale.x;
+        local.m[4 + i] *= _scale.y;
+        local.m[8 + i] *= _scale.z;
+    }
+    local.m[12] = _position.x;
+    local.m[13] = _position.y;
+    local.m[14] = _position.z;
+    return local;
+}
+
+Vector3f Transform::getWorldPosition() const {
+    const Matrix4& world = getWorldMatrix();
+    return {world.m[12], world.m[13], world.m[14]};
+}
@@ -0,0 +1,172 @@
+/**
+ * @file TriggerSystem.cpp
+ * @brief Implementação da grade de gatilhos e do despacho de eventos por mudança.
+ */
+
+#include "../include/TriggerSystem.h"
+#include "../include/Collision.h"
+#include "../include/Config.h"
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Construtor do TriggerSystem.
+ */
+TriggerSystem::TriggerSystem() {}
+
+/**
+ * @brief Converte uma coordenada do mundo para o índice de célula da grade.
+ */
+int TriggerSystem::cellCoord(float value) const {
+    return (int)std::floor(value / Config::TRIGGER_CELL_SIZE);
+}
+
+/**
+ * @brief Combina os índices X e Z de uma célula numa única chave.
+ */
+long long TriggerSystem::cellKey(int x, int z) const {
+    return ((long long)x << 32) ^ (long long)(unsigned int)z;
+}
+
+/**
+ * @brief Registra um volume de gatilho em todas as células da grade que ele toca.
+ * @param volume O volume.
+ * @param listener Quem recebe os eventos.
+ */
+void TriggerSystem::addTrigger(const BoundingBox& volume, TriggerListener* listener) {
+    int index = (int)_triggers.size();
+    _triggers.push_back({volume, listener});
+
+    for (int x = cellCoord(volume.min.x); x <= cellCoord(volume.max.x); ++x) {
+        for (int z = cellCoord(volume.min.z); z <= cellCoord(volume.max.z); ++z) {
+            _cells[cellKey(x, z)].push_back(index);
+        }
+    }
+
+    // Objetos já rastreados precisam ser comparados com o novo volume.
+    for (size_t i = 0; i < _tracked.size(); ++i) {
+        if (_tracked[i].active && !_tracked[i].dirty) {
+            _tracked[i].dirty = true;
+            _dirty.push_back((int)i);
+        }
+    }
+}
+
+/**
+ * @brief Começa a rastrear um objeto. Ele fica desativado até o primeiro moveTracked.
+ * @param owner O objeto (nullptr para o jogador).
+ * @return O identificador do objeto rastreado.
+ */
+int TriggerSystem::addTracked(GameObject* owner) {
+    Tracked tracked;
+    tracked.owner = owner;
+    tracked.bounds = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+    tracked.active = false;
+    tracked.dirty = false;
+    _tracked.push_back(tracked);
+    return (int)_tracked.size() - 1;
+}
+
+/**
+ * @brief Atualiza a caixa de um objeto rastreado.
+ * @param handle O identificador do objeto.
+ * @param bounds A caixa atual do objeto.
+ */
+void TriggerSystem::moveTracked(int handle, const BoundingBox& bounds) {
+    Tracked& tracked = _tracked[handle];
+    bool moved = bounds.min.x != tracked.bounds.min.x || bounds.min.y != tracked.bounds.min.y ||
+                 bounds.min.z != tracked.bounds.min.z || bounds.max.x != tracked.bounds.max.x ||
+                 bounds.max.y != tracked.bounds.max.y || bounds.max.z != tracked.bounds.max.z;
+    if (tracked.active && !moved) return;
+
+    tracked.bounds = bounds;
+    tracked.active = true;
+    if (!tracked.dirty) {
+        tracked.dirty = true;
+        _dirty.push_back(handle);
+    }
+}
+
+/**
+ * @brief Desativa um objeto rastreado.
+ * @param handle O identificador do objeto.
+ */
+void TriggerSystem::disableTracked(int handle) {
+    Tracked& tracked = _tracked[handle];
+    if (!tracked.active) return;
+
+    tracked.active = false;
+    if (!tracked.dirty) {
+        tracked.dirty = true;
+        _dirty.push_back(handle);
+    }
+}
+
+/**
+ * @brief Junta, sem repetições e em ordem crescente, os volumes das células que a caixa toca.
+ */
+void TriggerSystem::gatherCandidates(const BoundingBox& bounds, std::vector<int>& out) const {
+    out.clear();
+    for (int x = cellCoord(bounds.min.x); x <= cellCoord(bounds.max.x); ++x) {
+        for (int z = cellCoord(bounds.min.z); z <= cellCoord(bounds.max.z); ++z) {
+            auto cell = _cells.find(cellKey(x, z));
+            if (cell != _cells.end()) {
+                out.insert(out.end(), cell->second.begin(), cell->second.end());
+            }
+        }
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+/**
+ * @brief Testa os objetos que mudaram desde o último despacho e envia os eventos.
+ *
+ * Para cada objeto marcado, compara o conjunto de volumes que ele sobrepõe agora
+ * com o conjunto anterior: volumes novos geram ENTER, volumes perdidos geram EXIT
+ * e os que continuam geram STAY (o objeto se moveu dentro deles).
+ *
+ * @param gameStateManager Repassado aos ouvintes.
+ */
+void TriggerSystem::dispatch(GameStateManager& gameStateManager) {
+    if (_dirty.empty()) return;
+
+    // Os ouvintes podem mover objetos; eventos causados por eles ficam para o próximo despacho.
+    // As duas listas trocam de lugar e mantêm a memória já alocada.
+    _pending.clear();
+    _pending.swap(_dirty);
+
+    for (int handle : _pending) {
+        Tracked& tracked = _tracked[handle];
+        tracked.dirty = false;
+
+        _before.assign(tracked.inside.begin(), tracked.inside.end());
+        std::vector<int>& nowInside = tracked.inside;
+        nowInside.clear();
+        if (tracked.active) {
+            gatherCandidates(tracked.bounds, _scratch);
+            for (int index : _scratch) {
+                if (checkCollision(tracked.bounds, _triggers[index].volume)) {
+                    nowInside.push_back(index);
+                }
+            }
+        }
+        const std::vector<int>& before = _before;
+
+        // As duas listas estão ordenadas: uma única passada separa saídas, entradas e permanências.
+        size_t i = 0, j = 0;
+        while (i < before.size() || j < nowInside.size()) {
+            if (j == nowInside.size() || (i < before.size() && before[i] < nowInside[j])) {
+                _triggers[before[i]].listener->onTriggerEvent(TriggerEvent::EXIT, tracked.owner, gameStateManager);
+                ++i;
+            } else if (i == before.size() || nowInside[j] < before[i]) {
+                _triggers[nowInside[j]].listener->onTriggerEvent(TriggerEvent::ENTER, tracked.owner, gameStateManager);
+                ++j;
+            } else {
+                _triggers[nowInside[j]].listener->onTriggerEvent(TriggerEvent::STAY, tracked.owner, gameStateManager);
+                ++i;
+                ++j;
+            }
+        }
+    }
+}
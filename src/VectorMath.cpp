@@ -0,0 +1,393 @@
+/**
+ * @file VectorMath.cpp
+ * @brief Implementação das matrizes, quatérnios, frustum e núcleos em lote (SSE, NEON e escalar).
+ */
+
+#include "../include/VectorMath.h"
+
+#if defined(JOGO3D_SIMD_SSE)
+    #include <xmmintrin.h>
+#elif defined(JOGO3D_SIMD_NEON)
+    #include <arm_neon.h>
+#endif
+
+static const float DEG_TO_RAD = 3.1415926535f / 180.0f;
+
+// --- MATRIX4 ---
+
+/**
+ * @brief A matriz identidade.
+ */
+Matrix4 Matrix4::identity() {
+    Matrix4 r;
+    for (int i = 0; i < 16; ++i) r.m[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+    return r;
+}
+
+/**
+ * @brief Matriz de translação, equivalente a glTranslatef.
+ * @param t O deslocamento.
+ */
+Matrix4 Matrix4::translation(const Vector3f& t) {
+    Matrix4 r = identity();
+    r.m[12] = t.x; r.m[13] = t.y; r.m[14] = t.z;
+    return r;
+}
+
+/**
+ * @brief Matriz de escala, equivalente a glScalef.
+ * @param s Os fatores de escala por eixo.
+ */
+Matrix4 Matrix4::scale(const Vector3f& s) {
+    Matrix4 r = identity();
+    r.m[0] = s.x; r.m[5] = s.y; r.m[10] = s.z;
+    return r;
+}
+
+/**
+ * @brief Matriz de rotação em torno do eixo Y, equivalente a glRotatef(degrees, 0, 1, 0).
+ * @param degrees O ângulo, em graus.
+ */
+Matrix4 Matrix4::rotationY(float degrees) {
+    const float c = std::cos(degrees * DEG_TO_RAD);
+    const float s = std::sin(degrees * DEG_TO_RAD);
+    Matrix4 r = identity();
+    r.m[0] = c;  r.m[2] = -s;
+    r.m[8] = s;  r.m[10] = c;
+    return r;
+}
+
+/**
+ * @brief Matriz de projeção perspectiva, equivalente a gluPerspective.
+ * @param fovYDegrees O campo de visão vertical, em graus.
+ * @param aspect A razão largura/altura.
+ * @param zNear A distância do plano próximo.
+ * @param zFar A distância do plano distante.
+ */
+Matrix4 Matrix4::perspective(float fovYDegrees, float aspect, float zNear, float zFar) {
+    const float f = 1.0f / std::tan(fovYDegrees * DEG_TO_RAD * 0.5f);
+    Matrix4 r;
+    for (int i = 0; i < 16; ++i) r.m[i] = 0.0f;
+    r.m[0] = f / aspect;
+    r.m[5] = f;
+    r.m[10] = (zFar + zNear) / (zNear - zFar);
+    r.m[11] = -1.0f;
+    r.m[14] = 2.0f * zFar * zNear / (zNear - zFar);
+    return r;
+}
+
+/**
+ * @brief Matriz de visão, equivalente a gluLookAt.
+ * @param eye A posição da câmera.
+ * @param center O ponto observado.
+ * @param up O vetor "para cima" aproximado.
+ */
+Matrix4 Matrix4::lookAt(const Vector3f& eye, const Vector3f& center, const Vector3f& up) {
+    const Vector3f f = normalize(center - eye);
+    const Vector3f s = normalize(cross(f, up));
+    const Vector3f u = cross(s, f);
+    Matrix4 r = identity();
+    r.m[0] = s.x;  r.m[4] = s.y;  r.m[8] = s.z;
+    r.m[1] = u.x;  r.m[5] = u.y;  r.m[9] = u.z;
+    r.m[2] = -f.x; r.m[6] = -f.y; r.m[10] = -f.z;
+    r.m[12] = -dot(s, eye);
+    r.m[13] = -dot(u, eye);
+    r.m[14] = dot(f, eye);
+    return r;
+}
+
+/**
+ * @brief Produto de matrizes: cada coluna do resultado é uma combinação das colunas desta.
+ * @param other A matriz da direita (aplicada primeiro).
+ */
+Matrix4 Matrix4::operator*(const Matrix4& other) const {
+    Matrix4 r;
+#if defined(JOGO3D_SIMD_SSE)
+    const __m128 c0 = _mm_loadu_ps(m), c1 = _mm_loadu_ps(m + 4), c2 = _mm_loadu_ps(m + 8), c3 = _mm_loadu_ps(m + 12);
+    for (int j = 0; j < 4; ++j) {
+        const float* b = other.m + j * 4;
+        __m128 col = _mm_mul_ps(c0, _mm_set1_ps(b[0]));
+        col = _mm_add_ps(col, _mm_mul_ps(c1, _mm_set1_ps(b[1])));
+        col = _mm_add_ps(col, _mm_mul_ps(c2, _mm_set1_ps(b[2])));
+        col = _mm_add_ps(col, _mm_mul_ps(c3, _mm_set1_ps(b[3])));
+        _mm_storeu_ps(r.m + j * 4, col);
+    }
+#elif defined(JOGO3D_SIMD_NEON)
+    const float32x4_t c0 = vld1q_f32(m), c1 = vld1q_f32(m + 4), c2 = vld1q_f32(m + 8), c3 = vld1q_f32(m + 12);
+    for (int j = 0; j < 4; ++j) {
+        const float* b = other.m + j * 4;
+        float32x4_t col = vmulq_n_f32(c0, b[0]);
+        col = vmlaq_n_f32(col, c1, b[1]);
+        col = vmlaq_n_f32(col, c2, b[2]);
+        col = vmlaq_n_f32(col, c3, b[3]);
+        vst1q_f32(r.m + j * 4, col);
+    }
+#else
+    for (int j = 0; j < 4; ++j) {
+        for (int i = 0; i < 4; ++i) {
+            r.m[j * 4 + i] = m[i] * other.m[j * 4] + m[4 + i] * other.m[j * 4 + 1] +
+                             m[8 + i] * other.m[j * 4 + 2] + m[12 + i] * other.m[j * 4 + 3];
+        }
+    }
+#endif
+    return r;
+}
+
+/**
+ * @brief Aplica a matriz a um ponto (w = 1), sem divisão perspectiva.
+ * @param p O ponto.
+ */
+Vector3f Matrix4::transformPoint(const Vector3f& p) const {
+    return {m[0] * p.x + m[4] * p.y + m[8] * p.z + m[12],
+            m[1] * p.x + m[5] * p.y + m[9] * p.z + m[13],
+            m[2] * p.x + m[6] * p.y + m[10] * p.z + m[14]};
+}
+
+/**
+ * @brief Aplica a matriz a uma direção (w = 0): ignora a translação.
+ * @param d A direção.
+ */
+Vector3f Matrix4::transformDirection(const Vector3f& d) const {
+    return {m[0] * d.x + m[4] * d.y + m[8] * d.z,
+            m[1] * d.x + m[5] * d.y + m[9] * d.z,
+            m[2] * d.x + m[6] * d.y + m[10] * d.z};
+}
+
+/**
+ * @brief Aplica a matriz a um vetor homogêneo.
+ * @param v O vetor.
+ */
+Vector4f Matrix4::transform(const Vector4f& v) const {
+    return {m[0] * v.x + m[4] * v.y + m[8] * v.z + m[12] * v.w,
+            m[1] * v.x + m[5] * v.y + m[9] * v.z + m[13] * v.w,
+            m[2] * v.x + m[6] * v.y + m[10] * v.z + m[14] * v.w,
+            m[3] * v.x + m[7] * v.y + m[11] * v.z + m[15] * v.w};
+}
+
+// --- QUATERNION ---
+
+/**
+ * @brief Rotação de `degrees` graus em torno de um eixo.
+ * @param axis O eixo (não precisa estar normalizado).
+ * @param degrees O ângulo, em graus.
+ */
+Quaternion Quaternion::fromAxisAngle(const Vector3f& axis, float degrees) {
+    const Vector3f a = normalize(axis);
+    const float half = degrees * DEG_TO_RAD * 0.5f;
+    const float s = std::sin(half);
+    return {a.x * s, a.y * s, a.z * s, std::cos(half)};
+}
+
+/**
+ * @brief Composição de rotações: (q1 * q2) aplica q2 e depois q1.
+ * @param q A rotação da direita (aplicada primeiro).
+ */
+Quaternion Quaternion::operator*(const Quaternion& q) const {
+    return {w * q.x + x * q.w + y * q.z - z * q.y,
+            w * q.y - x * q.z + y * q.w + z * q.x,
+            w * q.z + x * q.y - y * q.x + z * q.w,
+            w * q.w - x * q.x - y * q.y - z * q.z};
+}
+
+/**
+ * @brief Rotaciona um vetor: v' = v + 2w(q × v) + 2q × (q × v).
+ * @param v O vetor.
+ */
+Vector3f Quaternion::rotate(const Vector3f& v) const {
+    const Vector3f q = {x, y, z};
+    const Vector3f t = cross(q, v) * 2.0f;
+    return v + t * w + cross(q, t);
+}
+
+/**
+ * @brief A matriz de rotação equivalente (supõe o quatérnio normalizado).
+ */
+Matrix4 Quaternion::toMatrix() const {
+    Matrix4 r = Matrix4::identity();
+    r.m[0] = 1.0f - 2.0f * (y * y + z * z);
+    r.m[1] = 2.0f * (x * y + z * w);
+    r.m[2] = 2.0f * (x * z - y * w);
+    r.m[4] = 2.0f * (x * y - z * w);
+    r.m[5] = 1.0f - 2.0f * (x * x + z * z);
+    r.m[6] = 2.0f * (y * z + x * w);
+    r.m[8] = 2.0f * (x * z + y * w);
+    r.m[9] = 2.0f * (y * z - x * w);
+    r.m[10] = 1.0f - 2.0f * (x * x + y * y);
+    return r;
+}
+
+/**
+ * @brief Cópia com norma 1; a identidade se a norma for zero.
+ */
+Quaternion Quaternion::normalized() const {
+    const float len = std::sqrt(x * x + y * y + z * z + w * w);
+    if (len <= 0.0f) return identity();
+    return {x / len, y / len, z / len, w / len};
+}
+
+// --- FRUSTUM ---
+
+/**
+ * @brief Extrai os planos de uma matriz projeção * visão.
+ *
+ * Com r0..r3 as linhas da matriz, os planos são r3 ± r0 (esquerda/direita),
+ * r3 ± r1 (baixo/cima) e r3 ± r2 (perto/longe).
+ *
+ * @param vp A matriz projeção * visão.
+ */
+Frustum Frustum::fromMatrix(const Matrix4& vp) {
+    const float* m = vp.m;
+    Vector4f row[4];
+    for (int i = 0; i < 4; ++i) row[i] = {m[i], m[4 + i], m[8 + i], m[12 + i]};
+
+    Frustum f;
+    for (int i = 0; i < 3; ++i) {
+        f.planes[i * 2]     = {row[3].x + row[i].x, row[3].y + row[i].y, row[3].z + row[i].z, row[3].w + row[i].w};
+        f.planes[i * 2 + 1] = {row[3].x - row[i].x, row[3].y - row[i].y, row[3].z - row[i].z, row[3].w - row[i].w};
+    }
+    for (Vector4f& p : f.planes) {
+        float len = std::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+        if (len > 0.0f) { p.x /= len; p.y /= len; p.z /= len; p.w /= len; }
+    }
+    return f;
+}
+
+// --- NÚCLEOS EM LOTE ---
+
+/**
+ * @brief O nome do conjunto de instruções escolhido na compilação.
+ * @return "SSE", "NEON" ou "escalar".
+ */
+const char* VectorMath::simdBackend() {
+#if defined(JOGO3D_SIMD_SSE)
+    return "SSE";
+#elif defined(JOGO3D_SIMD_NEON)
+    return "NEON";
+#else
+    return "escalar";
+#endif
+}
+
+/**
+ * @brief Interseção de um raio com uma esfera (fórmula quadrática com meio-b).
+ * @param ray O raio.
+ * @param center O centro da esfera.
+ * @param radius O raio da esfera.
+ * @return A distância até a primeira superfície, ou -1.
+ */
+float VectorMath::raySphere(const Ray& ray, const Vector3f& center, float radius) {
+    const Vector3f oc = ray.origin - center;
+    const float a = dot(ray.direction, ray.direction);
+    const float b = dot(oc, ray.direction);
+    const float c = dot(oc, oc) - radius * radius;
+    const float discriminant = b * b - a * c;
+    if (a <= 0.0f || discriminant < 0.0f) return -1.0f;
+
+    const float root = std::sqrt(discriminant);
+    if (-b + root < 0.0f) return -1.0f; // a esfera inteira está atrás da origem
+    return (-b - root) / a;
+}
+
+/**
+ * @brief raySphere para várias esferas, quatro por vez.
+ * @param ray O raio.
+ * @param centerX As coordenadas X dos centros.
+ * @param centerY As coordenadas Y dos centros.
+ * @param centerZ As coordenadas Z dos centros.
+ * @param radius Os raios das esferas.
+ * @param count O número de esferas.
+ * @param out Recebe `count` distâncias, com a mesma convenção de raySphere.
+ */
+void VectorMath::raySphereBatch(const Ray& ray, const float* centerX, const float* centerY, const float* centerZ,
+                                const float* radius, size_t count, float* out) {
+    size_t i = 0;
+    const float a = dot(ray.direction, ray.direction);
+    if (a <= 0.0f) {
+        for (; i < count; ++i) out[i] = -1.0f;
+        return;
+    }
+
+#if defined(JOGO3D_SIMD_SSE)
+    const __m128 ox = _mm_set1_ps(ray.origin.x), oy = _mm_set1_ps(ray.origin.y), oz = _mm_set1_ps(ray.origin.z);
+    const __m128 dx = _mm_set1_ps(ray.direction.x), dy = _mm_set1_ps(ray.direction.y), dz = _mm_set1_ps(ray.direction.z);
+    const __m128 va = _mm_set1_ps(a), invA = _mm_set1_ps(1.0f / a);
+    const __m128 zero = _mm_setzero_ps(), miss = _mm_set1_ps(-1.0f);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 ocx = _mm_sub_ps(ox, _mm_loadu_ps(centerX + i));
+        const __m128 ocy = _mm_sub_ps(oy, _mm_loadu_ps(centerY + i));
+        const __m128 ocz = _mm_sub_ps(oz, _mm_loadu_ps(centerZ + i));
+        const __m128 r = _mm_loadu_ps(radius + i);
+        const __m128 b = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ocx, dx), _mm_mul_ps(ocy, dy)), _mm_mul_ps(ocz, dz));
+        const __m128 c = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(ocx, ocx), _mm_mul_ps(ocy, ocy)), _mm_mul_ps(ocz, ocz)),
+                                    _mm_mul_ps(r, r));
+        const __m128 discriminant = _mm_sub_ps(_mm_mul_ps(b, b), _mm_mul_ps(va, c));
+        const __m128 root = _mm_sqrt_ps(_mm_max_ps(discriminant, zero));
+        const __m128 nearT = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(zero, b), root), invA);
+        const __m128 farT = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(zero, b), root), invA);
+        const __m128 isMiss = _mm_or_ps(_mm_cmplt_ps(discriminant, zero), _mm_cmplt_ps(farT, zero));
+        _mm_storeu_ps(out + i, _mm_or_ps(_mm_and_ps(isMiss, miss), _mm_andnot_ps(isMiss, nearT)));
+    }
+#elif defined(JOGO3D_SIMD_NEON)
+    const float32x4_t ox = vdupq_n_f32(ray.origin.x), oy = vdupq_n_f32(ray.origin.y), oz = vdupq_n_f32(ray.origin.z);
+    const float32x4_t zero = vdupq_n_f32(0.0f), miss = vdupq_n_f32(-1.0f);
+    const float invA = 1.0f / a;
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t ocx = vsubq_f32(ox, vld1q_f32(centerX + i));
+        const float32x4_t ocy = vsubq_f32(oy, vld1q_f32(centerY + i));
+        const float32x4_t ocz = vsubq_f32(oz, vld1q_f32(centerZ + i));
+        const float32x4_t r = vld1q_f32(radius + i);
+        float32x4_t b = vmulq_n_f32(ocx, ray.direction.x);
+        b = vmlaq_n_f32(b, ocy, ray.direction.y);
+        b = vmlaq_n_f32(b, ocz, ray.direction.z);
+        float32x4_t c = vmulq_f32(ocx, ocx);
+        c = vmlaq_f32(c, ocy, ocy);
+        c = vmlaq_f32(c, ocz, ocz);
+        c = vmlsq_f32(c, r, r);
+        const float32x4_t discriminant = vmlsq_n_f32(vmulq_f32(b, b), c, a);
+        const float32x4_t root = vsqrtq_f32(vmaxq_f32(discriminant, zero));
+        const float32x4_t nearT = vmulq_n_f32(vsubq_f32(vnegq_f32(b), root), invA);
+        const float32x4_t farT = vmulq_n_f32(vaddq_f32(vnegq_f32(b), root), invA);
+        const uint32x4_t isMiss = vorrq_u32(vcltq_f32(discriminant, zero), vcltq_f32(farT, zero));
+        vst1q_f32(out + i, vbslq_f32(isMiss, miss, nearT));
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = raySphere(ray, {centerX[i], centerY[i], centerZ[i]}, radius[i]);
+    }
+}
+
+/**
+ * @brief Aplica uma matriz a vários pontos (w = 1).
+ * @param matrix A matriz.
+ * @param in Os pontos de entrada.
+ * @param out Recebe os pontos transformados; pode ser o próprio `in`.
+ * @param count O número de pontos.
+ */
+void VectorMath::transformPoints(const Matrix4& matrix, const Vector3f* in, Vector3f* out, size_t count) {
+#if defined(JOGO3D_SIMD_SSE)
+    const __m128 c0 = _mm_loadu_ps(matrix.m), c1 = _mm_loadu_ps(matrix.m + 4);
+    const __m128 c2 = _mm_loadu_ps(matrix.m + 8), c3 = _mm_loadu_ps(matrix.m + 12);
+    alignas(16) float result[4];
+    for (size_t i = 0; i < count; ++i) {
+        __m128 r = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(in[i].x)), _mm_mul_ps(c1, _mm_set1_ps(in[i].y)));
+        r = _mm_add_ps(r, _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(in[i].z)), c3));
+        _mm_store_ps(result, r);
+        out[i] = {result[0], result[1], result[2]};
+    }
+#elif defined(JOGO3D_SIMD_NEON)
+    const float32x4_t c0 = vld1q_f32(matrix.m), c1 = vld1q_f32(matrix.m + 4);
+    const float32x4_t c2 = vld1q_f32(matrix.m + 8), c3 = vld1q_f32(matrix.m + 12);
+    float result[4];
+    for (size_t i = 0; i < count; ++i) {
+        float32x4_t r = vmlaq_n_f32(c3, c0, in[i].x);
+        r = vmlaq_n_f32(r, c1, in[i].y);
+        r = vmlaq_n_f32(r, c2, in[i].z);
+        vst1q_f32(result, r);
+        out[i] = {result[0], result[1], result[2]};
+    }
+#else
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = matrix.transformPoint(in[i]);
+    }
+#endif
+}
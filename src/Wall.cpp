@@ -6,22 +6,28 @@
 #include "../include/Wall.h"
 #include "../include/TextureManager.h"
 #include <GL/freeglut.h>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
+/** @brief Quantas unidades de mundo cada repetio da textura cobre. */
+static const float TEXTURE_SCALE = 4.0f;
+
 /**
- * @brief Construtor da classe Wall que carrega uma textura.
+ * @brief Construtor da classe Wall com textura.
  *
- * Inicializa a parede com uma posio e tamanho, e carrega uma textura a
- * partir do arquivo especificado.
+ * Inicializa a parede com uma posio e tamanho e registra a textura como um
+ * material do atlas (a imagem  lida quando o atlas for montado).
  *
  * @param position A posio do centro da parede no espao 3D.
  * @param size As dimenses (largura, altura, profundidade) da parede.
  * @param textureFile O caminho para o arquivo de textura.
  */
 Wall::Wall(const Vector3f& position, const Vector3f& size, const std::string& textureFile)
-    : _position(position), _size(size)
+    : _transform(position), _size(size)
 {
-    _textureID = TextureManager::loadTexture(textureFile);
+    _material = TextureManager::getMaterial(textureFile);
+    buildGeometry();
 }
 
 /**
@@ -36,6 +42,85 @@ Wall::Wall(const Vector3f& position, const Vector3f& size, const std::string& te
 Wall::Wall(const Vector3f& position, const Vector3f& size)
     : Wall(position, size, "") {}
 
+/**
+ * @brief Acrescenta uma face retangular, dividida nas repeties da textura.
+ *
+ * Com o atlas no d para usar GL_REPEAT, ento a face  cortada nas fronteiras
+ * entre repeties: cada pedao cobre no mximo uma repetio e recebe (s, t)
+ * dentro dela.
+ *
+ * @param out Recebe os vrtices (quatro por pedao).
+ * @param corner O canto da face com coordenada de textura (0, 0).
+ * @param axisU A aresta da face na direo de s.
+ * @param axisV A aresta da face na direo de t.
+ * @param normal A normal da face.
+ * @param repeatsU Quantas repeties da textura cabem em axisU.
+ * @param repeatsV Quantas repeties da textura cabem em axisV.
+ * @param flip Inverte a ordem dos vrtices (o lado de dentro das faces de dupla-face).
+ */
+static void addFace(std::vector<StaticVertex>& out, const Vector3f& corner, const Vector3f& axisU,
+                    const Vector3f& axisV, const Vector3f& normal, float repeatsU, float repeatsV, bool flip) {
+    for (float u = 0.0f; u < repeatsU; u = std::floor(u) + 1.0f) {
+        float uEnd = std::min(std::floor(u) + 1.0f, repeatsU);
+        float s0 = u - std::floor(u);
+        float s1 = s0 + (uEnd - u);
+        for (float v = 0.0f; v < repeatsV; v = std::floor(v) + 1.0f) {
+            float vEnd = std::min(std::floor(v) + 1.0f, repeatsV);
+            float t0 = v - std::floor(v);
+            float t1 = t0 + (vEnd - v);
+
+            StaticVertex a = {corner + axisU * (u / repeatsU) + axisV * (v / repeatsV), normal, s0, t0};
+            StaticVertex b = {corner + axisU * (uEnd / repeatsU) + axisV * (v / repeatsV), normal, s1, t0};
+            StaticVertex c = {corner + axisU * (uEnd / repeatsU) + axisV * (vEnd / repeatsV), normal, s1, t1};
+            StaticVertex d = {corner + axisU * (u / repeatsU) + axisV * (vEnd / repeatsV), normal, s0, t1};
+            if (flip) std::swap(b, d);
+            out.push_back(a);
+            out.push_back(b);
+            out.push_back(c);
+            out.push_back(d);
+        }
+    }
+}
+
+/**
+ * @brief Gera os quadrilteros da parede em coordenadas locais.
+ *
+ * A parede  um cubo com seis faces. As quatro faces laterais so de dupla-face
+ * (tambm visveis por dentro), o que  til em ambientes internos; as de cima e
+ * de baixo no precisam.
+ */
+void Wall::buildGeometry() {
+    float hx = _size.x / 2.0f;
+    float hy = _size.y / 2.0f;
+    float hz = _size.z / 2.0f;
+
+    float u_repeat_x = _size.x / TEXTURE_SCALE;
+    float v_repeat_y = _size.y / TEXTURE_SCALE;
+    float w_repeat_z = _size.z / TEXTURE_SCALE;
+
+    const Vector3f alongX = {2.0f * hx, 0.0f, 0.0f};
+    const Vector3f alongY = {0.0f, 2.0f * hy, 0.0f};
+    const Vector3f alongZ = {0.0f, 0.0f, 2.0f * hz};
+
+    _geometry.clear();
+    for (int side = 0; side < 2; ++side) {
+        const bool inner = (side == 1);
+        const float n = inner ? -1.0f : 1.0f;
+        // Face da frente (+Z)
+        addFace(_geometry, {-hx, -hy, hz}, alongX, alongY, {0.0f, 0.0f, n}, u_repeat_x, v_repeat_y, inner);
+        // Face de trs (-Z)
+        addFace(_geometry, {hx, -hy, -hz}, -alongX, alongY, {0.0f, 0.0f, -n}, u_repeat_x, v_repeat_y, inner);
+        // Face da direita (+X)
+        addFace(_geometry, {hx, -hy, -hz}, alongZ, alongY, {n, 0.0f, 0.0f}, w_repeat_z, v_repeat_y, inner);
+        // Face da esquerda (-X)
+        addFace(_geometry, {-hx, -hy, hz}, -alongZ, alongY, {-n, 0.0f, 0.0f}, w_repeat_z, v_repeat_y, inner);
+    }
+    // Face de cima (+Y)
+    addFace(_geometry, {-hx, hy, hz}, alongX, -alongZ, {0.0f, 1.0f, 0.0f}, u_repeat_x, w_repeat_z, false);
+    // Face de baixo (-Y)
+    addFace(_geometry, {-hx, -hy, -hz}, alongX, alongZ, {0.0f, -1.0f, 0.0f}, u_repeat_x, w_repeat_z, false);
+}
+
 /**
  * @brief Atualiza o estado da parede.
  *
@@ -49,114 +134,32 @@ void Wall::update(float deltaTime, GameStateManager& gameStateManager) {
 }
 
 /**
- * @brief Renderiza a parede na tela.
+ * @brief Registra a parede no pacote do quadro com a matriz em cache.
+ *
+ * S  usado para paredes fora de uma sala: as paredes de uma sala so
+ * desenhadas pelo StaticBatch dela.
  *
- * A funo desenha um cubo com seis faces. As quatro faces laterais
- * so desenhadas com vrtices duplos para que a parede possa ser vista
- * de ambos os lados (frente e verso), o que  til em ambientes
- * internos. A textura  aplicada se um ID de textura for vlido.
+ * @param packet O pacote sendo montado pela simulao.
  */
-void Wall::render() {
-    glColor3f(1.0f, 1.0f, 1.0f);
-
-    if (_textureID) {
-        glEnable(GL_TEXTURE_2D);
-        glBindTexture(GL_TEXTURE_2D, _textureID);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    } else {
-        glDisable(GL_TEXTURE_2D);
-    }
-
-    glPushMatrix();
-    glTranslatef(_position.x, _position.y, _position.z);
-
-    float hx = _size.x / 2.0f;
-    float hy = _size.y / 2.0f;
-    float hz = _size.z / 2.0f;
+void Wall::collectDrawItems(RenderPacket& packet) {
+    packet.items.push_back(DrawItem(this, _transform));
+}
 
-    float textureScale = 4.0f;
-    float u_repeat_x = _size.x / textureScale;
-    float v_repeat_y = _size.y / textureScale;
-    float w_repeat_z = _size.z / textureScale;
+/**
+ * @brief Desenha a parede sozinha, em coordenadas locais, com o atlas de materiais.
+ *
+ * @param item O item do pacote (a matriz j foi carregada pela thread de GL).
+ */
+void Wall::draw(const DrawItem& item) {
+    glColor3f(1.0f, 1.0f, 1.0f);
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, TextureManager::getAtlasTexture());
 
     glBegin(GL_QUADS);
-        // --- Face da frente (+Z) ---
-        // Lado de fora
-        glNormal3f(0.0f, 0.0f, 1.0f);
-        glTexCoord2f(0, 0); glVertex3f(-hx, -hy, hz);
-        glTexCoord2f(u_repeat_x, 0); glVertex3f( hx, -hy, hz);
-        glTexCoord2f(u_repeat_x, v_repeat_y); glVertex3f( hx,  hy, hz);
-        glTexCoord2f(0, v_repeat_y); glVertex3f(-hx,  hy, hz);
-        // Lado de dentro (vrtices invertidos, normal invertida)
-        glNormal3f(0.0f, 0.0f, -1.0f);
-        glTexCoord2f(0, 0); glVertex3f(-hx, -hy, hz);
-        glTexCoord2f(0, v_repeat_y); glVertex3f(-hx,  hy, hz);
-        glTexCoord2f(u_repeat_x, v_repeat_y); glVertex3f( hx,  hy, hz);
-        glTexCoord2f(u_repeat_x, 0); glVertex3f( hx, -hy, hz);
-
-        // --- Face de trs (-Z) ---
-        // Lado de fora
-        glNormal3f(0.0f, 0.0f, -1.0f);
-        glTexCoord2f(0, 0); glVertex3f( hx, -hy, -hz);
-        glTexCoord2f(u_repeat_x, 0); glVertex3f(-hx, -hy, -hz);
-        glTexCoord2f(u_repeat_x, v_repeat_y); glVertex3f(-hx,  hy, -hz);
-        glTexCoord2f(0, v_repeat_y); glVertex3f( hx,  hy, -hz);
-        // Lado de dentro
-        glNormal3f(0.0f, 0.0f, 1.0f);
-        glTexCoord2f(0, 0); glVertex3f( hx, -hy, -hz);
-        glTexCoord2f(0, v_repeat_y); glVertex3f( hx,  hy, -hz);
-        glTexCoord2f(u_repeat_x, v_repeat_y); glVertex3f(-hx,  hy, -hz);
-        glTexCoord2f(u_repeat_x, 0); glVertex3f(-hx, -hy, -hz);
-
-        // --- Face da direita (+X) ---
-        // Lado de fora
-        glNormal3f(1.0f, 0.0f, 0.0f);
-        glTexCoord2f(0, 0); glVertex3f(hx, -hy, -hz);
-        glTexCoord2f(w_repeat_z, 0); glVertex3f(hx, -hy,  hz);
-        glTexCoord2f(w_repeat_z, v_repeat_y); glVertex3f(hx,  hy,  hz);
-        glTexCoord2f(0, v_repeat_y); glVertex3f(hx,  hy, -hz);
-        // Lado de dentro
-        glNormal3f(-1.0f, 0.0f, 0.0f);
-        glTexCoord2f(0, 0); glVertex3f(hx, -hy, -hz);
-        glTexCoord2f(0, v_repeat_y); glVertex3f(hx,  hy, -hz);
-        glTexCoord2f(w_repeat_z, v_repeat_y); glVertex3f(hx,  hy,  hz);
-        glTexCoord2f(w_repeat_z, 0); glVertex3f(hx, -hy,  hz);
-
-        // --- Face da esquerda (-X) ---
-        // Lado de fora
-        glNormal3f(-1.0f, 0.0f, 0.0f);
-        glTexCoord2f(0, 0); glVertex3f(-hx, -hy,  hz);
-        glTexCoord2f(w_repeat_z, 0); glVertex3f(-hx, -hy, -hz);
-        glTexCoord2f(w_repeat_z, v_repeat_y); glVertex3f(-hx,  hy, -hz);
-        glTexCoord2f(0, v_repeat_y); glVertex3f(-hx,  hy,  hz);
-        // Lado de dentro
-        glNormal3f(1.0f, 0.0f, 0.0f);
-        glTexCoord2f(0, 0); glVertex3f(-hx, -hy,  hz);
-        glTexCoord2f(0, v_repeat_y); glVertex3f(-hx,  hy,  hz);
-        glTexCoord2f(w_repeat_z, v_repeat_y); glVertex3f(-hx,  hy, -hz);
-        glTexCoord2f(w_repeat_z, 0); glVertex3f(-hx, -hy, -hz);
-
-        // As faces de cima e de baixo no precisam ser de dupla-face
-        // Face de cima (+Y)
-        glNormal3f(0.0f, 1.0f, 0.0f);
-        glTexCoord2f(0, 0); glVertex3f(-hx, hy,  hz);
-        glTexCoord2f(u_repeat_x, 0); glVertex3f( hx, hy,  hz);
-        glTexCoord2f(u_repeat_x, w_repeat_z); glVertex3f( hx, hy, -hz);
-        glTexCoord2f(0, w_repeat_z); glVertex3f(-hx, hy, -hz);
-        // Face de baixo (-Y)
-        glNormal3f(0.0f, -1.0f, 0.0f);
-        glTexCoord2f(0, 0); glVertex3f(-hx, -hy, -hz);
-        glTexCoord2f(u_repeat_x, 0); glVertex3f( hx, -hy, -hz);
-        glTexCoord2f(u_repeat_x, w_repeat_z); glVertex3f( hx, -hy,  hz);
-        glTexCoord2f(0, w_repeat_z); glVertex3f(-hx, -hy,  hz);
+    StaticBatch::emitVertices(_geometry, TextureManager::getMaterialRegion(_material), nullptr);
     glEnd();
 
-    glPopMatrix();
-
-    if (_textureID) {
-        glDisable(GL_TEXTURE_2D);
-    }
+    glDisable(GL_TEXTURE_2D);
 }
 
 /**
@@ -172,7 +175,8 @@ BoundingBox Wall::getBoundingBox() const {
     float halfHeight = _size.y / 2.0f;
     float halfDepth = _size.z / 2.0f;
 
-    box.min = { _position.x - halfWidth, _position.y - halfHeight, _position.z - halfDepth };
-    box.max = { _position.x + halfWidth, _position.y + halfHeight, _position.z + halfDepth };
+    const Vector3f& position = _transform.getPosition();
+    box.min = { position.x - halfWidth, position.y - halfHeight, position.z - halfDepth };
+    box.max = { position.x + halfWidth, position.y + halfHeight, position.z + halfDepth };
     return box;
 }
@@ -6,6 +6,7 @@
  * registrar as funções de callback (render, update, teclado, mouse) e iniciar o loop principal.
  */
 #include <GL/freeglut.h>
+#include <cstdlib>
 #include "../include/Game.h"
 #include "../include/Config.h"
 
@@ -17,6 +18,11 @@
  */
 Game game;
 
+/** @brief Geração do temporizador atual; temporizadores de gerações anteriores são ignorados. */
+static int s_timerGeneration = 0;
+/** @brief Instante (ms, GLUT_ELAPSED_TIME) do último updateCallback. */
+static int s_lastTick = 0;
+
 // --- Funções de Callback (Wrappers) ---
 /**
  * @brief Função de callback para renderização.
@@ -32,15 +38,37 @@ void renderCallback() {
  * @brief Função de callback para o loop de atualização do jogo.
  *
  * Esta função é chamada periodicamente por um temporizador do GLUT.
- * Ela atualiza o estado do jogo e, em seguida, se reagenda para ser chamada novamente.
+ * Ela avança o jogo (ou apenas consome os quadros da thread de simulação)
+ * e, em seguida, se reagenda para ser chamada novamente: a cada passo da
+ * simulação (~60 vezes por segundo) ou, com o jogo ocioso, bem mais devagar.
  *
- * @param value Valor inteiro passado pelo temporizador do GLUT (não utilizado).
+ * @param generation A geração do temporizador; se wakeCallback agendou um mais
+ * novo, este é descartado.
+ */
+void updateCallback(int generation) {
+    if (generation != s_timerGeneration) return;
+
+    const int now = glutGet(GLUT_ELAPSED_TIME);
+    game.tick(static_cast<float>(now - s_lastTick));
+    s_lastTick = now;
+    glutTimerFunc(game.getTickInterval(), updateCallback, generation);
+}
+
+/**
+ * @brief Chamada quando uma entrada chega com o jogo ocioso: antecipa o próximo
+ * updateCallback em vez de esperar o intervalo longo.
+ */
+void wakeCallback() {
+    glutTimerFunc(0, updateCallback, ++s_timerGeneration);
+}
+
+/**
+ * @brief Encerra as threads do jogo. Registrada no glutCloseFunc (janela fechada) e
+ * no atexit (o freeglut chama exit() ao fechar a janela), de forma que as threads
+ * terminam antes dos destrutores estáticos.
  */
-void updateCallback(int value) {
-    // Define um deltaTime fixo de 16ms, visando uma taxa de ~60 frames por segundo.
-    game.update(16);
-    // Reagenda esta mesma função para ser chamada novamente após 16ms.
-    glutTimerFunc(16, updateCallback, 0);
+void shutdownCallback() {
+    game.shutdown();
 }
 
 /**
@@ -85,12 +113,12 @@ void mouseMotionCallback(int x, int y) {
  *
  * @param argc O número de argumentos da linha de comando.
  * @param argv Um array de strings com os argumentos.
- * @return Retorna 0 ao finalizar a execução.
+ * @return Retorna 0 ao finalizar a execução, ou EXIT_FAILURE se o jogo não pôde ser inicializado.
  */
 int main(int argc, char** argv) {
     // 1. Inicialização do GLUT
     glutInit(&argc, argv);
-    glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGB | GLUT_DEPTH);
+    glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGB | GLUT_DEPTH | GLUT_STENCIL);
     glutInitWindowSize(Config::SCREEN_WIDTH, Config::SCREEN_HEIGHT);
     glutCreateWindow(Config::GAME_TITLE);
     glutSetCursor(GLUT_CURSOR_NONE); // Oculta o cursor do mouse.
@@ -100,13 +128,17 @@ int main(int argc, char** argv) {
     glutKeyboardFunc(keyboardDownCallback);
     glutKeyboardUpFunc(keyboardUpCallback);
     glutPassiveMotionFunc(mouseMotionCallback);
-    glutTimerFunc(16, updateCallback, 0);
+    glutTimerFunc(Config::SIMULATION_STEP_MS, updateCallback, s_timerGeneration);
+    game.setWakeCallback(wakeCallback);
+    glutCloseFunc(shutdownCallback);
+    std::atexit(shutdownCallback);
 
-    // 3. Inicialização do nosso jogo
-    game.init();
+    // 3. Inicialização do nosso jogo (inicia também a thread de simulação)
+    if (!game.init()) return EXIT_FAILURE;
 
     // Centraliza o ponteiro do mouse no início para evitar um pulo da câmera.
     glutWarpPointer(Config::SCREEN_WIDTH / 2, Config::SCREEN_HEIGHT / 2);
+    s_lastTick = glutGet(GLUT_ELAPSED_TIME);
 
     // 4. Inicia o Loop Principal do GLUT
     glutMainLoop();